@@ -73,6 +73,23 @@ elseif(NOT TARGET Asio::asio AND NOT HPX_FIND_PACKAGE)
   add_library(Asio::asio ALIAS asio)
 endif()
 
+# Asio uses liburing for its io_uring backend, Asio itself is header only,
+# thus everything using Asio has to link against liburing.
+if(HPX_WITH_ASIO_IO_URING)
+  find_package(Liburing)
+  if(NOT Liburing_FOUND)
+    hpx_error(
+      "HPX_WITH_ASIO_IO_URING=ON requires liburing. Set Liburing_ROOT as a CMake or environment variable to point to the liburing root install directory."
+    )
+  endif()
+
+  if(TARGET asio)
+    target_link_libraries(asio INTERFACE Liburing::liburing)
+  elseif(TARGET Asio::asio)
+    target_link_libraries(Asio::asio INTERFACE Liburing::liburing)
+  endif()
+endif()
+
 if(NOT HPX_FIND_PACKAGE)
   # Asio should use std::aligned_new only if available
   if(NOT HPX_WITH_CXX17_ALIGNED_NEW)
@@ -96,4 +113,12 @@ if(NOT HPX_FIND_PACKAGE)
 
   # Disable Asio's definition of NOMINMAX
   hpx_add_config_cond_define(ASIO_NO_NOMINMAX)
+
+  # Use io_uring for all I/O operations (sockets, timers, etc.), this replaces
+  # the epoll based reactor
+  if(HPX_WITH_ASIO_IO_URING)
+    hpx_add_config_define(HPX_HAVE_ASIO_IO_URING)
+    hpx_add_config_cond_define(ASIO_HAS_IO_URING 1)
+    hpx_add_config_cond_define(ASIO_DISABLE_EPOLL)
+  endif()
 endif()
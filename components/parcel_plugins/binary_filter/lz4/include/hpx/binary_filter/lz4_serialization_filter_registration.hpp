@@ -0,0 +1,65 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+
+#include <hpx/parcelset_base/traits/action_serialization_filter.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Messages smaller than the size configured by
+// hpx.plugins.lz4_serialization_filter.min_compress_size are sent
+// uncompressed.
+#define HPX_ACTION_USES_LZ4_COMPRESSION(action)                                \
+    namespace hpx::traits {                                                    \
+        template <>                                                            \
+        struct action_serialization_filter</**/ action>                        \
+        {                                                                      \
+            /* Note that the caller is responsible for deleting the filter */  \
+            /* instance returned from this function */                         \
+            static serialization::binary_filter* call()                        \
+            {                                                                  \
+                return hpx::create_binary_filter(                              \
+                    "lz4_serialization_filter", true);                         \
+            }                                                                  \
+        };                                                                     \
+    }                                                                          \
+    /**/
+
+// Messages smaller than min_size bytes are sent uncompressed.
+#define HPX_ACTION_USES_LZ4_COMPRESSION_THRESHOLD(action, min_size)            \
+    namespace hpx::traits {                                                    \
+        template <>                                                            \
+        struct action_serialization_filter</**/ action>                        \
+        {                                                                      \
+            /* Note that the caller is responsible for deleting the filter */  \
+            /* instance returned from this function */                         \
+            static serialization::binary_filter* call()                        \
+            {                                                                  \
+                serialization::binary_filter* filter =                         \
+                    hpx::create_binary_filter(                                 \
+                        "lz4_serialization_filter", true);                     \
+                if (filter != nullptr)                                         \
+                {                                                              \
+                    static_cast<hpx::plugins::compression::                    \
+                            lz4_serialization_filter*>(filter)                 \
+                        ->set_min_compress_size(min_size);                     \
+                }                                                              \
+                return filter;                                                 \
+            }                                                                  \
+        };                                                                     \
+    }                                                                          \
+    /**/
+
+#else
+
+#define HPX_ACTION_USES_LZ4_COMPRESSION(action)
+#define HPX_ACTION_USES_LZ4_COMPRESSION_THRESHOLD(action, min_size)
+
+#endif
@@ -0,0 +1,343 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/modules/util.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/binary_filter/lz4_serialization_filter.hpp>
+#include <hpx/components_base/component_startup_shutdown.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+#include <lz4.h>
+
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.plugins.lz4_serialization_filter]
+    //      ...
+    //      min_compress_size = 1024
+    //      acceleration = 1
+    //
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::lz4_serialization_filter>
+    {
+        static constexpr char const* call() noexcept
+        {
+            return "min_compress_size = 1024\n"
+                   "acceleration = 1";
+        }
+    };
+}    // namespace hpx::traits
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::lz4_serialization_filter,
+    lz4_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace detail {
+
+        // Each compressed message starts with one byte describing how the
+        // remaining data has to be interpreted.
+        enum class lz4_message_kind : std::uint8_t
+        {
+            stored = 0,
+            compressed = 1
+        };
+
+        // The configuration is read only once, as a new filter instance is
+        // created for every message.
+        std::size_t lz4_min_compress_size()
+        {
+            static std::size_t const min_compress_size =
+                hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                    "hpx.plugins.lz4_serialization_filter.min_compress_size",
+                    1024));
+            return min_compress_size;
+        }
+
+        int lz4_acceleration()
+        {
+            static int const acceleration =
+                hpx::util::from_string<int>(hpx::get_config_entry(
+                    "hpx.plugins.lz4_serialization_filter.acceleration", 1));
+            return acceleration;
+        }
+
+        struct lz4_statistics
+        {
+            std::atomic<std::int64_t> num_compressed{0};
+            std::atomic<std::int64_t> num_skipped{0};
+            std::atomic<std::int64_t> uncompressed_bytes{0};
+            std::atomic<std::int64_t> compressed_bytes{0};
+            std::atomic<std::int64_t> compression_time{0};
+            std::atomic<std::int64_t> decompression_time{0};
+        };
+
+        lz4_statistics& get_lz4_statistics()
+        {
+            static lz4_statistics statistics;
+            return statistics;
+        }
+    }    // namespace detail
+
+    lz4_serialization_filter::lz4_serialization_filter(
+        bool compress, serialization::binary_filter*)
+      : current_(0)
+      , min_compress_size_(detail::lz4_min_compress_size())
+      , compress_(compress)
+    {
+    }
+
+    void lz4_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t lz4_serialization_filter::init_data(
+        void const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        if (size == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::init_data",
+                "archive data bstream is too short");
+            return 0;
+        }
+
+        char const* src = static_cast<char const*>(buffer);
+        auto const kind = static_cast<detail::lz4_message_kind>(*src);
+        ++src;
+        --size;
+
+        current_ = 0;
+        if (kind == detail::lz4_message_kind::stored)
+        {
+            buffer_.assign(src, src + size);
+            return buffer_size;
+        }
+
+        std::int64_t const started_at =
+            hpx::chrono::high_resolution_clock::now();
+
+        buffer_.resize(buffer_size);
+        int const decompressed = LZ4_decompress_safe(src, buffer_.data(),
+            static_cast<int>(size), static_cast<int>(buffer_size));
+        if (decompressed < 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::init_data",
+                "decompression failure, malformed input data");
+            return 0;
+        }
+        buffer_.resize(static_cast<std::size_t>(decompressed));
+
+        detail::get_lz4_statistics().decompression_time +=
+            hpx::chrono::high_resolution_clock::now() - started_at;
+
+        return buffer_size;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_ + dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::load",
+                "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::save(void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(
+            src_begin, src_begin + src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool lz4_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        detail::lz4_statistics& statistics = detail::get_lz4_statistics();
+        char* dst_begin = static_cast<char*>(dst);
+
+        // small messages are not worth compressing, messages exceeding the
+        // limits of LZ4 cannot be compressed
+        if (buffer_.size() < min_compress_size_ ||
+            buffer_.size() > static_cast<std::size_t>(LZ4_MAX_INPUT_SIZE))
+        {
+            if (buffer_.size() + 1 > dst_count)
+            {
+                written = 0;
+                return false;
+            }
+
+            *dst_begin = static_cast<char>(detail::lz4_message_kind::stored);
+            std::memcpy(dst_begin + 1, buffer_.data(), buffer_.size());
+
+            ++statistics.num_skipped;
+            written = buffer_.size() + 1;
+            return true;
+        }
+
+        // make sure we have enough memory
+        std::size_t const needed = static_cast<std::size_t>(
+            LZ4_compressBound(static_cast<int>(buffer_.size())));
+        if (needed + 1 > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        // compress everything in one go
+        std::int64_t const started_at =
+            hpx::chrono::high_resolution_clock::now();
+
+        *dst_begin = static_cast<char>(detail::lz4_message_kind::compressed);
+        int const compressed = LZ4_compress_fast(buffer_.data(),
+            dst_begin + 1, static_cast<int>(buffer_.size()),
+            static_cast<int>(needed), detail::lz4_acceleration());
+        if (compressed <= 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::flush",
+                "compression failure, flushing did not reach end of data");
+            return false;
+        }
+
+        statistics.compression_time +=
+            hpx::chrono::high_resolution_clock::now() - started_at;
+        ++statistics.num_compressed;
+        statistics.uncompressed_bytes +=
+            static_cast<std::int64_t>(buffer_.size());
+        statistics.compressed_bytes += compressed;
+
+        written = static_cast<std::size_t>(compressed) + 1;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // performance counter values
+    namespace detail {
+
+        std::int64_t lz4_compression_ratio(bool reset)
+        {
+            lz4_statistics& statistics = get_lz4_statistics();
+            std::int64_t const uncompressed =
+                hpx::util::get_and_reset_value(
+                    statistics.uncompressed_bytes, reset);
+            std::int64_t const compressed = hpx::util::get_and_reset_value(
+                statistics.compressed_bytes, reset);
+
+            // compressed size relative to the uncompressed size [0.1%]
+            return uncompressed == 0 ? 0 : (compressed * 1000) / uncompressed;
+        }
+
+        std::int64_t lz4_compression_time(bool reset)
+        {
+            return hpx::util::get_and_reset_value(
+                get_lz4_statistics().compression_time, reset);
+        }
+
+        std::int64_t lz4_decompression_time(bool reset)
+        {
+            return hpx::util::get_and_reset_value(
+                get_lz4_statistics().decompression_time, reset);
+        }
+
+        std::int64_t lz4_num_compressed(bool reset)
+        {
+            return hpx::util::get_and_reset_value(
+                get_lz4_statistics().num_compressed, reset);
+        }
+
+        std::int64_t lz4_num_skipped(bool reset)
+        {
+            return hpx::util::get_and_reset_value(
+                get_lz4_statistics().num_skipped, reset);
+        }
+
+        void register_lz4_counter_types()
+        {
+            using hpx::performance_counters::counter_type;
+            using hpx::performance_counters::install_counter_type;
+
+            install_counter_type("/compression/lz4/ratio",
+                &lz4_compression_ratio,
+                "returns the size of the messages compressed by the LZ4 "
+                "binary filter relative to their uncompressed size",
+                "0.1%", counter_type::raw);
+            install_counter_type("/compression/lz4/time/compression",
+                &lz4_compression_time,
+                "returns the overall time spent compressing messages using "
+                "the LZ4 binary filter",
+                "ns", counter_type::monotonically_increasing);
+            install_counter_type("/compression/lz4/time/decompression",
+                &lz4_decompression_time,
+                "returns the overall time spent decompressing messages using "
+                "the LZ4 binary filter",
+                "ns", counter_type::monotonically_increasing);
+            install_counter_type("/compression/lz4/count/compressed",
+                &lz4_num_compressed,
+                "returns the number of messages compressed by the LZ4 binary "
+                "filter",
+                "", counter_type::monotonically_increasing);
+            install_counter_type("/compression/lz4/count/skipped",
+                &lz4_num_skipped,
+                "returns the number of messages sent uncompressed by the LZ4 "
+                "binary filter as they were smaller than the configured "
+                "minimal size",
+                "", counter_type::monotonically_increasing);
+        }
+
+        bool get_lz4_startup(
+            hpx::startup_function_type& startup_func, bool& pre_startup)
+        {
+            startup_func = register_lz4_counter_types;
+            pre_startup = true;
+            return true;
+        }
+    }    // namespace detail
+}    // namespace hpx::plugins::compression
+
+///////////////////////////////////////////////////////////////////////////////
+// Register a startup function which will be called as a HPX-thread during
+// runtime startup. We use this function to register our performance counter
+// types.
+HPX_REGISTER_STARTUP_MODULE(hpx::plugins::compression::detail::get_lz4_startup)
+
+#endif
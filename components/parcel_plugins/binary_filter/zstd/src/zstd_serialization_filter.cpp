@@ -0,0 +1,624 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/modules/util.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/binary_filter/zstd_serialization_filter.hpp>
+#include <hpx/components_base/component_startup_shutdown.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <zdict.h>
+#include <zstd.h>
+
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.plugins.zstd_serialization_filter]
+    //      ...
+    //      min_compress_size = 1024
+    //      level = 1
+    //      dictionary_samples = 1000
+    //      dictionary_size = 65536
+    //
+    // Additionally, the following keys are recognized:
+    //
+    //      dictionary = <file>         use the given (pre-trained) dictionary
+    //      train_dictionary = <file>   train a dictionary from the messages
+    //                                  sent and store it in the given file
+    //
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::zstd_serialization_filter>
+    {
+        static constexpr char const* call() noexcept
+        {
+            return "min_compress_size = 1024\n"
+                   "level = 1\n"
+                   "dictionary_samples = 1000\n"
+                   "dictionary_size = 65536";
+        }
+    };
+}    // namespace hpx::traits
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::zstd_serialization_filter,
+    zstd_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace detail {
+
+        // Each compressed message starts with one byte describing how the
+        // remaining data has to be interpreted.
+        enum class zstd_message_kind : std::uint8_t
+        {
+            stored = 0,
+            compressed = 1,
+            compressed_with_dictionary = 2
+        };
+
+        // Dictionaries are effective for small messages only, larger
+        // messages are not used as samples for training.
+        inline constexpr std::size_t zstd_max_sample_size = 16384;
+
+        // The configuration is read only once, as a new filter instance is
+        // created for every message.
+        std::size_t zstd_min_compress_size()
+        {
+            static std::size_t const min_compress_size =
+                hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                    "hpx.plugins.zstd_serialization_filter.min_compress_size",
+                    1024));
+            return min_compress_size;
+        }
+
+        int zstd_compression_level()
+        {
+            static int const level =
+                hpx::util::from_string<int>(hpx::get_config_entry(
+                    "hpx.plugins.zstd_serialization_filter.level", 1));
+            return level;
+        }
+
+        struct zstd_deleter
+        {
+            void operator()(ZSTD_CCtx* ctx) const noexcept
+            {
+                ZSTD_freeCCtx(ctx);
+            }
+            void operator()(ZSTD_DCtx* ctx) const noexcept
+            {
+                ZSTD_freeDCtx(ctx);
+            }
+            void operator()(ZSTD_CDict* dict) const noexcept
+            {
+                ZSTD_freeCDict(dict);
+            }
+            void operator()(ZSTD_DDict* dict) const noexcept
+            {
+                ZSTD_freeDDict(dict);
+            }
+        };
+
+        // Creating a (de-)compression context is expensive, every OS thread
+        // reuses its own contexts for all messages.
+        ZSTD_CCtx* zstd_compression_context()
+        {
+            thread_local std::unique_ptr<ZSTD_CCtx, zstd_deleter> const ctx(
+                ZSTD_createCCtx());
+            return ctx.get();
+        }
+
+        ZSTD_DCtx* zstd_decompression_context()
+        {
+            thread_local std::unique_ptr<ZSTD_DCtx, zstd_deleter> const ctx(
+                ZSTD_createDCtx());
+            return ctx.get();
+        }
+
+        // The dictionary is loaded once from the file configured by
+        // hpx.plugins.zstd_serialization_filter.dictionary. All localities
+        // have to use the same dictionary.
+        class zstd_dictionary
+        {
+        public:
+            zstd_dictionary()
+            {
+                std::string const filename = hpx::get_config_entry(
+                    "hpx.plugins.zstd_serialization_filter.dictionary", "");
+                if (filename.empty())
+                {
+                    return;
+                }
+
+                std::ifstream in(filename, std::ios::binary);
+                if (!in)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "zstd_dictionary::zstd_dictionary",
+                        "could not open the dictionary file: {}", filename);
+                }
+
+                std::vector<char> const data(
+                    (std::istreambuf_iterator<char>(in)),
+                    std::istreambuf_iterator<char>());
+
+                cdict_.reset(ZSTD_createCDict(
+                    data.data(), data.size(), zstd_compression_level()));
+                ddict_.reset(ZSTD_createDDict(data.data(), data.size()));
+                if (!cdict_ || !ddict_)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "zstd_dictionary::zstd_dictionary",
+                        "could not create the dictionary from file: {}",
+                        filename);
+                }
+            }
+
+            ZSTD_CDict const* compression_dictionary() const noexcept
+            {
+                return cdict_.get();
+            }
+
+            ZSTD_DDict const* decompression_dictionary() const noexcept
+            {
+                return ddict_.get();
+            }
+
+        private:
+            std::unique_ptr<ZSTD_CDict, zstd_deleter> cdict_;
+            std::unique_ptr<ZSTD_DDict, zstd_deleter> ddict_;
+        };
+
+        zstd_dictionary const& get_zstd_dictionary()
+        {
+            static zstd_dictionary const dictionary;
+            return dictionary;
+        }
+
+        // Collects samples of the messages sent if
+        // hpx.plugins.zstd_serialization_filter.train_dictionary is set.
+        // Once enough samples are available, a dictionary is trained and
+        // written to the configured file, which can be used as the
+        // dictionary for subsequent runs.
+        //
+        // Samples are added while messages are sent, thus adding a sample
+        // does not take a lock: every sample is copied into a slot of its
+        // own. The training itself is performed on a low priority HPX thread.
+        class zstd_dictionary_trainer
+        {
+        public:
+            zstd_dictionary_trainer()
+              : filename_(hpx::get_config_entry(
+                    "hpx.plugins.zstd_serialization_filter.train_dictionary",
+                    ""))
+              , num_samples_(filename_.empty() ?
+                        0 :
+                        hpx::util::from_string<std::size_t>(
+                            hpx::get_config_entry(
+                                "hpx.plugins.zstd_serialization_"
+                                "filter.dictionary_samples",
+                                1000)))
+              , dictionary_size_(hpx::util::from_string<std::size_t>(
+                    hpx::get_config_entry("hpx.plugins.zstd_serialization_"
+                                          "filter.dictionary_size",
+                        65536)))
+              , samples_(num_samples_)
+              , next_sample_(0)
+              , num_added_(0)
+            {
+            }
+
+            void add_sample(char const* data, std::size_t size)
+            {
+                if (size == 0 || size > zstd_max_sample_size ||
+                    next_sample_.load(std::memory_order_relaxed) >=
+                        num_samples_)
+                {
+                    return;
+                }
+
+                std::size_t const slot =
+                    next_sample_.fetch_add(1, std::memory_order_relaxed);
+                if (slot >= num_samples_)
+                {
+                    return;
+                }
+
+                samples_[slot].assign(data, data + size);
+
+                // the thread adding the last sample starts the training
+                if (num_added_.fetch_add(1, std::memory_order_acq_rel) + 1 ==
+                    num_samples_)
+                {
+                    threads::thread_init_data init(
+                        threads::make_thread_function_nullary(
+                            [this]() { train(); }),
+                        "zstd_dictionary_trainer::train",
+                        threads::thread_priority::low,
+                        threads::thread_schedule_hint(),
+                        threads::thread_stacksize::large);
+                    threads::register_thread(init);
+                }
+            }
+
+        private:
+            void train()
+            {
+                std::vector<char> samples;
+                std::vector<std::size_t> sample_sizes;
+                sample_sizes.reserve(samples_.size());
+                for (std::vector<char>& sample : samples_)
+                {
+                    samples.insert(samples.end(), sample.begin(), sample.end());
+                    sample_sizes.push_back(sample.size());
+                    std::vector<char>().swap(sample);
+                }
+
+                std::vector<char> dictionary(dictionary_size_);
+                std::size_t const size = ZDICT_trainFromBuffer(
+                    dictionary.data(), dictionary.size(), samples.data(),
+                    sample_sizes.data(),
+                    static_cast<unsigned>(sample_sizes.size()));
+                if (ZDICT_isError(size))
+                {
+                    LPT_(warning).format("zstd_serialization_filter: "
+                                         "training the dictionary failed: {}",
+                        ZDICT_getErrorName(size));
+                    return;
+                }
+
+                std::ofstream out(filename_, std::ios::binary);
+                out.write(
+                    dictionary.data(), static_cast<std::streamsize>(size));
+                if (!out)
+                {
+                    LPT_(warning).format("zstd_serialization_filter: could "
+                                         "not write the dictionary file: {}",
+                        filename_);
+                }
+            }
+
+            std::string const filename_;
+            std::size_t const num_samples_;
+            std::size_t const dictionary_size_;
+
+            std::vector<std::vector<char>> samples_;
+            std::atomic<std::size_t> next_sample_;
+            std::atomic<std::size_t> num_added_;
+        };
+
+        zstd_dictionary_trainer& get_zstd_dictionary_trainer()
+        {
+            static zstd_dictionary_trainer trainer;
+            return trainer;
+        }
+
+        struct zstd_statistics
+        {
+            std::atomic<std::int64_t> num_compressed{0};
+            std::atomic<std::int64_t> num_skipped{0};
+            std::atomic<std::int64_t> uncompressed_bytes{0};
+            std::atomic<std::int64_t> compressed_bytes{0};
+            std::atomic<std::int64_t> compression_time{0};
+            std::atomic<std::int64_t> decompression_time{0};
+        };
+
+        zstd_statistics& get_zstd_statistics()
+        {
+            static zstd_statistics statistics;
+            return statistics;
+        }
+    }    // namespace detail
+
+    zstd_serialization_filter::zstd_serialization_filter(
+        bool compress, serialization::binary_filter*)
+      : current_(0)
+      , min_compress_size_(detail::zstd_min_compress_size())
+      , compress_(compress)
+    {
+    }
+
+    void zstd_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t zstd_serialization_filter::init_data(
+        void const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        if (size == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "zstd_serialization_filter::init_data",
+                "archive data bstream is too short");
+            return 0;
+        }
+
+        char const* src = static_cast<char const*>(buffer);
+        auto const kind = static_cast<detail::zstd_message_kind>(*src);
+        ++src;
+        --size;
+
+        current_ = 0;
+        if (kind == detail::zstd_message_kind::stored)
+        {
+            buffer_.assign(src, src + size);
+            return buffer_size;
+        }
+
+        std::int64_t const started_at =
+            hpx::chrono::high_resolution_clock::now();
+
+        buffer_.resize(buffer_size);
+
+        std::size_t decompressed = 0;
+        if (kind == detail::zstd_message_kind::compressed_with_dictionary)
+        {
+            ZSTD_DDict const* dict =
+                detail::get_zstd_dictionary().decompression_dictionary();
+            if (dict == nullptr)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "zstd_serialization_filter::init_data",
+                    "received a message compressed using a dictionary, but "
+                    "no dictionary was configured");
+                return 0;
+            }
+
+            decompressed = ZSTD_decompress_usingDDict(
+                detail::zstd_decompression_context(), buffer_.data(),
+                buffer_size, src, size, dict);
+        }
+        else
+        {
+            decompressed =
+                ZSTD_decompressDCtx(detail::zstd_decompression_context(),
+                    buffer_.data(), buffer_size, src, size);
+        }
+
+        if (ZSTD_isError(decompressed))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "zstd_serialization_filter::init_data",
+                "decompression failure, {}", ZSTD_getErrorName(decompressed));
+            return 0;
+        }
+        buffer_.resize(decompressed);
+
+        detail::get_zstd_statistics().decompression_time +=
+            hpx::chrono::high_resolution_clock::now() - started_at;
+
+        return buffer_size;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_ + dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "zstd_serialization_filter::load",
+                "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::save(void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(
+            src_begin, src_begin + src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool zstd_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        detail::zstd_statistics& statistics = detail::get_zstd_statistics();
+        char* dst_begin = static_cast<char*>(dst);
+
+        // small messages are not worth compressing
+        if (buffer_.size() < min_compress_size_)
+        {
+            if (buffer_.size() + 1 > dst_count)
+            {
+                written = 0;
+                return false;
+            }
+
+            *dst_begin = static_cast<char>(detail::zstd_message_kind::stored);
+            std::memcpy(dst_begin + 1, buffer_.data(), buffer_.size());
+
+            detail::get_zstd_dictionary_trainer().add_sample(
+                buffer_.data(), buffer_.size());
+
+            ++statistics.num_skipped;
+            written = buffer_.size() + 1;
+            return true;
+        }
+
+        // make sure we have enough memory
+        std::size_t const needed = ZSTD_compressBound(buffer_.size());
+        if (needed + 1 > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        detail::get_zstd_dictionary_trainer().add_sample(
+            buffer_.data(), buffer_.size());
+
+        // compress everything in one go
+        std::int64_t const started_at =
+            hpx::chrono::high_resolution_clock::now();
+
+        std::size_t compressed = 0;
+        ZSTD_CDict const* dict =
+            detail::get_zstd_dictionary().compression_dictionary();
+        if (dict != nullptr)
+        {
+            *dst_begin = static_cast<char>(
+                detail::zstd_message_kind::compressed_with_dictionary);
+            compressed = ZSTD_compress_usingCDict(
+                detail::zstd_compression_context(), dst_begin + 1, needed,
+                buffer_.data(), buffer_.size(), dict);
+        }
+        else
+        {
+            *dst_begin =
+                static_cast<char>(detail::zstd_message_kind::compressed);
+            compressed = ZSTD_compressCCtx(detail::zstd_compression_context(),
+                dst_begin + 1, needed, buffer_.data(), buffer_.size(),
+                detail::zstd_compression_level());
+        }
+
+        if (ZSTD_isError(compressed))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "zstd_serialization_filter::flush",
+                "compression failure, {}", ZSTD_getErrorName(compressed));
+            return false;
+        }
+
+        statistics.compression_time +=
+            hpx::chrono::high_resolution_clock::now() - started_at;
+        ++statistics.num_compressed;
+        statistics.uncompressed_bytes +=
+            static_cast<std::int64_t>(buffer_.size());
+        statistics.compressed_bytes += static_cast<std::int64_t>(compressed);
+
+        written = compressed + 1;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // performance counter values
+    namespace detail {
+
+        std::int64_t zstd_compression_ratio(bool reset)
+        {
+            zstd_statistics& statistics = get_zstd_statistics();
+            std::int64_t const uncompressed =
+                hpx::util::get_and_reset_value(
+                    statistics.uncompressed_bytes, reset);
+            std::int64_t const compressed = hpx::util::get_and_reset_value(
+                statistics.compressed_bytes, reset);
+
+            // compressed size relative to the uncompressed size [0.1%]
+            return uncompressed == 0 ? 0 : (compressed * 1000) / uncompressed;
+        }
+
+        std::int64_t zstd_compression_time(bool reset)
+        {
+            return hpx::util::get_and_reset_value(
+                get_zstd_statistics().compression_time, reset);
+        }
+
+        std::int64_t zstd_decompression_time(bool reset)
+        {
+            return hpx::util::get_and_reset_value(
+                get_zstd_statistics().decompression_time, reset);
+        }
+
+        std::int64_t zstd_num_compressed(bool reset)
+        {
+            return hpx::util::get_and_reset_value(
+                get_zstd_statistics().num_compressed, reset);
+        }
+
+        std::int64_t zstd_num_skipped(bool reset)
+        {
+            return hpx::util::get_and_reset_value(
+                get_zstd_statistics().num_skipped, reset);
+        }
+
+        void register_zstd_counter_types()
+        {
+            using hpx::performance_counters::counter_type;
+            using hpx::performance_counters::install_counter_type;
+
+            install_counter_type("/compression/zstd/ratio",
+                &zstd_compression_ratio,
+                "returns the size of the messages compressed by the Zstandard "
+                "binary filter relative to their uncompressed size",
+                "0.1%", counter_type::raw);
+            install_counter_type("/compression/zstd/time/compression",
+                &zstd_compression_time,
+                "returns the overall time spent compressing messages using "
+                "the Zstandard binary filter",
+                "ns", counter_type::monotonically_increasing);
+            install_counter_type("/compression/zstd/time/decompression",
+                &zstd_decompression_time,
+                "returns the overall time spent decompressing messages using "
+                "the Zstandard binary filter",
+                "ns", counter_type::monotonically_increasing);
+            install_counter_type("/compression/zstd/count/compressed",
+                &zstd_num_compressed,
+                "returns the number of messages compressed by the Zstandard "
+                "binary filter",
+                "", counter_type::monotonically_increasing);
+            install_counter_type("/compression/zstd/count/skipped",
+                &zstd_num_skipped,
+                "returns the number of messages sent uncompressed by the "
+                "Zstandard binary filter as they were smaller than the "
+                "configured minimal size",
+                "", counter_type::monotonically_increasing);
+        }
+
+        bool get_zstd_startup(
+            hpx::startup_function_type& startup_func, bool& pre_startup)
+        {
+            startup_func = register_zstd_counter_types;
+            pre_startup = true;
+            return true;
+        }
+    }    // namespace detail
+}    // namespace hpx::plugins::compression
+
+///////////////////////////////////////////////////////////////////////////////
+// Register a startup function which will be called as a HPX-thread during
+// runtime startup. We use this function to register our performance counter
+// types.
+HPX_REGISTER_STARTUP_MODULE(
+    hpx::plugins::compression::detail::get_zstd_startup)
+
+#endif
@@ -56,6 +56,8 @@ namespace hpx::plugins::parcel {
         std::int64_t get_messages_count(bool reset);
         std::int64_t get_parcels_per_message_count(bool reset);
         std::int64_t get_average_time_between_parcels(bool reset);
+        std::int64_t get_parcels_per_message_limit(bool reset);
+        std::int64_t get_flush_interval(bool reset);
         std::vector<std::int64_t> get_time_between_parcels_histogram(
             bool reset);
         void get_time_between_parcels_histogram_creator(
@@ -74,6 +76,13 @@ namespace hpx::plugins::parcel {
 
         void update_num_messages();
         void update_interval();
+        void update_latency_budget();
+
+        // adjust the number of parcels to coalesce and the flush interval
+        // based on the observed parcel rate and sizes (adaptive mode only)
+        void update_statistics(std::int64_t time_since_last_parcel);
+        void update_parcel_size(std::size_t parcel_size);
+        void adapt_parameters();
 
     private:
         mutable mutex_type mtx_;
@@ -86,6 +95,19 @@ namespace hpx::plugins::parcel {
         bool allow_background_flush_;
         std::string action_name_;
 
+        // adaptive coalescing: num_coalesced_parcels_ and interval_ are
+        // derived from the observed parcel stream, the configured values are
+        // used as upper bounds
+        bool adaptive_;
+        std::size_t max_coalesced_parcels_;
+        std::size_t latency_budget_;         // [us]
+        std::size_t target_message_size_;    // [bytes]
+
+        // moving averages of the time between parcels [ns] and of the
+        // parcel sizes [bytes]
+        double average_time_between_parcels_;
+        double average_parcel_size_;
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
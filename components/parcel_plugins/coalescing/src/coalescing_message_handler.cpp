@@ -23,11 +23,13 @@
 
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <mutex>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -41,6 +43,10 @@ namespace hpx::traits {
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      allow_background_flush = 1
+    //      adaptive = 0
+    //      latency_budget = 100
+    //      target_message_size = 32768
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -49,7 +55,10 @@ namespace hpx::traits {
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0\n"
+                   "latency_budget = 100\n"
+                   "target_message_size = 32768";
         }
     };
 }    // namespace hpx::traits
@@ -84,19 +93,126 @@ namespace hpx::plugins::parcel {
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        std::size_t get_latency_budget(std::size_t latency_budget)
+        {
+            return hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.latency_budget",
+                latency_budget));
+        }
+
+        std::size_t get_target_message_size()
+        {
+            return hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.target_message_size",
+                32768));
+        }
+
+        // weight of a new sample for the moving averages of the parcel stream
+        constexpr double adaptive_sample_weight = 0.125;
     }    // namespace detail
 
     void coalescing_message_handler::update_num_messages()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        num_coalesced_parcels_ =
-            detail::get_num_messages(num_coalesced_parcels_);
+        max_coalesced_parcels_ =
+            detail::get_num_messages(max_coalesced_parcels_);
+        if (adaptive_)
+        {
+            adapt_parameters();
+        }
+        else
+        {
+            num_coalesced_parcels_ = max_coalesced_parcels_;
+        }
     }
 
     void coalescing_message_handler::update_interval()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        interval_ = detail::get_interval(interval_);
+        if (!adaptive_)
+        {
+            interval_ = detail::get_interval(interval_);
+        }
+    }
+
+    void coalescing_message_handler::update_latency_budget()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        latency_budget_ = detail::get_latency_budget(latency_budget_);
+        if (adaptive_)
+        {
+            adapt_parameters();
+        }
+    }
+
+    // Update the moving average of the time between parcels. Gaps larger
+    // than the latency budget are clamped as they do not allow for any
+    // coalescing anyway, this way a single idle period does not dominate
+    // the average.
+    void coalescing_message_handler::update_statistics(
+        std::int64_t time_since_last_parcel)
+    {
+        double const budget = double(latency_budget_) * 1000.0;
+        double const sample =
+            (std::min)(double(time_since_last_parcel), budget);
+
+        average_time_between_parcels_ +=
+            detail::adaptive_sample_weight *
+            (sample - average_time_between_parcels_);
+    }
+
+    // The size of a parcel is known only after it has been serialized by the
+    // parcelport, it is reported back through the write handler of the
+    // parcel. The new average is taken into account when the next message is
+    // started.
+    void coalescing_message_handler::update_parcel_size(
+        std::size_t parcel_size)
+    {
+        if (parcel_size == 0)
+            return;
+
+        std::lock_guard<mutex_type> l(mtx_);
+        average_parcel_size_ += detail::adaptive_sample_weight *
+            (double(parcel_size) - average_parcel_size_);
+    }
+
+    // Choose the number of parcels to coalesce such that the first parcel
+    // of a message is expected to be delayed by no more than the latency
+    // budget. Larger parcels gain less from being coalesced, thus the size
+    // of the generated messages is limited as well.
+    void coalescing_message_handler::adapt_parameters()
+    {
+        double const budget = double(latency_budget_) * 1000.0;    // [ns]
+
+        double num_parcels = double(max_coalesced_parcels_);
+        if (average_time_between_parcels_ > 0.0)
+        {
+            num_parcels = (std::min)(
+                num_parcels, budget / average_time_between_parcels_);
+        }
+        if (average_parcel_size_ > 0.0)
+        {
+            num_parcels = (std::min)(num_parcels,
+                double(target_message_size_) / average_parcel_size_);
+        }
+
+        num_coalesced_parcels_ = (std::max)(std::size_t(num_parcels),
+            static_cast<std::size_t>(1));
+
+        // wait no longer than it is expected to take to fill the buffer
+        double const fill_time =
+            double(num_coalesced_parcels_) * average_time_between_parcels_;
+        interval_ = (std::max)(
+            static_cast<std::size_t>((std::min)(budget, fill_time) / 1000.0),
+            static_cast<std::size_t>(1));
     }
 
     coalescing_message_handler::coalescing_message_handler(
@@ -112,6 +228,12 @@ namespace hpx::plugins::parcel {
       , stopped_(false)
       , allow_background_flush_(detail::get_background_flush())
       , action_name_(action_name)
+      , adaptive_(detail::get_adaptive())
+      , max_coalesced_parcels_(num_coalesced_parcels_)
+      , latency_budget_(detail::get_latency_budget(interval_))
+      , target_message_size_(detail::get_target_message_size())
+      , average_time_between_parcels_(double(latency_budget_) * 1000.0)
+      , average_parcel_size_(0.0)
       , num_parcels_(0)
       , reset_num_parcels_(0)
       , reset_num_parcels_per_message_parcels_(0)
@@ -125,6 +247,13 @@ namespace hpx::plugins::parcel {
       , histogram_max_boundary_(-1)
       , histogram_num_buckets_(-1)
     {
+        // start without coalescing until the parcel stream has been observed
+        if (adaptive_)
+        {
+            adapt_parameters();
+            buffer_ = detail::message_buffer(num_coalesced_parcels_);
+        }
+
         // register performance counter functions
         coalescing_counter_registry::instance().register_action(action_name,
             hpx::bind_front(
@@ -137,6 +266,11 @@ namespace hpx::plugins::parcel {
             hpx::bind_front(
                 &coalescing_message_handler::get_average_time_between_parcels,
                 this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_parcels_per_message_limit,
+                this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_flush_interval, this),
             hpx::bind_front(&coalescing_message_handler::
                                 get_time_between_parcels_histogram_creator,
                 this));
@@ -148,6 +282,10 @@ namespace hpx::plugins::parcel {
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             hpx::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.latency_budget",
+            hpx::bind(
+                &coalescing_message_handler::update_latency_budget, this));
     }
 
     void coalescing_message_handler::put_parcel(parcelset::locality const& dest,
@@ -165,13 +303,39 @@ namespace hpx::plugins::parcel {
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        // re-evaluate the coalescing parameters before starting a new message
+        if (adaptive_)
+        {
+            update_statistics(time_since_last_parcel);
+
+            // observe the size of the parcel once it has been serialized
+            f = [this, f = HPX_MOVE(f)](std::error_code const& ec,
+                    parcelset::parcel const& p) {
+                update_parcel_size(p.size());
+                if (f)
+                    f(ec, p);
+            };
+
+            if (buffer_.empty())
+            {
+                adapt_parameters();
+                if (buffer_.capacity() != num_coalesced_parcels_)
+                {
+                    buffer_ = detail::message_buffer(num_coalesced_parcels_);
+                }
+            }
+        }
+
         std::chrono::microseconds interval(interval_);
 
         // just send parcel if the coalescing was stopped or the buffer is
-        // empty and time since last parcel is larger than coalescing interval.
+        // empty and time since last parcel is larger than coalescing interval
+        // (or coalescing is not expected to pay off).
         if (stopped_ ||
             (buffer_.empty() &&
-                std::chrono::nanoseconds(time_since_last_parcel) > interval))
+                (num_coalesced_parcels_ <= 1 ||
+                    std::chrono::nanoseconds(time_since_last_parcel) >
+                        interval)))
         {
             ++num_messages_;
             l.unlock();
@@ -326,6 +490,20 @@ namespace hpx::plugins::parcel {
         return value;
     }
 
+    std::int64_t coalescing_message_handler::get_parcels_per_message_limit(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(num_coalesced_parcels_);
+    }
+
+    std::int64_t coalescing_message_handler::get_flush_interval(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(interval_) * 1000;    // [ns]
+    }
+
     std::int64_t coalescing_message_handler::get_parcels_count(bool reset)
     {
         std::unique_lock<mutex_type> l(mtx_);
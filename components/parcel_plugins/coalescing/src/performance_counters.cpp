@@ -378,6 +378,165 @@ namespace hpx::plugins::parcel {
             ec);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    struct parcels_per_message_limit_counter_surrogate
+    {
+        explicit parcels_per_message_limit_counter_surrogate(
+            std::string const& parameters)
+          : parameters_(parameters)
+        {
+        }
+
+        std::int64_t operator()(bool reset)
+        {
+            if (counter_.empty())
+            {
+                counter_ =
+                    coalescing_counter_registry::instance()
+                        .get_parcels_per_message_limit_counter(parameters_);
+                if (counter_.empty())
+                    return 0;    // no counter available yet
+            }
+
+            // dispatch to actual counter
+            return counter_(reset);
+        }
+
+        hpx::function<std::int64_t(bool)> counter_;
+        std::string parameters_;
+    };
+
+    hpx::naming::gid_type parcels_per_message_limit_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        if (info.type_ != performance_counters::counter_type::raw)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "parcels_per_message_limit_counter_creator",
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+
+        performance_counters::counter_path_elements paths;
+        performance_counters::get_counter_path_elements(
+            info.fullname_, paths, ec);
+        if (ec)
+            return naming::invalid_gid;
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "parcels_per_message_limit_counter_creator",
+                "invalid counter name for parcels per message limit (instance "
+                "name must not be a valid base counter name)");
+            return naming::invalid_gid;
+        }
+
+        if (paths.parameters_.empty())
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "parcels_per_message_limit_counter_creator",
+                "invalid counter parameter for parcels per message limit: must "
+                "specify an action type");
+            return naming::invalid_gid;
+        }
+
+        // ask registry
+        hpx::function<std::int64_t(bool)> f =
+            coalescing_counter_registry::instance()
+                .get_parcels_per_message_limit_counter(paths.parameters_);
+
+        if (!f.empty())
+        {
+            return performance_counters::detail::create_raw_counter(
+                info, HPX_MOVE(f), ec);
+        }
+
+        // the counter is not available yet, create surrogate function
+        return performance_counters::detail::create_raw_counter(info,
+            parcels_per_message_limit_counter_surrogate(paths.parameters_),
+            ec);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct flush_interval_counter_surrogate
+    {
+        explicit flush_interval_counter_surrogate(std::string const& parameters)
+          : parameters_(parameters)
+        {
+        }
+
+        std::int64_t operator()(bool reset)
+        {
+            if (counter_.empty())
+            {
+                counter_ = coalescing_counter_registry::instance()
+                               .get_flush_interval_counter(parameters_);
+                if (counter_.empty())
+                    return 0;    // no counter available yet
+            }
+
+            // dispatch to actual counter
+            return counter_(reset);
+        }
+
+        hpx::function<std::int64_t(bool)> counter_;
+        std::string parameters_;
+    };
+
+    hpx::naming::gid_type flush_interval_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        if (info.type_ != performance_counters::counter_type::raw)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "flush_interval_counter_creator",
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+
+        performance_counters::counter_path_elements paths;
+        performance_counters::get_counter_path_elements(
+            info.fullname_, paths, ec);
+        if (ec)
+            return naming::invalid_gid;
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "flush_interval_counter_creator",
+                "invalid counter name for flush interval (instance "
+                "name must not be a valid base counter name)");
+            return naming::invalid_gid;
+        }
+
+        if (paths.parameters_.empty())
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "flush_interval_counter_creator",
+                "invalid counter parameter for flush interval: must "
+                "specify an action type");
+            return naming::invalid_gid;
+        }
+
+        // ask registry
+        hpx::function<std::int64_t(bool)> f =
+            coalescing_counter_registry::instance()
+                .get_flush_interval_counter(paths.parameters_);
+
+        if (!f.empty())
+        {
+            return performance_counters::detail::create_raw_counter(
+                info, HPX_MOVE(f), ec);
+        }
+
+        // the counter is not available yet, create surrogate function
+        return performance_counters::detail::create_raw_counter(
+            info, flush_interval_counter_surrogate(paths.parameters_), ec);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     struct time_between_parcels_histogram_counter_surrogate
     {
@@ -571,6 +730,22 @@ namespace hpx::plugins::parcel {
                 HPX_PERFORMANCE_COUNTER_V1,
                 &average_time_between_parcels_counter_creator,
                 &counter_discoverer, "ns"},
+            // /coalescing(...)/count/parcels-per-message-limit@action-name
+            {"/coalescing/count/parcels-per-message-limit",
+                counter_type::raw,
+                "returns the current maximal number of parcels coalesced into "
+                "one message for the action which is given by the counter "
+                "parameter (this is adjusted dynamically in adaptive mode)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &parcels_per_message_limit_counter_creator,
+                &counter_discoverer, ""},
+            // /coalescing(...)/time/flush-interval@action-name
+            {"/coalescing/time/flush-interval", counter_type::raw,
+                "returns the current time after which coalesced parcels are "
+                "sent for the action which is given by the counter parameter "
+                "(this is adjusted dynamically in adaptive mode)",
+                HPX_PERFORMANCE_COUNTER_V1, &flush_interval_counter_creator,
+                &counter_discoverer, "ns"},
             // /coalescing(...)/time/between-parcels-histogram@action-name,min,max,buckets
             {"/coalescing/time/between-parcels-histogram",
                 counter_type::histogram,
@@ -15,8 +15,14 @@
 #include <hpx/include/runtime.hpp>
 #include <hpx/iostream.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/thread.hpp>
+#include <hpx/util/from_string.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <type_traits>
@@ -41,7 +47,6 @@ hpx::parcelset::parcel generate_parcel(
         hpx::launch::async, std::forward<T>(data)));
 
     p.set_source_id(hpx::find_here());
-    p.size() = 4096;
 
     return p;
 }
@@ -213,6 +218,112 @@ void test_mixed_arguments(hpx::id_type const& id)
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Send the given number of parcels, each one after waiting for 'gap'
+std::vector<hpx::future<hpx::id_type>> send_parcels(
+    hpx::id_type const& id, std::size_t count, std::chrono::microseconds gap)
+{
+    std::vector<double> data(vsize_default);
+    std::generate(data.begin(), data.end(), std::rand);
+
+    std::vector<hpx::future<hpx::id_type>> results;
+    results.reserve(count);
+
+    std::vector<hpx::parcelset::parcel> parcels;
+    parcels.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        hpx::distributed::promise<hpx::id_type> p;
+        results.push_back(p.get_future());
+        parcels.push_back(generate_parcel<test1_action>(id, p.get_id(), data));
+    }
+
+    auto& ph = hpx::get_runtime_distributed().get_parcel_handler();
+    if (gap.count() == 0)
+    {
+        ph.put_parcels(std::move(parcels));
+    }
+    else
+    {
+        for (hpx::parcelset::parcel& p : parcels)
+        {
+            hpx::this_thread::sleep_for(gap);
+
+            std::vector<hpx::parcelset::parcel> single;
+            single.push_back(std::move(p));
+            ph.put_parcels(std::move(single));
+        }
+    }
+    return results;
+}
+
+std::int64_t get_counter_value(std::string const& name)
+{
+    hpx::performance_counters::performance_counter c(
+        "/coalescing{locality#0/total}/" + name + "@test1_action");
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+// The adaptive coalescing has to combine the parcels of a dense burst while
+// honoring the latency budget and the target message size, and has to send
+// sparse parcels directly.
+void test_adaptive_coalescing(hpx::id_type const& id)
+{
+    std::int64_t const latency_budget =
+        hpx::util::from_string<std::int64_t>(hpx::get_config_entry(
+            "hpx.plugins.coalescing_message_handler.latency_budget", "100"));
+    std::int64_t const target_message_size =
+        hpx::util::from_string<std::int64_t>(hpx::get_config_entry(
+            "hpx.plugins.coalescing_message_handler.target_message_size",
+            "32768"));
+
+    hpx::components::client<test_server> c = hpx::new_<test_server>(id);
+
+    // dense bursts, the sizes of the parcels of the first burst are reported
+    // once they have been serialized and limit the messages of the second
+    for (int i = 0; i != 2; ++i)
+    {
+        auto results =
+            send_parcels(c.get_id(), 1000, std::chrono::microseconds(0));
+        hpx::wait_all(results);
+    }
+
+    {
+        std::int64_t const limit =
+            get_counter_value("count/parcels-per-message-limit");
+        std::int64_t const interval =
+            get_counter_value("time/flush-interval");    // [ns]
+
+        // each parcel carries at least the vector of doubles
+        std::int64_t const min_parcel_size =
+            static_cast<std::int64_t>(vsize_default * sizeof(double));
+
+        HPX_TEST_LT(std::int64_t(1), limit);
+        HPX_TEST_LTE(limit, target_message_size / min_parcel_size);
+        HPX_TEST_LTE(interval, latency_budget * 1000);
+    }
+
+    // sparse traffic, the gap between parcels exceeds the latency budget
+    {
+        std::int64_t const parcels = get_counter_value("count/parcels");
+        std::int64_t const messages = get_counter_value("count/messages");
+
+        std::size_t const count = 20;
+        auto results = send_parcels(
+            c.get_id(), count, std::chrono::microseconds(10 * latency_budget));
+        hpx::wait_all(results);
+
+        HPX_TEST_EQ(
+            get_counter_value("count/parcels-per-message-limit"), 1);
+
+        // each parcel was sent as a message of its own
+        HPX_TEST_EQ(get_counter_value("count/parcels") - parcels,
+            static_cast<std::int64_t>(count));
+        HPX_TEST_EQ(get_counter_value("count/messages") - messages,
+            static_cast<std::int64_t>(count));
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void print_counters(char const* name)
 {
@@ -240,11 +351,19 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::cout << "using seed: " << seed << std::endl;
     std::srand(seed);
 
+    std::string const adaptive = hpx::get_config_entry(
+        "hpx.plugins.coalescing_message_handler.adaptive", "0");
+
     for (hpx::id_type const& id : hpx::find_remote_localities())
     {
         test_plain_argument(id);
         test_future_argument(id);
         test_mixed_arguments(id);
+
+        if (!adaptive.empty() && adaptive[0] != '0')
+        {
+            test_adaptive_coalescing(id);
+        }
     }
 
     // make sure coalescing was actually invoked
@@ -252,6 +371,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
     print_counters("/coalescing{locality#0/total}/count/parcels@test2_action");
     print_counters("/coalescing{locality#0/total}/count/messages@test1_action");
     print_counters("/coalescing{locality#0/total}/count/messages@test2_action");
+    print_counters("/coalescing{locality#0/total}/count/"
+                   "parcels-per-message-limit@test1_action");
+    print_counters("/coalescing{locality#0/total}/time/"
+                   "flush-interval@test1_action");
 
     return hpx::finalize();
 }
@@ -318,6 +318,7 @@ namespace hpx {
 #include <hpx/execution/algorithms/detail/is_negative.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/copy_if.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/transfer.hpp>
@@ -524,22 +525,6 @@ namespace hpx::parallel {
     // copy_if
     namespace detail {
 
-        // sequential copy_if with projection function
-        template <typename InIter1, typename InIter2, typename OutIter,
-            typename Pred, typename Proj>
-        constexpr util::in_out_result<InIter1, OutIter> sequential_copy_if(
-            InIter1 first, InIter2 last, OutIter dest, Pred&& pred, Proj&& proj)
-        {
-            while (first != last)
-            {
-                if (HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
-                    *dest++ = *first;
-                ++first;
-            }
-            return util::in_out_result<InIter1, OutIter>{
-                HPX_MOVE(first), HPX_MOVE(dest)};
-        }
-
         template <typename IterPair>
         struct copy_if : public algorithm<copy_if<IterPair>, IterPair>
         {
@@ -551,11 +536,12 @@ namespace hpx::parallel {
             template <typename ExPolicy, typename InIter1, typename InIter2,
                 typename OutIter, typename Pred, typename Proj = hpx::identity>
             static constexpr util::in_out_result<InIter1, OutIter> sequential(
-                ExPolicy, InIter1 first, InIter2 last, OutIter dest,
+                ExPolicy&& policy, InIter1 first, InIter2 last, OutIter dest,
                 Pred&& pred, Proj&& proj /* = Proj()*/)
             {
-                return sequential_copy_if(first, last, dest,
-                    HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+                return sequential_copy_if(HPX_FORWARD(ExPolicy, policy), first,
+                    last, dest, HPX_FORWARD(Pred, pred),
+                    HPX_FORWARD(Proj, proj));
             }
 
             template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
@@ -587,6 +573,12 @@ namespace hpx::parallel {
 #endif
                 std::size_t init = 0;
 
+                // the loops over the flags operate on individual elements, even
+                // for vector-pack execution policies
+                using loop_policy_type = std::conditional_t<
+                    hpx::is_vectorpack_execution_policy_v<ExPolicy>,
+                    hpx::execution::sequenced_policy, std::decay_t<ExPolicy>>;
+
                 using hpx::get;
                 typedef util::scan_partitioner<ExPolicy,
                     util::in_out_result<FwdIter1, FwdIter3>, std::size_t>
@@ -602,7 +594,7 @@ namespace hpx::parallel {
                     // below makes gcc generate errors
 
                     // MSVC complains if proj is captured by ref below
-                    util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
+                    util::loop_n<loop_policy_type>(part_begin, part_size,
                         [&pred, proj, &curr](zip_iterator it) mutable -> void {
                             bool f = hpx::invoke(
                                 pred, hpx::invoke(proj, get<0>(*it)));
@@ -617,7 +609,7 @@ namespace hpx::parallel {
                               std::size_t part_size, std::size_t val) mutable {
                     HPX_UNUSED(flags);
                     std::advance(dest, val);
-                    util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
+                    util::loop_n<loop_policy_type>(part_begin, part_size,
                         [&dest](zip_iterator it) mutable {
                             if (get<1>(*it))
                                 *dest++ = get<0>(*it);
@@ -0,0 +1,64 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // sequential copy_if with projection function
+    template <typename InIter, typename Sent, typename OutIter, typename Pred,
+        typename Proj>
+    constexpr util::in_out_result<InIter, OutIter> sequential_copy_if_helper(
+        InIter first, Sent last, OutIter dest, Pred&& pred, Proj&& proj)
+    {
+        while (first != last)
+        {
+            if (HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
+                *dest++ = *first;
+            ++first;
+        }
+        return util::in_out_result<InIter, OutIter>{
+            HPX_MOVE(first), HPX_MOVE(dest)};
+    }
+
+    struct sequential_copy_if_t
+      : hpx::functional::detail::tag_fallback<sequential_copy_if_t>
+    {
+    private:
+        template <typename ExPolicy, typename InIter, typename Sent,
+            typename OutIter, typename Pred, typename Proj>
+        friend constexpr util::in_out_result<InIter, OutIter>
+        tag_fallback_invoke(sequential_copy_if_t, ExPolicy&&, InIter first,
+            Sent last, OutIter dest, Pred&& pred, Proj&& proj)
+        {
+            return sequential_copy_if_helper(first, last, dest,
+                HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    inline constexpr sequential_copy_if_t sequential_copy_if =
+        sequential_copy_if_t{};
+#else
+    template <typename ExPolicy, typename InIter, typename Sent,
+        typename OutIter, typename Pred, typename Proj>
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::in_out_result<InIter, OutIter>
+    sequential_copy_if(ExPolicy&& policy, InIter first, Sent last,
+        OutIter dest, Pred&& pred, Proj&& proj)
+    {
+        return sequential_copy_if_t{}(HPX_FORWARD(ExPolicy, policy), first,
+            last, dest, HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+    }
+#endif
+}    // namespace hpx::parallel::detail
@@ -0,0 +1,143 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/is_value_proxy.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // find the first smallest element of [it, it + count)
+    struct sequential_min_element_t
+      : hpx::functional::detail::tag_fallback<sequential_min_element_t>
+    {
+    private:
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        friend constexpr FwdIter tag_fallback_invoke(sequential_min_element_t,
+            ExPolicy&&, FwdIter it, std::size_t count, F const& f,
+            Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            auto smallest = it;
+
+            element_type value = HPX_INVOKE(proj, *smallest);
+            util::loop_n<std::decay_t<ExPolicy>>(
+                ++it, count - 1, [&](FwdIter const& curr) -> void {
+                    element_type curr_value = HPX_INVOKE(proj, *curr);
+                    if (HPX_INVOKE(f, curr_value, value))
+                    {
+                        smallest = curr;
+                        value = HPX_MOVE(curr_value);
+                    }
+                });
+
+            return smallest;
+        }
+    };
+
+    inline constexpr sequential_min_element_t sequential_min_element =
+        sequential_min_element_t{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // find the last largest element of [it, it + count)
+    struct sequential_max_element_t
+      : hpx::functional::detail::tag_fallback<sequential_max_element_t>
+    {
+    private:
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        friend constexpr FwdIter tag_fallback_invoke(sequential_max_element_t,
+            ExPolicy&&, FwdIter it, std::size_t count, F const& f,
+            Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            auto largest = it;
+
+            element_type value = HPX_INVOKE(proj, *largest);
+            util::loop_n<std::decay_t<ExPolicy>>(
+                ++it, count - 1, [&](FwdIter const& curr) -> void {
+                    element_type curr_value = HPX_INVOKE(proj, *curr);
+                    if (!HPX_INVOKE(f, curr_value, value))
+                    {
+                        largest = curr;
+                        value = HPX_MOVE(curr_value);
+                    }
+                });
+
+            return largest;
+        }
+    };
+
+    inline constexpr sequential_max_element_t sequential_max_element =
+        sequential_max_element_t{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // find the first smallest and the last largest element of [it, it + count)
+    struct sequential_minmax_element_t
+      : hpx::functional::detail::tag_fallback<sequential_minmax_element_t>
+    {
+    private:
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        friend constexpr util::min_max_result<FwdIter> tag_fallback_invoke(
+            sequential_minmax_element_t, ExPolicy&&, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj)
+        {
+            util::min_max_result<FwdIter> result = {it, it};
+
+            if (count == 0 || count == 1)
+                return result;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            element_type min_value = HPX_INVOKE(proj, *it);
+            element_type max_value = min_value;
+            util::loop_n<std::decay_t<ExPolicy>>(
+                ++it, count - 1, [&](FwdIter const& curr) -> void {
+                    element_type curr_value = HPX_INVOKE(proj, *curr);
+                    if (HPX_INVOKE(f, curr_value, min_value))
+                    {
+                        result.min = curr;
+                        min_value = curr_value;
+                    }
+
+                    if (!HPX_INVOKE(f, curr_value, max_value))
+                    {
+                        result.max = curr;
+                        max_value = HPX_MOVE(curr_value);
+                    }
+                });
+
+            return result;
+        }
+    };
+
+    inline constexpr sequential_minmax_element_t sequential_minmax_element =
+        sequential_minmax_element_t{};
+}    // namespace hpx::parallel::detail
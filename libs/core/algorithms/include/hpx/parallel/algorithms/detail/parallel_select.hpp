@@ -0,0 +1,287 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/parallel/util/low_level.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <new>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    // Ranges smaller than this are handed to std::nth_element
+    inline constexpr std::size_t parallel_select_limit = 65536ul;
+
+    // Upper limit for the number of samples drawn in each round
+    inline constexpr std::size_t parallel_select_max_samples = 16384ul;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Uninitialized storage used as the target of the partitioning step
+    template <typename T>
+    struct parallel_select_buffer
+    {
+        explicit parallel_select_buffer(std::size_t size)
+          : data(static_cast<T*>(std::malloc(sizeof(T) * size)))
+        {
+            if (data == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+        }
+
+        parallel_select_buffer(parallel_select_buffer const&) = delete;
+        parallel_select_buffer(parallel_select_buffer&&) = delete;
+        parallel_select_buffer& operator=(
+            parallel_select_buffer const&) = delete;
+        parallel_select_buffer& operator=(parallel_select_buffer&&) = delete;
+
+        ~parallel_select_buffer()
+        {
+            std::free(data);
+        }
+
+        T* data;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    ///
+    /// \brief : Rearranges the elements in [first, last) such that the
+    ///          element at nth is the one that would be there if the range
+    ///          was fully sorted, all elements before nth are not greater
+    ///          and all elements after nth are not less than that element.
+    ///
+    /// Value types that may throw while being moved are handed to
+    /// std::nth_element.
+    ///
+    /// Each round draws a random sample of the range and selects two pivots
+    /// from it that bracket the (scaled) position of nth. The elements are
+    /// then partitioned into three buckets (less than the lower pivot,
+    /// between the pivots, greater than the upper pivot) in parallel: each
+    /// chunk classifies and counts its elements, the counts are scanned to
+    /// obtain the target positions, and each chunk moves its elements to
+    /// their bucket. Only the bucket holding nth is processed further.
+    ///
+    /// \param policy : execution policy providing executor and parameters
+    /// \param first : iterator to the first element
+    /// \param nth : iterator defining the sort partition point
+    /// \param last : iterator to the element after the last in the range
+    /// \param comp : object for to Compare elements
+    ///
+    template <typename ExPolicy, typename Iter, typename Comp>
+    void parallel_select(
+        ExPolicy&& policy, Iter first, Iter nth, Iter last, Comp&& comp)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        HPX_ASSERT(first <= nth && nth <= last);
+
+        // the elements are moved into uninitialized storage and back, an
+        // exception thrown while doing so would leave the range (and the
+        // buffer) with partially moved elements
+        constexpr bool nothrow_move =
+            std::is_nothrow_move_constructible_v<value_type> &&
+            std::is_nothrow_move_assignable_v<value_type>;
+
+        std::size_t count = static_cast<std::size_t>(last - first);
+        if (!nothrow_move || count <= parallel_select_limit || nth == last)
+        {
+            std::nth_element(first, nth, last, comp);
+            return;
+        }
+
+        std::size_t const cores =
+            execution::processing_units_count(policy.parameters(),
+                policy.executor(), hpx::chrono::null_duration, count);
+
+        if (cores == 1)
+        {
+            std::nth_element(first, nth, last, comp);
+            return;
+        }
+
+        // the buffer is reused for all (shrinking) rounds
+        parallel_select_buffer<value_type> buffer(count);
+        std::vector<std::uint8_t> buckets(count);
+
+        std::minstd_rand gen(static_cast<std::uint32_t>(count));
+
+        // use a single pivot after a round that did not narrow the range
+        // sufficiently, this is caused by many equivalent elements
+        bool single_pivot = false;
+
+        while (count > parallel_select_limit)
+        {
+            // draw the sample and select the pivots
+            std::size_t const nsamples =
+                (std::min)(count / 64, parallel_select_max_samples);
+
+            std::vector<Iter> samples;
+            samples.reserve(nsamples);
+
+            std::uniform_int_distribution<std::size_t> dis(0, count - 1);
+            for (std::size_t i = 0; i != nsamples; ++i)
+            {
+                samples.push_back(first + dis(gen));
+            }
+
+            std::sort(samples.begin(), samples.end(), [&](Iter lhs, Iter rhs) {
+                return HPX_INVOKE(comp, *lhs, *rhs);
+            });
+
+            std::size_t const pos = static_cast<std::size_t>(
+                (static_cast<double>(nth - first) / count) * nsamples);
+            std::size_t const delta = single_pivot ?
+                0 :
+                static_cast<std::size_t>(2 * std::sqrt(nsamples));
+
+            Iter const lower = samples[pos > delta ? pos - delta : 0];
+            Iter const upper = samples[(std::min)(pos + delta, nsamples - 1)];
+
+            // the elements between equivalent pivots are equivalent as well
+            bool const equivalent_pivots = !HPX_INVOKE(comp, *lower, *upper);
+
+            // classify and count the elements of each chunk
+            std::size_t const nchunks = (std::min)(
+                cores * 4, (count + parallel_select_limit / 16 - 1) /
+                    (parallel_select_limit / 16));
+            std::size_t const chunk_size = (count + nchunks - 1) / nchunks;
+
+            auto const shape = hpx::util::iterator_range(
+                hpx::util::counting_iterator(static_cast<std::size_t>(0)),
+                hpx::util::counting_iterator(nchunks));
+
+            std::vector<std::array<std::size_t, 3>> counts(nchunks);
+
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t chunk) {
+                    std::size_t const begin =
+                        (std::min)(chunk * chunk_size, count);
+                    std::size_t const end =
+                        (std::min)(begin + chunk_size, count);
+
+                    std::array<std::size_t, 3> local = {};
+                    for (std::size_t i = begin; i != end; ++i)
+                    {
+                        Iter const it = first + i;
+                        std::uint8_t const bucket =
+                            HPX_INVOKE(comp, *it, *lower) ? 0 :
+                            HPX_INVOKE(comp, *upper, *it) ? 2 :
+                                                            1;
+                        buckets[i] = bucket;
+                        ++local[bucket];
+                    }
+                    counts[chunk] = local;
+                },
+                shape);
+
+            // calculate the target position of the first element of each
+            // chunk in each bucket
+            std::array<std::size_t, 3> totals = {};
+            for (auto& c : counts)
+            {
+                for (std::size_t b = 0; b != 3; ++b)
+                {
+                    std::size_t const n = c[b];
+                    c[b] = totals[b];
+                    totals[b] += n;
+                }
+            }
+
+            std::size_t const lower_end = totals[0];
+            std::size_t const upper_begin = totals[0] + totals[1];
+
+            for (auto& c : counts)
+            {
+                c[1] += lower_end;
+                c[2] += upper_begin;
+            }
+
+            // move the elements into the buffer, then back into the range
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t chunk) {
+                    std::size_t const begin =
+                        (std::min)(chunk * chunk_size, count);
+                    std::size_t const end =
+                        (std::min)(begin + chunk_size, count);
+
+                    std::array<std::size_t, 3>& offsets = counts[chunk];
+                    for (std::size_t i = begin; i != end; ++i)
+                    {
+                        util::construct_object(
+                            buffer.data + offsets[buckets[i]]++,
+                            HPX_MOVE(*(first + i)));
+                    }
+                },
+                shape);
+
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t chunk) {
+                    std::size_t const begin =
+                        (std::min)(chunk * chunk_size, count);
+                    std::size_t const end =
+                        (std::min)(begin + chunk_size, count);
+
+                    for (std::size_t i = begin; i != end; ++i)
+                    {
+                        *(first + i) = HPX_MOVE(buffer.data[i]);
+                        util::destroy_object(buffer.data + i);
+                    }
+                },
+                shape);
+
+            // continue with the bucket holding nth only
+            std::size_t const n = static_cast<std::size_t>(nth - first);
+            if (n < lower_end)
+            {
+                last = first + lower_end;
+            }
+            else if (n >= upper_begin)
+            {
+                first += upper_begin;
+            }
+            else
+            {
+                if (equivalent_pivots)
+                {
+                    return;
+                }
+                last = first + upper_begin;
+                first += lower_end;
+            }
+
+            std::size_t const new_count =
+                static_cast<std::size_t>(last - first);
+            single_pivot = new_count > count / 2;
+            count = new_count;
+        }
+
+        std::nth_element(first, nth, last, comp);
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -0,0 +1,133 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Write the inclusive scan of the 'count' elements starting at 'first' to
+    // 'dest', starting with 'init'. Return the combination of 'init' and all
+    // elements.
+    template <typename ExPolicy>
+    struct sequential_inclusive_scan_n_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_inclusive_scan_n_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename OutIter, typename T, typename Op>
+        friend constexpr T tag_fallback_invoke(
+            sequential_inclusive_scan_n_t<ExPolicy>, InIter first,
+            std::size_t count, OutIter dest, T init, Op&& op)
+        {
+            for (/* */; count-- != 0; (void) ++first, ++dest)
+            {
+                init = HPX_INVOKE(op, init, *first);
+                *dest = init;
+            }
+            return init;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_inclusive_scan_n_t<ExPolicy>
+        sequential_inclusive_scan_n = sequential_inclusive_scan_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIter, typename OutIter,
+        typename T, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE T sequential_inclusive_scan_n(
+        InIter first, std::size_t count, OutIter dest, T init, Op&& op)
+    {
+        return sequential_inclusive_scan_n_t<ExPolicy>{}(
+            first, count, dest, HPX_MOVE(init), HPX_FORWARD(Op, op));
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Write the exclusive scan of the 'count' elements starting at 'first' to
+    // 'dest', starting with 'init'. Return the combination of 'init' and all
+    // elements.
+    template <typename ExPolicy>
+    struct sequential_exclusive_scan_n_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_exclusive_scan_n_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename OutIter, typename T, typename Op>
+        friend constexpr T tag_fallback_invoke(
+            sequential_exclusive_scan_n_t<ExPolicy>, InIter first,
+            std::size_t count, OutIter dest, T init, Op&& op)
+        {
+            T temp = init;
+            for (/* */; count-- != 0; (void) ++first, ++dest)
+            {
+                init = HPX_INVOKE(op, init, *first);
+                *dest = temp;
+                temp = init;
+            }
+            return init;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_exclusive_scan_n_t<ExPolicy>
+        sequential_exclusive_scan_n = sequential_exclusive_scan_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIter, typename OutIter,
+        typename T, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE T sequential_exclusive_scan_n(
+        InIter first, std::size_t count, OutIter dest, T init, Op&& op)
+    {
+        return sequential_exclusive_scan_n_t<ExPolicy>{}(
+            first, count, dest, HPX_MOVE(init), HPX_FORWARD(Op, op));
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Combine 'val' with each of the 'count' elements starting at 'dest'. This
+    // is the final step of the parallel scans, which applies the result of the
+    // preceding partitions to the partial results of a partition.
+    template <typename ExPolicy>
+    struct sequential_scan_update_n_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_scan_update_n_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename T, typename Op>
+        friend constexpr void tag_fallback_invoke(
+            sequential_scan_update_n_t<ExPolicy>, Iter dest, std::size_t count,
+            T const& val, Op&& op)
+        {
+            for (/* */; count-- != 0; ++dest)
+            {
+                *dest = HPX_INVOKE(op, val, *dest);
+            }
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_scan_update_n_t<ExPolicy>
+        sequential_scan_update_n = sequential_scan_update_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename T, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void sequential_scan_update_n(
+        Iter dest, std::size_t count, T const& val, Op&& op)
+    {
+        return sequential_scan_update_n_t<ExPolicy>{}(
+            dest, count, val, HPX_FORWARD(Op, op));
+    }
+#endif
+}    // namespace hpx::parallel::detail
@@ -12,7 +12,9 @@
 #include <hpx/config.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/executors/execution_policy.hpp>
 #include <hpx/functional/detail/invoke.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/util/adapt_placement_mode.hpp>
@@ -31,6 +33,66 @@
 namespace hpx::parallel::detail {
     /// \cond NOINTERNAL
 
+    // Return whether the 'diff' elements starting at 'it' match the
+    // elements starting at 's_first'.
+    template <typename FwdIter, typename FwdIter2, typename Pred,
+        typename Proj1, typename Proj2>
+    constexpr bool search_matches(FwdIter it, FwdIter2 s_first,
+        std::size_t diff, Pred& op, Proj1& proj1, Proj2& proj2)
+    {
+        for (/**/; diff != 0; (void) --diff, ++it, ++s_first)
+        {
+            if (!HPX_INVOKE(
+                    op, HPX_INVOKE(proj1, *it), HPX_INVOKE(proj2, *s_first)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Return the offset of the first of the 'count' positions starting at
+    // 'first' at which the 'diff' elements starting at 's_first' are found,
+    // or 'count' if there is none. The searched sequence has to extend
+    // 'diff - 1' elements beyond the last position.
+    template <typename ExPolicy>
+    struct sequential_search_partition_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_search_partition_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename FwdIter2, typename Pred,
+            typename Proj1, typename Proj2>
+        friend constexpr std::size_t tag_fallback_invoke(
+            sequential_search_partition_t<ExPolicy>, FwdIter first,
+            std::size_t count, FwdIter2 s_first, std::size_t diff, Pred& op,
+            Proj1& proj1, Proj2& proj2)
+        {
+            for (std::size_t pos = 0; pos != count; (void) ++pos, ++first)
+            {
+                if (search_matches(first, s_first, diff, op, proj1, proj2))
+                    return pos;
+            }
+            return count;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_search_partition_t<ExPolicy>
+        sequential_search_partition = sequential_search_partition_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename FwdIter, typename FwdIter2,
+        typename Pred, typename Proj1, typename Proj2>
+    constexpr std::size_t sequential_search_partition(FwdIter first,
+        std::size_t count, FwdIter2 s_first, std::size_t diff, Pred& op,
+        Proj1& proj1, Proj2& proj2)
+    {
+        return sequential_search_partition_t<ExPolicy>{}(
+            first, count, s_first, diff, op, proj1, proj2);
+    }
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     // search
     template <typename FwdIter, typename Sent>
@@ -47,6 +109,29 @@ namespace hpx::parallel::detail {
             FwdIter2 s_first, Sent2 s_last, Pred&& op, Proj1&& proj1,
             Proj2&& proj2)
         {
+            if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+            {
+                auto const diff = static_cast<std::size_t>(
+                    hpx::parallel::detail::distance(s_first, s_last));
+                if (diff == 0)
+                    return first;
+
+                auto const count = static_cast<std::size_t>(
+                    hpx::parallel::detail::distance(first, last));
+                if (diff > count)
+                {
+                    std::advance(first, count);
+                    return first;
+                }
+
+                std::size_t const positions = count - (diff - 1);
+                std::size_t const pos = sequential_search_partition<ExPolicy>(
+                    first, positions, s_first, diff, op, proj1, proj2);
+
+                std::advance(first, pos == positions ? count : pos);
+                return first;
+            }
+
             for (;; ++first)
             {
                 FwdIter it1 = first;
@@ -116,36 +201,58 @@ namespace hpx::parallel::detail {
                           proj2 = HPX_FORWARD(Proj2, proj2)](FwdIter it,
                           std::size_t part_size,
                           std::size_t base_idx) mutable -> void {
-                FwdIter curr = it;
-
-                hpx::parallel::util::loop_idx_n<policy_type>(base_idx, it,
-                    part_size, tok,
-                    [diff, count, s_first, &tok, &curr,
-                        op = HPX_FORWARD(Pred, op),
-                        proj1 = HPX_FORWARD(Proj1, proj1),
-                        proj2 = HPX_FORWARD(Proj2, proj2)](
-                        reference v, std::size_t i) -> void {
-                        ++curr;
-                        if (HPX_INVOKE(op, HPX_INVOKE(proj1, v),
-                                HPX_INVOKE(proj2, *s_first)))
-                        {
-                            difference_type local_count = 1;
-                            FwdIter2 needle = s_first;
-                            FwdIter mid = curr;
-
-                            for (difference_type len = 0;
-                                 local_count != diff && len != count;
-                                 ++local_count, ++len, ++mid)
+                if constexpr (hpx::is_vectorpack_execution_policy_v<
+                                  policy_type>)
+                {
+                    if (tok.was_cancelled(static_cast<difference_type>(
+                            base_idx)))
+                    {
+                        return;
+                    }
+
+                    std::size_t const pos =
+                        sequential_search_partition<policy_type>(it,
+                            part_size, s_first, static_cast<std::size_t>(diff),
+                            op, proj1, proj2);
+                    if (pos != part_size)
+                    {
+                        tok.cancel(
+                            static_cast<difference_type>(base_idx + pos));
+                    }
+                }
+                else
+                {
+                    FwdIter curr = it;
+
+                    hpx::parallel::util::loop_idx_n<policy_type>(base_idx, it,
+                        part_size, tok,
+                        [diff, count, s_first, &tok, &curr,
+                            op = HPX_FORWARD(Pred, op),
+                            proj1 = HPX_FORWARD(Proj1, proj1),
+                            proj2 = HPX_FORWARD(Proj2, proj2)](
+                            reference v, std::size_t i) -> void {
+                            ++curr;
+                            if (HPX_INVOKE(op, HPX_INVOKE(proj1, v),
+                                    HPX_INVOKE(proj2, *s_first)))
                             {
-                                if (!HPX_INVOKE(op, HPX_INVOKE(proj1, *mid),
-                                        HPX_INVOKE(proj2, *++needle)))
-                                    break;
+                                difference_type local_count = 1;
+                                FwdIter2 needle = s_first;
+                                FwdIter mid = curr;
+
+                                for (difference_type len = 0;
+                                     local_count != diff && len != count;
+                                     ++local_count, ++len, ++mid)
+                                {
+                                    if (!HPX_INVOKE(op, HPX_INVOKE(proj1, *mid),
+                                            HPX_INVOKE(proj2, *++needle)))
+                                        break;
+                                }
+
+                                if (local_count == diff)
+                                    tok.cancel(i);
                             }
-
-                            if (local_count == diff)
-                                tok.cancel(i);
-                        }
-                    });
+                        });
+                }
             };
 
             auto f2 = [=](auto&& data) mutable -> FwdIter {
@@ -188,6 +295,21 @@ namespace hpx::parallel::detail {
             FwdIter2 s_first, FwdIter2 s_last, Pred&& op, Proj1&& proj1,
             Proj2&& proj2)
         {
+            if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+            {
+                auto const diff =
+                    static_cast<std::size_t>(std::distance(s_first, s_last));
+                if (diff == 0)
+                    return first;
+                if (diff > count)
+                    return std::next(first, count);
+
+                std::size_t const positions = count - (diff - 1);
+                std::size_t const pos = sequential_search_partition<ExPolicy>(
+                    first, positions, s_first, diff, op, proj1, proj2);
+                return std::next(first, pos == positions ? count : pos);
+            }
+
             return std::search(first, std::next(first, count), s_first, s_last,
                 util::compare_projected<Pred&, Proj1&, Proj2&>(
                     op, proj1, proj2));
@@ -230,35 +352,58 @@ namespace hpx::parallel::detail {
                           proj2 = HPX_FORWARD(Proj2, proj2)](FwdIter it,
                           std::size_t part_size,
                           std::size_t base_idx) mutable -> void {
-                FwdIter curr = it;
-
-                util::loop_idx_n<policy_type>(base_idx, it, part_size, tok,
-                    [count, diff, s_first, &tok, &curr,
-                        op = HPX_FORWARD(Pred, op),
-                        proj1 = HPX_FORWARD(Proj1, proj1),
-                        proj2 = HPX_FORWARD(Proj2, proj2)](
-                        reference v, std::size_t i) -> void {
-                        ++curr;
-                        if (HPX_INVOKE(op, HPX_INVOKE(proj1, v),
-                                HPX_INVOKE(proj2, *s_first)))
-                        {
-                            difference_type local_count = 1;
-                            FwdIter2 needle = s_first;
-                            FwdIter mid = curr;
-
-                            for (difference_type len = 0; local_count != diff &&
-                                 len != difference_type(count);
-                                 ++local_count, ++len, ++mid)
+                if constexpr (hpx::is_vectorpack_execution_policy_v<
+                                  policy_type>)
+                {
+                    if (tok.was_cancelled(static_cast<difference_type>(
+                            base_idx)))
+                    {
+                        return;
+                    }
+
+                    std::size_t const pos =
+                        sequential_search_partition<policy_type>(it,
+                            part_size, s_first, static_cast<std::size_t>(diff),
+                            op, proj1, proj2);
+                    if (pos != part_size)
+                    {
+                        tok.cancel(
+                            static_cast<difference_type>(base_idx + pos));
+                    }
+                }
+                else
+                {
+                    FwdIter curr = it;
+
+                    util::loop_idx_n<policy_type>(base_idx, it, part_size, tok,
+                        [count, diff, s_first, &tok, &curr,
+                            op = HPX_FORWARD(Pred, op),
+                            proj1 = HPX_FORWARD(Proj1, proj1),
+                            proj2 = HPX_FORWARD(Proj2, proj2)](
+                            reference v, std::size_t i) -> void {
+                            ++curr;
+                            if (HPX_INVOKE(op, HPX_INVOKE(proj1, v),
+                                    HPX_INVOKE(proj2, *s_first)))
                             {
-                                if (!HPX_INVOKE(op, HPX_INVOKE(proj1, *mid),
-                                        HPX_INVOKE(proj2, *++needle)))
-                                    break;
+                                difference_type local_count = 1;
+                                FwdIter2 needle = s_first;
+                                FwdIter mid = curr;
+
+                                for (difference_type len = 0;
+                                     local_count != diff &&
+                                     len != difference_type(count);
+                                     ++local_count, ++len, ++mid)
+                                {
+                                    if (!HPX_INVOKE(op, HPX_INVOKE(proj1, *mid),
+                                            HPX_INVOKE(proj2, *++needle)))
+                                        break;
+                                }
+
+                                if (local_count == diff)
+                                    tok.cancel(i);
                             }
-
-                            if (local_count == diff)
-                                tok.cancel(i);
-                        }
-                    });
+                        });
+                }
             };
 
             auto f2 = [=](auto&& data) mutable -> FwdIter {
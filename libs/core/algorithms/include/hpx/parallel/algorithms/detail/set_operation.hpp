@@ -15,9 +15,8 @@
 #include <hpx/parallel/algorithms/detail/upper_lower_bound.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
-#include <hpx/parallel/util/foreach_partitioner.hpp>
-#include <hpx/parallel/util/partitioner.hpp>
-#include <hpx/type_support/unused.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+#include <hpx/parallel/util/scan_partitioner.hpp>
 
 #if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
 #include <boost/shared_array.hpp>
@@ -27,258 +26,263 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
+#include <iterator>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx::parallel::detail {
     /// \cond NOINTERNAL
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename FwdIter>
-    struct set_operations_buffer
+    // Output iterator discarding all values assigned through it while
+    // counting them. This is used to calculate the number of elements a set
+    // operation produces for a chunk before writing the elements.
+    struct set_counting_iterator
     {
-        template <typename T>
-        class rewritable_ref
-        {
-        public:
-            rewritable_ref() = default;
-
-            explicit constexpr rewritable_ref(T const& item) noexcept
-              : item_(&item)
-            {
-            }
+        using iterator_category = std::output_iterator_tag;
+        using value_type = void;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = void;
 
-            rewritable_ref& operator=(T const& item)
+        struct proxy
+        {
+            template <typename T>
+            constexpr proxy& operator=(T const&) noexcept
             {
-                item_ = &item;
                 return *this;
             }
+        };
 
-            // different versions of clang-format produce different results
-            // clang-format off
-            operator T const&() const
-            {
-                HPX_ASSERT(item_ != nullptr);
-                return *item_;
-            }
-            // clang-format on
+        constexpr proxy operator*() const noexcept
+        {
+            return proxy{};
+        }
 
-        private:
-            T const* item_ = nullptr;
-        };
+        constexpr set_counting_iterator& operator++() noexcept
+        {
+            ++count;
+            return *this;
+        }
 
-        using value_type = typename std::iterator_traits<FwdIter>::value_type;
-        using type = std::conditional_t<std::is_scalar_v<value_type>,
-            value_type, rewritable_ref<value_type>>;
+        constexpr set_counting_iterator operator++(int) noexcept
+        {
+            set_counting_iterator tmp = *this;
+            ++count;
+            return tmp;
+        }
+
+        std::size_t count = 0;
     };
 
+    // The part of both input sequences handled by one chunk, all values are
+    // offsets relative to the beginning of the corresponding sequence.
     struct set_chunk_data
     {
-        static constexpr std::size_t uninit_start =
-            static_cast<std::size_t>(-1);
-        static constexpr std::size_t uninit_len = static_cast<std::size_t>(0);
-        static constexpr std::size_t uninit_start_index =
-            static_cast<std::size_t>(-1);
-        static constexpr std::size_t uninit_first1 =
-            static_cast<std::size_t>(-1);
-        static constexpr std::size_t uninit_first2 =
-            static_cast<std::size_t>(-1);
-
-        std::size_t start = uninit_start;
-        std::size_t len = uninit_len;
-        std::size_t start_index = uninit_start_index;
-        std::size_t first1 = uninit_first1;
-        std::size_t first2 = uninit_first2;
+        std::size_t start1 = 0;
+        std::size_t end1 = 0;
+        std::size_t start2 = 0;
+        std::size_t end2 = 0;
+
+        // positions in the input sequences the set operation stopped at
+        std::size_t last1 = 0;
+        std::size_t last2 = 0;
     };
 
     ///////////////////////////////////////////////////////////////////////////
+    // Find the split of the merged input sequences at position diag using a
+    // binary search along the cross diagonal of the merge matrix (merge
+    // path). The split is then moved backwards to the beginning of the run of
+    // elements equivalent to the first element of the second part in both
+    // sequences, as equivalent elements have to be handled by the same chunk.
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2>
+    std::pair<std::size_t, std::size_t> set_operation_split(Iter1 first1,
+        std::size_t len1, Iter2 first2, std::size_t len2, std::size_t diag,
+        F& f, Proj1& proj1, Proj2& proj2)
+    {
+        std::size_t low = diag > len2 ? diag - len2 : 0;
+        std::size_t high = (std::min)(diag, len1);
+
+        // find the number of elements taken from the first sequence, for
+        // equivalent elements the ones from the first sequence go first
+        while (low < high)
+        {
+            std::size_t const mid = low + (high - low) / 2;
+            if (!HPX_INVOKE(f, HPX_INVOKE(proj2, *(first2 + (diag - mid - 1))),
+                    HPX_INVOKE(proj1, *(first1 + mid))))
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+
+        std::size_t const split1 = low;
+        std::size_t const split2 = diag - low;
+
+        // move both positions to the first element that is equivalent to the
+        // first element of the second part
+        if (split1 != len1 &&
+            (split2 == len2 ||
+                !HPX_INVOKE(f, HPX_INVOKE(proj2, *(first2 + split2)),
+                    HPX_INVOKE(proj1, *(first1 + split1)))))
+        {
+            auto&& value = HPX_INVOKE(proj1, *(first1 + split1));
+            return {static_cast<std::size_t>(
+                        detail::lower_bound(
+                            first1, first1 + split1, value, f, proj1) -
+                        first1),
+                static_cast<std::size_t>(
+                    detail::lower_bound(
+                        first2, first2 + split2, value, f, proj2) -
+                    first2)};
+        }
+
+        if (split2 != len2)
+        {
+            auto&& value = HPX_INVOKE(proj2, *(first2 + split2));
+            return {static_cast<std::size_t>(
+                        detail::lower_bound(
+                            first1, first1 + split1, value, f, proj1) -
+                        first1),
+                static_cast<std::size_t>(
+                    detail::lower_bound(
+                        first2, first2 + split2, value, f, proj2) -
+                    first2)};
+        }
+
+        return {split1, split2};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Perform a set operation in parallel. The input sequences are split into
+    // chunks of balanced size using merge path partitioning. The first pass
+    // runs the set operation on each chunk only counting the produced
+    // elements, which gives the exact output position of each chunk after
+    // an exclusive scan. The second pass runs the set operation again writing
+    // the elements directly to their final position.
     template <typename ExPolicy, typename Iter1, typename Sent1, typename Iter2,
         typename Sent2, typename Iter3, typename F, typename Proj1,
-        typename Proj2, typename Combiner, typename SetOp>
+        typename Proj2, typename SetOp>
     util::detail::algorithm_result_t<ExPolicy,
         util::in_in_out_result<Iter1, Iter2, Iter3>>
     set_operation(ExPolicy&& policy, Iter1 first1, Sent1 last1, Iter2 first2,
         Sent2 last2, Iter3 dest, F&& f, Proj1&& proj1, Proj2&& proj2,
-        Combiner&& combiner, SetOp&& setop)
+        SetOp&& setop)
     {
         using result_type = util::in_in_out_result<Iter1, Iter2, Iter3>;
 
-        using difference_type1 =
-            typename std::iterator_traits<Iter1>::difference_type;
-        using difference_type2 =
-            typename std::iterator_traits<Iter2>::difference_type;
-
-        // allocate intermediate buffers
-        difference_type1 len1 = detail::distance(first1, last1);
-        difference_type2 len2 = detail::distance(first2, last2);
+        std::size_t const len1 =
+            static_cast<std::size_t>(detail::distance(first1, last1));
+        std::size_t const len2 =
+            static_cast<std::size_t>(detail::distance(first2, last2));
 
-        using buffer_type = typename set_operations_buffer<Iter3>::type;
-
-        std::size_t cores = execution::processing_units_count(
+        std::size_t const cores = execution::processing_units_count(
             policy.parameters(), policy.executor(), hpx::chrono::null_duration,
-            (std::min)(len1, len2));
+            len1 + len2);
 
-        std::size_t const step = (len1 + cores - 1) / cores;
+        std::size_t const nchunks = (std::min)(cores, len1 + len2);
 
 #if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-        std::shared_ptr<buffer_type[]> buffer(
-            new buffer_type[combiner(len1, len2)]);
-        std::shared_ptr<set_chunk_data[]> chunks(new set_chunk_data[cores]);
+        std::shared_ptr<set_chunk_data[]> chunks(new set_chunk_data[nchunks]);
 #else
-        boost::shared_array<buffer_type> buffer(
-            new buffer_type[combiner(len1, len2)]);
-        boost::shared_array<set_chunk_data> chunks(new set_chunk_data[cores]);
+        boost::shared_array<set_chunk_data> chunks(
+            new set_chunk_data[nchunks]);
 #endif
 
-        // first step, is applied to all partitions
-        auto f1 = [=](set_chunk_data* curr_chunk,
-                      std::size_t const part_size) mutable -> void {
-            HPX_ASSERT(part_size == 1);
-            HPX_UNUSED(part_size);
-
-            // find start in sequence 1
-            std::size_t start1 = (curr_chunk - chunks.get()) * step;
-            std::size_t end1 =
-                (std::min)(start1 + step, static_cast<std::size_t>(len1));
-
-            if (start1 >= end1)
-            {
-                return;
-            }
-
-            bool const first_partition = start1 == 0;
-            bool const last_partition = end1 == static_cast<std::size_t>(len1);
-
-            auto start_value = HPX_INVOKE(proj1, first1[start1]);
-            auto end_value = HPX_INVOKE(proj1, first1[end1]);
-
-            // all but the last chunk require special handling
-            if (!last_partition)
+        // calculate the boundaries of all chunks
+        std::size_t const total = len1 + len2;
+        std::pair<std::size_t, std::size_t> start(0, 0);
+        for (std::size_t i = 0; i != nchunks; ++i)
+        {
+            std::pair<std::size_t, std::size_t> end(len1, len2);
+            if (i != nchunks - 1)
             {
-                // this chunk will be handled by the next one if all elements of
-                // this partition are equal
-                if (!HPX_INVOKE(f, start_value, end_value))
-                {
-                    return;
-                }
-
-                // move backwards to find earliest element which is equal to the
-                // last element of the current chunk
-                if (end1 != 0)
-                {
-                    auto end_value1 = HPX_INVOKE(proj1, first1[end1 - 1]);
-
-                    while (!HPX_INVOKE(f, end_value1, end_value) && --end1 != 0)
-                    {
-                        end_value = HPX_MOVE(end_value1);
-                        end_value1 = HPX_INVOKE(proj1, first1[end1 - 1]);
-                    }
-                }
+                end = set_operation_split(first1, len1, first2, len2,
+                    (i + 1) * (total / nchunks), f, proj1, proj2);
             }
 
-            // move backwards to find earliest element which is equal to the
-            // first element of the current chunk
-            if (start1 != 0)
+            set_chunk_data& chunk = chunks[i];
+            chunk.start1 = start.first;
+            chunk.end1 = (std::max)(start.first, end.first);
+            chunk.start2 = start.second;
+            chunk.end2 = (std::max)(start.second, end.second);
+            chunk.last1 = chunk.end1;
+            chunk.last2 = chunk.end2;
+
+            start = std::make_pair(chunk.end1, chunk.end2);
+        }
+
+        // first step, count the number of elements produced for each chunk
+        auto f1 = [first1, first2, f, setop](set_chunk_data* part_begin,
+                      std::size_t part_size) mutable -> std::size_t {
+            std::size_t count = 0;
+            for (/**/; part_size != 0; --part_size, ++part_begin)
             {
-                auto start_value1 = HPX_INVOKE(proj1, first1[start1 - 1]);
-
-                while (
-                    !HPX_INVOKE(f, start_value1, start_value) && --start1 != 0)
-                {
-                    start_value = HPX_MOVE(start_value1);
-                    start_value1 = HPX_INVOKE(proj1, first1[start1 - 1]);
-                }
+                set_chunk_data const& chunk = *part_begin;
+                count += setop(first1 + chunk.start1, first1 + chunk.end1,
+                    first2 + chunk.start2, first2 + chunk.end2,
+                    set_counting_iterator{}, f)
+                             .out.count;
             }
+            return count;
+        };
 
-            // find start and end in sequence 2
-            std::size_t start2 = 0;
-            if (!first_partition)
+        // third step, perform the set operation writing the results to the
+        // destination
+        auto f3 = [first1, first2, dest, f, setop](set_chunk_data* part_begin,
+                      std::size_t part_size, std::size_t offset) mutable {
+            Iter3 out = std::next(dest, offset);
+            for (/**/; part_size != 0; --part_size, ++part_begin)
             {
-                start2 = detail::lower_bound(
-                             first2, first2 + len2, start_value, f, proj2) -
-                    first2;
-            }
+                set_chunk_data& chunk = *part_begin;
+                auto result = setop(first1 + chunk.start1, first1 + chunk.end1,
+                    first2 + chunk.start2, first2 + chunk.end2, out, f);
 
-            std::size_t end2 = len2;
-            if (!last_partition)
-            {
-                end2 = detail::lower_bound(first2 + start2, first2 + len2,
-                           end_value, f, proj2) -
-                    first2;
+                chunk.last1 = result.in1 - first1;
+                chunk.last2 = result.in2 - first2;
+                out = result.out;
             }
-
-            // perform requested set-operation into the proper place of the
-            // intermediate buffer
-            curr_chunk->start = combiner(start1, start2);
-            auto buffer_dest = buffer.get() + curr_chunk->start;
-            auto op_result = setop(first1 + start1, first1 + end1,
-                first2 + start2, first2 + end2, buffer_dest, f);
-            curr_chunk->first1 = op_result.in1 - first1;
-            curr_chunk->first2 = op_result.in2 - first2;
-            curr_chunk->len = op_result.out - buffer_dest;
         };
 
-        // second step, is executed after all partitions are done running
-
-        // different versions of clang-format produce different formatting
-        // clang-format off
-        auto f2 = [buffer, chunks, cores, first1, first2, dest](
-                      auto&& data) -> result_type {
-            // clang-format on
-
+        // fourth step, determine the final positions in the sequences
+        auto f4 = [chunks, nchunks, first1, first2, dest](
+                      std::vector<std::size_t>&& items,
+                      std::vector<hpx::future<void>>&& data) -> result_type {
             // make sure iterators embedded in function object that is attached
             // to futures are invalidated
             util::detail::clear_container(data);
 
-            // accumulate real length and rightmost positions in input sequences
-            std::size_t first1_pos = 0;
-            std::size_t first2_pos = 0;
-
-            set_chunk_data* chunk = chunks.get();
-            chunk->start_index = 0;
-            for (size_t i = 1; i != cores; ++i)
+            std::size_t last1 = 0;
+            std::size_t last2 = 0;
+            for (std::size_t i = 0; i != nchunks; ++i)
             {
-                set_chunk_data const* curr_chunk = chunk++;
-                chunk->start_index = curr_chunk->start_index + curr_chunk->len;
-                if (curr_chunk->first1 != static_cast<std::size_t>(-1))
-                {
-                    first1_pos = (std::max)(first1_pos, curr_chunk->first1);
-                }
-                if (curr_chunk->first2 != static_cast<std::size_t>(-1))
-                {
-                    first2_pos = (std::max)(first2_pos, curr_chunk->first2);
-                }
+                last1 = (std::max)(last1, chunks[i].last1);
+                last2 = (std::max)(last2, chunks[i].last2);
             }
 
-            // finally, copy data to destination
-            parallel::util::
-                foreach_partitioner<hpx::execution::parallel_policy>::call(
-                    hpx::execution::par, chunks.get(), cores,
-                    [buffer, dest](
-                        set_chunk_data* ch, std::size_t, std::size_t) {
-                        if (ch->start == set_chunk_data::uninit_start ||
-                            ch->start_index ==
-                                set_chunk_data::uninit_start_index ||
-                            ch->len == set_chunk_data::uninit_len)
-                        {
-                            return;
-                        }
-                        std::copy(buffer.get() + ch->start,
-                            buffer.get() + ch->start + ch->len,
-                            dest + ch->start_index);
-                    },
-                    [](set_chunk_data* last) -> set_chunk_data* {
-                        return last;
-                    });
-
-            return {std::next(first1, first1_pos),
-                std::next(first2, first2_pos),
-                std::next(dest, chunk->start_index + chunk->len)};
+            return {std::next(first1, last1), std::next(first2, last2),
+                std::next(dest, items.back())};
         };
 
-        // fill the buffer piecewise
-        return parallel::util::partitioner<ExPolicy, result_type, void>::call(
-            policy, chunks.get(), cores, HPX_MOVE(f1), HPX_MOVE(f2));
+        using partitioner_type = util::scan_partitioner<ExPolicy, result_type,
+            std::size_t, void>;
+
+        return partitioner_type::call(HPX_FORWARD(ExPolicy, policy),
+            chunks.get(), nchunks, std::size_t(0),
+            // step 1 counts the elements produced by each chunk
+            HPX_MOVE(f1),
+            // step 2 propagates the partition results from left to right
+            std::plus<std::size_t>(),
+            // step 3 writes the elements of each chunk
+            HPX_MOVE(f3),
+            // step 4 use this return value
+            HPX_MOVE(f4));
     }
 
     /// \endcond
@@ -0,0 +1,77 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Copy those of the 'count' (non-zero) elements starting at 'first' to
+    // 'dest' which are not equivalent to the element preceding them, the
+    // first element is always copied. Return the iterator referring to the
+    // element past the last element written. The destination may be the same
+    // as the input sequence (as used by unique).
+    //
+    // 'pred' is required to be an equivalence relation, comparing each element
+    // to its predecessor is therefore the same as comparing it to the last
+    // element copied. The elements are held by value, i.e. this is used for
+    // arithmetic value types only.
+    template <typename ExPolicy>
+    struct sequential_unique_copy_n_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_unique_copy_n_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename OutIter, typename Pred,
+            typename Proj>
+        friend constexpr OutIter tag_fallback_invoke(
+            sequential_unique_copy_n_t<ExPolicy>, InIter first,
+            std::size_t count, OutIter dest, Pred&& pred, Proj&& proj)
+        {
+            using value_type =
+                typename std::iterator_traits<InIter>::value_type;
+
+            value_type prev = *first;
+            *dest++ = prev;
+
+            while (--count != 0)
+            {
+                value_type const value = *++first;
+                if (!HPX_INVOKE(
+                        pred, HPX_INVOKE(proj, prev), HPX_INVOKE(proj, value)))
+                {
+                    *dest++ = value;
+                }
+                prev = value;
+            }
+            return dest;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_unique_copy_n_t<ExPolicy>
+        sequential_unique_copy_n = sequential_unique_copy_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIter, typename OutIter,
+        typename Pred, typename Proj>
+    HPX_HOST_DEVICE HPX_FORCEINLINE OutIter sequential_unique_copy_n(
+        InIter first, std::size_t count, OutIter dest, Pred&& pred,
+        Proj&& proj)
+    {
+        return sequential_unique_copy_n_t<ExPolicy>{}(first, count, dest,
+            HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+    }
+#endif
+}    // namespace hpx::parallel::detail
@@ -296,6 +296,7 @@ namespace hpx {
 #include <hpx/iterator_support/zip_iterator.hpp>
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/scan.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
@@ -337,20 +338,6 @@ namespace hpx::parallel {
             return util::in_out_result<InIter, OutIter>{first, dest};
         }
 
-        template <typename InIter, typename OutIter, typename T, typename Op>
-        static constexpr T sequential_exclusive_scan_n(
-            InIter first, std::size_t count, OutIter dest, T init, Op&& op)
-        {
-            T temp = init;
-            for (/* */; count-- != 0; (void) ++first, ++dest)
-            {
-                init = HPX_INVOKE(op, init, *first);
-                *dest = temp;
-                temp = init;
-            }
-            return init;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         template <typename IterPair>
         struct exclusive_scan
@@ -367,8 +354,24 @@ namespace hpx::parallel {
                 ExPolicy, InIter first, Sent last, OutIter dest, T const& init,
                 Op&& op)
             {
-                return sequential_exclusive_scan(
-                    first, last, dest, init, HPX_FORWARD(Op, op));
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+                {
+                    InIter last_iter = first;
+                    auto const count = static_cast<std::size_t>(
+                        detail::advance_and_get_distance(last_iter, last));
+
+                    sequential_exclusive_scan_n<ExPolicy>(
+                        first, count, dest, init, HPX_FORWARD(Op, op));
+
+                    std::advance(dest, count);
+                    return util::in_out_result<InIter, OutIter>{
+                        last_iter, dest};
+                }
+                else
+                {
+                    return sequential_exclusive_scan(
+                        first, last, dest, init, HPX_FORWARD(Op, op));
+                }
             }
 
             template <typename ExPolicy, typename FwdIter1, typename Sent,
@@ -407,12 +410,8 @@ namespace hpx::parallel {
                               T val) mutable -> void {
                     FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
                     *dst++ = val;
-
-                    // MSVC 2015 fails if op is captured by reference
-                    util::loop_n<std::decay_t<ExPolicy>>(dst, part_size - 1,
-                        [=, &val](FwdIter2 it) mutable -> void {
-                            *it = HPX_INVOKE(op, val, *it);
-                        });
+                    sequential_scan_update_n<std::decay_t<ExPolicy>>(
+                        dst, part_size - 1, val, op);
                 };
 
                 return util::scan_partitioner<ExPolicy,
@@ -428,9 +427,10 @@ namespace hpx::parallel {
                             auto iters = part_begin.get_iterator_tuple();
                             if (get<0>(iters) != last)
                             {
-                                return sequential_exclusive_scan_n(
-                                    get<0>(iters), part_size - 1, get<1>(iters),
-                                    part_init, op);
+                                return sequential_exclusive_scan_n<
+                                    std::decay_t<ExPolicy>>(get<0>(iters),
+                                    part_size - 1, get<1>(iters), part_init,
+                                    op);
                             }
                             return part_init;
                         },
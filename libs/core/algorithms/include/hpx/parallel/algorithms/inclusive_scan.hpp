@@ -431,6 +431,7 @@ namespace hpx {
 #include <hpx/iterator_support/zip_iterator.hpp>
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/scan.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
@@ -484,18 +485,6 @@ namespace hpx::parallel {
             return util::in_out_result<InIter, OutIter>{first, dest};
         }
 
-        template <typename InIter, typename OutIter, typename T, typename Op>
-        static constexpr T sequential_inclusive_scan_n(
-            InIter first, std::size_t count, OutIter dest, T init, Op&& op)
-        {
-            for (/* */; count-- != 0; (void) ++first, ++dest)
-            {
-                init = HPX_INVOKE(op, init, *first);
-                *dest = init;
-            }
-            return init;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         template <typename IterPair>
         struct inclusive_scan
@@ -512,17 +501,47 @@ namespace hpx::parallel {
                 ExPolicy, InIter first, Sent last, OutIter dest, T const& init,
                 Op&& op)
             {
-                return sequential_inclusive_scan(
-                    first, last, dest, init, HPX_FORWARD(Op, op));
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+                {
+                    InIter last_iter = first;
+                    auto const count = static_cast<std::size_t>(
+                        detail::advance_and_get_distance(last_iter, last));
+
+                    sequential_inclusive_scan_n<ExPolicy>(
+                        first, count, dest, init, HPX_FORWARD(Op, op));
+
+                    std::advance(dest, count);
+                    return util::in_out_result<InIter, OutIter>{
+                        last_iter, dest};
+                }
+                else
+                {
+                    return sequential_inclusive_scan(
+                        first, last, dest, init, HPX_FORWARD(Op, op));
+                }
             }
 
             template <typename ExPolicy, typename InIter, typename Sent,
                 typename OutIter, typename Op>
             static constexpr util::in_out_result<InIter, OutIter> sequential(
-                ExPolicy, InIter first, Sent last, OutIter dest, Op&& op)
+                ExPolicy policy, InIter first, Sent last, OutIter dest, Op&& op)
             {
-                return sequential_inclusive_scan_noinit(
-                    first, last, dest, HPX_FORWARD(Op, op));
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+                {
+                    if (first != last)
+                    {
+                        auto init = *first;
+                        *dest++ = init;
+                        return sequential(
+                            policy, ++first, last, dest, init, op);
+                    }
+                    return util::in_out_result<InIter, OutIter>{first, dest};
+                }
+                else
+                {
+                    return sequential_inclusive_scan_noinit(
+                        first, last, dest, HPX_FORWARD(Op, op));
+                }
             }
 
             template <typename ExPolicy, typename FwdIter1, typename Sent,
@@ -563,12 +582,8 @@ namespace hpx::parallel {
                 auto f3 = [op](zip_iterator part_begin, std::size_t part_size,
                               T val) mutable -> void {
                     FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
-
-                    // MSVC 2015 fails if op is captured by reference
-                    util::loop_n<std::decay_t<ExPolicy>>(
-                        dst, part_size, [=, &val](FwdIter2 it) mutable -> void {
-                            *it = HPX_INVOKE(op, val, *it);
-                        });
+                    sequential_scan_update_n<std::decay_t<ExPolicy>>(
+                        dst, part_size, val, op);
                 };
 
                 return util::scan_partitioner<ExPolicy,
@@ -585,9 +600,10 @@ namespace hpx::parallel {
                             auto iters = part_begin.get_iterator_tuple();
                             if (get<0>(iters) != last)
                             {
-                                return sequential_inclusive_scan_n(
-                                    get<0>(iters), part_size - 1, get<1>(iters),
-                                    part_init, op);
+                                return sequential_inclusive_scan_n<
+                                    std::decay_t<ExPolicy>>(get<0>(iters),
+                                    part_size - 1, get<1>(iters), part_init,
+                                    op);
                             }
                             return part_init;
                         },
@@ -167,6 +167,7 @@ namespace hpx {
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/mismatch.hpp>
 #include <hpx/parallel/algorithms/mismatch.hpp>
 #include <hpx/parallel/util/cancellation_token.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -204,21 +205,23 @@ namespace hpx::parallel {
                 Sent1 last1, InIter2 first2, Sent2 last2, Pred&& pred,
                 Proj1&& proj1, Proj2&& proj2)
             {
-                for (; first1 != last1 && first2 != last2;
-                     (void) ++first1, ++first2)
+                // find the first position where the elements are not
+                // equivalent, this is vectorized for vector-pack policies
+                auto const result =
+                    sequential_mismatch_binary<std::decay_t<ExPolicy>>(first1,
+                        last1, first2, last2,
+                        [&pred](auto const& v1, auto const& v2) {
+                            return !HPX_INVOKE(pred, v1, v2) &&
+                                !HPX_INVOKE(pred, v2, v1);
+                        },
+                        proj1, proj2);
+
+                if (result.in1 != last1 && result.in2 != last2)
                 {
-                    if (HPX_INVOKE(pred, HPX_INVOKE(proj1, *first1),
-                            HPX_INVOKE(proj2, *first2)))
-                    {
-                        return true;
-                    }
-                    if (HPX_INVOKE(pred, HPX_INVOKE(proj2, *first2),
-                            HPX_INVOKE(proj1, *first1)))
-                    {
-                        return false;
-                    }
+                    return HPX_INVOKE(pred, HPX_INVOKE(proj1, *result.in1),
+                        HPX_INVOKE(proj2, *result.in2));
                 }
-                return first1 == last1 && first2 != last2;
+                return result.in1 == last1 && result.in2 != last2;
             }
 
             template <typename ExPolicy, typename FwdIter1, typename Sent1,
@@ -231,7 +234,6 @@ namespace hpx::parallel {
             {
                 using zip_iterator =
                     hpx::util::zip_iterator<FwdIter1, FwdIter2>;
-                using reference = typename zip_iterator::reference;
 
                 std::size_t const count1 = detail::distance(first1, last1);
                 std::size_t const count2 = detail::distance(first2, last2);
@@ -262,20 +264,14 @@ namespace hpx::parallel {
                 auto f1 = [tok, pred, proj1, proj2](zip_iterator it,
                               std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n<policy_type>(base_idx, it, part_count, tok,
-                        [&pred, &tok, &proj1, &proj2](
-                            reference t, std::size_t i) mutable -> void {
-                            using hpx::get;
-                            using hpx::invoke;
-                            // gcc10/cuda11 complains about using HPX_INVOKE here
-                            if (invoke(pred, invoke(proj1, get<0>(t)),
-                                    invoke(proj2, get<1>(t))) ||
-                                invoke(pred, invoke(proj2, get<1>(t)),
-                                    invoke(proj1, get<0>(t))))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    sequential_mismatch_binary<policy_type>(base_idx, it,
+                        part_count, tok,
+                        [&pred](auto const& v1, auto const& v2) {
+                            // gcc10/cuda11 complains about using HPX_INVOKE
+                            return !hpx::invoke(pred, v1, v2) &&
+                                !hpx::invoke(pred, v2, v1);
+                        },
+                        proj1, proj2);
                 };
 
                 auto f2 = [tok, first1, first2, last1, last2, pred, proj1,
@@ -372,6 +372,7 @@ namespace hpx {
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 #include <hpx/parallel/util/loop.hpp>
@@ -394,32 +395,12 @@ namespace hpx::parallel {
     // min_element
     namespace detail {
         /// \cond NOINTERNAL
-        template <typename ExPolicy, typename FwdIter, typename F,
-            typename Proj>
-        constexpr FwdIter sequential_min_element(ExPolicy&&, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
-        {
-            if (count == 0 || count == 1)
-                return it;
-
-            using element_type = hpx::traits::proxy_value_t<
-                typename std::iterator_traits<FwdIter>::value_type>;
-
-            auto smallest = it;
-
-            element_type value = HPX_INVOKE(proj, *smallest);
-            util::loop_n<std::decay_t<ExPolicy>>(
-                ++it, count - 1, [&](FwdIter const& curr) -> void {
-                    element_type curr_value = HPX_INVOKE(proj, *curr);
-                    if (HPX_INVOKE(f, curr_value, value))
-                    {
-                        smallest = curr;
-                        value = HPX_MOVE(curr_value);
-                    }
-                });
-
-            return smallest;
-        }
+        // the reductions of the partition results operate on iterators, even
+        // for vector-pack execution policies
+        template <typename ExPolicy>
+        using minmax_loop_policy_t =
+            std::conditional_t<hpx::is_vectorpack_execution_policy_v<ExPolicy>,
+                hpx::execution::sequenced_policy, std::decay_t<ExPolicy>>;
 
         ///////////////////////////////////////////////////////////////////////
         template <typename Iter>
@@ -446,7 +427,7 @@ namespace hpx::parallel {
                         decltype(smallest)>::value_type>;
 
                 element_type value = HPX_INVOKE(proj, *smallest);
-                util::loop_n<std::decay_t<ExPolicy>>(
+                util::loop_n<minmax_loop_policy_t<ExPolicy>>(
                     ++it, count - 1, [&](FwdIter const& curr) -> void {
                         element_type curr_value = HPX_INVOKE(proj, **curr);
                         if (HPX_INVOKE(f, curr_value, value))
@@ -469,26 +450,35 @@ namespace hpx::parallel {
             static constexpr FwdIter sequential(
                 ExPolicy&& policy, FwdIter first, Sent last, F&& f, Proj&& proj)
             {
-                if (first == last)
-                    return first;
-
-                using element_type = hpx::traits::proxy_value_t<
-                    typename std::iterator_traits<FwdIter>::value_type>;
-
-                auto smallest = first;
-
-                element_type value = HPX_INVOKE(proj, *smallest);
-                util::loop(HPX_FORWARD(ExPolicy, policy), ++first, last,
-                    [&](FwdIter const& curr) -> void {
-                        element_type curr_value = HPX_INVOKE(proj, *curr);
-                        if (HPX_INVOKE(f, curr_value, value))
-                        {
-                            smallest = curr;
-                            value = HPX_MOVE(curr_value);
-                        }
-                    });
-
-                return smallest;
+                if constexpr (hpx::is_vectorpack_execution_policy_v<
+                                  ExPolicy>)
+                {
+                    return sequential_min_element(HPX_FORWARD(ExPolicy, policy),
+                        first, detail::distance(first, last), f, proj);
+                }
+                else
+                {
+                    if (first == last)
+                        return first;
+
+                    using element_type = hpx::traits::proxy_value_t<
+                        typename std::iterator_traits<FwdIter>::value_type>;
+
+                    auto smallest = first;
+
+                    element_type value = HPX_INVOKE(proj, *smallest);
+                    util::loop(HPX_FORWARD(ExPolicy, policy), ++first, last,
+                        [&](FwdIter const& curr) -> void {
+                            element_type curr_value = HPX_INVOKE(proj, *curr);
+                            if (HPX_INVOKE(f, curr_value, value))
+                            {
+                                smallest = curr;
+                                value = HPX_MOVE(curr_value);
+                            }
+                        });
+
+                    return smallest;
+                }
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -530,33 +520,6 @@ namespace hpx::parallel {
     namespace detail {
 
         /// \cond NOINTERNAL
-        template <typename ExPolicy, typename FwdIter, typename F,
-            typename Proj>
-        constexpr FwdIter sequential_max_element(ExPolicy&&, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
-        {
-            if (count == 0 || count == 1)
-                return it;
-
-            using element_type = hpx::traits::proxy_value_t<
-                typename std::iterator_traits<FwdIter>::value_type>;
-
-            auto largest = it;
-
-            element_type value = HPX_INVOKE(proj, *largest);
-            util::loop_n<std::decay_t<ExPolicy>>(
-                ++it, count - 1, [&](FwdIter const& curr) -> void {
-                    element_type curr_value = HPX_INVOKE(proj, *curr);
-                    if (!HPX_INVOKE(f, curr_value, value))
-                    {
-                        largest = curr;
-                        value = HPX_MOVE(curr_value);
-                    }
-                });
-
-            return largest;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         template <typename Iter>
         struct max_element : public algorithm<max_element<Iter>, Iter>
@@ -581,7 +544,7 @@ namespace hpx::parallel {
                         decltype(largest)>::value_type>;
 
                 element_type value = HPX_INVOKE(proj, *largest);
-                util::loop_n<std::decay_t<ExPolicy>>(
+                util::loop_n<minmax_loop_policy_t<ExPolicy>>(
                     ++it, count - 1, [&](FwdIter const& curr) -> void {
                         element_type curr_value = HPX_INVOKE(proj, **curr);
                         if (!HPX_INVOKE(f, curr_value, value))
@@ -604,26 +567,35 @@ namespace hpx::parallel {
             static constexpr FwdIter sequential(
                 ExPolicy&& policy, FwdIter first, Sent last, F&& f, Proj&& proj)
             {
-                if (first == last)
-                    return first;
-
-                using element_type = hpx::traits::proxy_value_t<
-                    typename std::iterator_traits<FwdIter>::value_type>;
-
-                auto largest = first;
-
-                element_type value = HPX_INVOKE(proj, *largest);
-                util::loop(HPX_FORWARD(ExPolicy, policy), ++first, last,
-                    [&](FwdIter const& curr) -> void {
-                        element_type curr_value = HPX_INVOKE(proj, *curr);
-                        if (!HPX_INVOKE(f, curr_value, value))
-                        {
-                            largest = curr;
-                            value = HPX_MOVE(curr_value);
-                        }
-                    });
-
-                return largest;
+                if constexpr (hpx::is_vectorpack_execution_policy_v<
+                                  ExPolicy>)
+                {
+                    return sequential_max_element(HPX_FORWARD(ExPolicy, policy),
+                        first, detail::distance(first, last), f, proj);
+                }
+                else
+                {
+                    if (first == last)
+                        return first;
+
+                    using element_type = hpx::traits::proxy_value_t<
+                        typename std::iterator_traits<FwdIter>::value_type>;
+
+                    auto largest = first;
+
+                    element_type value = HPX_INVOKE(proj, *largest);
+                    util::loop(HPX_FORWARD(ExPolicy, policy), ++first, last,
+                        [&](FwdIter const& curr) -> void {
+                            element_type curr_value = HPX_INVOKE(proj, *curr);
+                            if (!HPX_INVOKE(f, curr_value, value))
+                            {
+                                largest = curr;
+                                value = HPX_MOVE(curr_value);
+                            }
+                        });
+
+                    return largest;
+                }
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -665,40 +637,6 @@ namespace hpx::parallel {
     namespace detail {
 
         /// \cond NOINTERNAL
-        template <typename ExPolicy, typename FwdIter, typename F,
-            typename Proj>
-        minmax_element_result<FwdIter> sequential_minmax_element(ExPolicy&&,
-            FwdIter it, std::size_t count, F const& f, Proj const& proj)
-        {
-            minmax_element_result<FwdIter> result = {it, it};
-
-            if (count == 0 || count == 1)
-                return result;
-
-            using element_type = hpx::traits::proxy_value_t<
-                typename std::iterator_traits<FwdIter>::value_type>;
-
-            element_type min_value = HPX_INVOKE(proj, *it);
-            element_type max_value = min_value;
-            util::loop_n<std::decay_t<ExPolicy>>(
-                ++it, count - 1, [&](FwdIter const& curr) -> void {
-                    element_type curr_value = HPX_INVOKE(proj, *curr);
-                    if (HPX_INVOKE(f, curr_value, min_value))
-                    {
-                        result.min = curr;
-                        min_value = curr_value;
-                    }
-
-                    if (!HPX_INVOKE(f, curr_value, max_value))
-                    {
-                        result.max = curr;
-                        max_value = HPX_MOVE(curr_value);
-                    }
-                });
-
-            return result;
-        }
-
         template <typename Iter>
         struct minmax_element
           : public algorithm<minmax_element<Iter>, minmax_element_result<Iter>>
@@ -723,7 +661,7 @@ namespace hpx::parallel {
 
                 element_type min_value = HPX_INVOKE(proj, *result.min);
                 element_type max_value = HPX_INVOKE(proj, *result.max);
-                util::loop_n<std::decay_t<ExPolicy>>(
+                util::loop_n<minmax_loop_policy_t<ExPolicy>>(
                     ++it, count - 1, [&](PairIter const& curr) -> void {
                         element_type curr_min_value =
                             HPX_INVOKE(proj, *curr->min);
@@ -756,35 +694,45 @@ namespace hpx::parallel {
             static constexpr minmax_element_result<FwdIter> sequential(
                 ExPolicy&& policy, FwdIter first, Sent last, F&& f, Proj&& proj)
             {
-                auto min = first, max = first;
-
-                if (first == last || ++first == last)
+                if constexpr (hpx::is_vectorpack_execution_policy_v<
+                                  ExPolicy>)
                 {
-                    return minmax_element_result<FwdIter>{min, max};
+                    return sequential_minmax_element(
+                        HPX_FORWARD(ExPolicy, policy), first,
+                        detail::distance(first, last), f, proj);
                 }
+                else
+                {
+                    auto min = first, max = first;
 
-                using element_type = hpx::traits::proxy_value_t<
-                    typename std::iterator_traits<FwdIter>::value_type>;
-
-                element_type min_value = HPX_INVOKE(proj, *min);
-                element_type max_value = HPX_INVOKE(proj, *max);
-                util::loop(HPX_FORWARD(ExPolicy, policy), first, last,
-                    [&](FwdIter const& curr) -> void {
-                        element_type curr_value = HPX_INVOKE(proj, *curr);
-                        if (HPX_INVOKE(f, curr_value, min_value))
-                        {
-                            min = curr;
-                            min_value = curr_value;
-                        }
+                    if (first == last || ++first == last)
+                    {
+                        return minmax_element_result<FwdIter>{min, max};
+                    }
 
-                        if (!HPX_INVOKE(f, curr_value, max_value))
-                        {
-                            max = curr;
-                            max_value = HPX_MOVE(curr_value);
-                        }
-                    });
+                    using element_type = hpx::traits::proxy_value_t<
+                        typename std::iterator_traits<FwdIter>::value_type>;
+
+                    element_type min_value = HPX_INVOKE(proj, *min);
+                    element_type max_value = HPX_INVOKE(proj, *max);
+                    util::loop(HPX_FORWARD(ExPolicy, policy), first, last,
+                        [&](FwdIter const& curr) -> void {
+                            element_type curr_value = HPX_INVOKE(proj, *curr);
+                            if (HPX_INVOKE(f, curr_value, min_value))
+                            {
+                                min = curr;
+                                min_value = curr_value;
+                            }
+
+                            if (!HPX_INVOKE(f, curr_value, max_value))
+                            {
+                                max = curr;
+                                max_value = HPX_MOVE(curr_value);
+                            }
+                        });
 
-                return minmax_element_result<FwdIter>{min, max};
+                    return minmax_element_result<FwdIter>{min, max};
+                }
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
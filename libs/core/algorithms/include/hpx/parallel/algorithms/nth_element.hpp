@@ -140,10 +140,11 @@ namespace hpx {
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/parallel_select.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
 #include <hpx/parallel/algorithms/minmax.hpp>
 #include <hpx/parallel/algorithms/partial_sort.hpp>
-#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 
@@ -266,11 +267,6 @@ namespace hpx::parallel {
             parallel(ExPolicy&& policy, RandomIt first, RandomIt nth, Sent last,
                 Pred&& pred, Proj&& proj)
             {
-                using value_type =
-                    typename std::iterator_traits<RandomIt>::value_type;
-
-                RandomIt partition_iter, return_last;
-
                 if (first == last)
                 {
                     return util::detail::algorithm_result<ExPolicy,
@@ -287,49 +283,12 @@ namespace hpx::parallel {
                 {
                     RandomIt last_iter =
                         detail::advance_to_sentinel(first, last);
-                    return_last = last_iter;
-
-                    while (first != last_iter)
-                    {
-                        detail::pivot9(first, last_iter, pred);
-
-                        partition_iter =
-                            hpx::parallel::detail::partition<RandomIt>().call(
-                                policy(hpx::execution::non_task), first + 1,
-                                last_iter,
-                                [val = HPX_INVOKE(proj, *first), &pred](
-                                    value_type const& elem) {
-                                    return HPX_INVOKE(pred, elem, val);
-                                },
-                                proj);
-
-                        --partition_iter;
-
-                        // swap first element and partitionIter
-                        // (ending element of first group)
-#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
-                        std::ranges::iter_swap(first, partition_iter);
-#else
-                        std::iter_swap(first, partition_iter);
-#endif
 
-                        // if nth element < partitioned index,
-                        // it lies in [first, partitionIter)
-                        if (partition_iter < nth)
-                        {
-                            first = partition_iter + 1;
-                        }
-                        // else it lies in [partitionIter + 1, last)
-                        else if (partition_iter > nth)
-                        {
-                            last_iter = partition_iter;
-                        }
-                        // partitionIter == nth
-                        else
-                        {
-                            break;
-                        }
-                    }
+                    detail::parallel_select(policy, first, nth, last_iter,
+                        util::compare_projected<Pred&, Proj&>(pred, proj));
+
+                    return util::detail::algorithm_result<ExPolicy,
+                        RandomIt>::get(HPX_MOVE(last_iter));
                 }
                 catch (...)
                 {
@@ -337,9 +296,6 @@ namespace hpx::parallel {
                         RandomIt>::get(detail::handle_exception<ExPolicy,
                         RandomIt>::call(std::current_exception()));
                 }
-
-                return util::detail::algorithm_result<ExPolicy, RandomIt>::get(
-                    HPX_MOVE(return_last));
             }
         };
         /// \endcond
@@ -108,18 +108,18 @@ namespace hpx {
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
-#include <hpx/async_local/dataflow.hpp>
+#include <hpx/async_base/launch_policy.hpp>
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
-#include <hpx/executors/exception_list.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/functional/invoke.hpp>
+#include <hpx/futures/future.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
-#include <hpx/parallel/algorithms/detail/is_sorted.hpp>
+#include <hpx/parallel/algorithms/detail/parallel_select.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -131,7 +131,6 @@ namespace hpx {
 #include <cstdint>
 #include <exception>
 #include <iterator>
-#include <list>
 #include <type_traits>
 #include <utility>
 
@@ -335,106 +334,6 @@ namespace hpx::parallel {
                 first, middle, c_last, level - 1, HPX_FORWARD(Comp, comp));
         }
 
-        // Internal function to divide and sort the ranges
-        //
-        // policy : execution policy
-        // first : iterator to the first element
-        // middle: iterator defining the last element to be sorted
-        // last : iterator to the element after the end in the range
-        // level : level of depth from the top level call
-        // comp : object for to Comp elements
-        //
-        template <typename ExPolicy, typename Iter, typename Comp>
-        hpx::future<Iter> parallel_partial_sort(ExPolicy&& policy, Iter first,
-            Iter middle, Iter last, std::uint32_t level, Comp&& comp = Comp());
-
-        struct sort_thread_helper
-        {
-            template <typename... Ts>
-            decltype(auto) operator()(Ts&&... ts) const
-            {
-                return sort_thread(HPX_FORWARD(Ts, ts)...);
-            }
-        };
-
-        struct parallel_partial_sort_helper
-        {
-            template <typename... Ts>
-            decltype(auto) operator()(Ts&&... ts) const
-            {
-                return parallel_partial_sort(HPX_FORWARD(Ts, ts)...);
-            }
-        };
-
-        template <typename ExPolicy, typename Iter, typename Comp>
-        hpx::future<Iter> parallel_partial_sort(ExPolicy&& policy, Iter first,
-            Iter middle, Iter last, std::uint32_t level, Comp&& comp)
-        {
-            std::int64_t nelem = last - first;
-            std::int64_t const nmid = middle - first;
-            HPX_ASSERT(nelem >= nmid);
-
-            if (nelem == 0 || nmid == 0)
-            {
-                return hpx::make_ready_future(last);
-            }
-
-            if (nmid < 4096 || level < 12)
-            {
-                recursive_partial_sort(first, middle, last, level, comp);
-                return hpx::make_ready_future(last);
-            }
-
-            Iter c_last = filter(first, last, comp);
-            if (middle >= c_last)
-            {
-                // figure out the chunk size to use
-                std::size_t const cores =
-                    execution::processing_units_count(policy.parameters(),
-                        policy.executor(), hpx::chrono::null_duration, nelem);
-
-                // number of elements to sort
-                std::size_t chunk_size = execution::get_chunk_size(
-                    policy.parameters(), policy.executor(),
-                    hpx::chrono::null_duration, cores, nelem);
-
-                hpx::future<Iter> left = execution::async_execute(
-                    policy.executor(), sort_thread_helper(), policy, first,
-                    c_last, comp, chunk_size);
-
-                hpx::future<Iter> right;
-                if (middle != c_last)
-                {
-                    right = execution::async_execute(policy.executor(),
-                        parallel_partial_sort_helper(), policy, c_last + 1,
-                        middle, last, level - 1, comp);
-                }
-                else
-                {
-                    right = hpx::make_ready_future(last);
-                }
-
-                return hpx::dataflow(
-                    [last](hpx::future<Iter>&& leftf,
-                        hpx::future<Iter>&& rightf) -> Iter {
-                        if (leftf.has_exception() || rightf.has_exception())
-                        {
-                            std::list<std::exception_ptr> errors;
-                            if (leftf.has_exception())
-                                errors.push_back(leftf.get_exception_ptr());
-                            if (rightf.has_exception())
-                                errors.push_back(rightf.get_exception_ptr());
-
-                            throw exception_list(HPX_MOVE(errors));
-                        }
-                        return last;
-                    },
-                    HPX_MOVE(left), HPX_MOVE(right));
-            }
-
-            return parallel_partial_sort(HPX_FORWARD(ExPolicy, policy), first,
-                middle, c_last, level - 1, HPX_FORWARD(Comp, comp));
-        }
         /// \endcond NOINTERNAL
     }    // end namespace detail
 
@@ -455,16 +354,7 @@ namespace hpx::parallel {
         std::int64_t const nelem = parallel::detail::distance(first, end);
         HPX_ASSERT(nelem >= 0);
 
-        std::int64_t const nmid = middle - first;
-        HPX_ASSERT(nmid >= 0 && nmid <= nelem);
-
-        if (nmid > 1024)
-        {
-            if (detail::is_sorted_sequential(first, middle, comp))
-            {
-                return first + nelem;
-            }
-        }
+        HPX_ASSERT(middle - first >= 0 && middle - first <= nelem);
 
         std::uint32_t level = detail::nbits64(nelem) * 2;
         detail::recursive_partial_sort(
@@ -494,17 +384,28 @@ namespace hpx::parallel {
         std::int64_t const nmid = middle - first;
         HPX_ASSERT(nmid >= 0 && nmid <= nelem);
 
-        if (nmid > 1024)
-        {
-            if (detail::is_sorted_sequential(first, middle, comp))
-            {
-                return hpx::make_ready_future(first + nelem);
-            }
-        }
+        // move the nmid smallest elements to the front, then sort those,
+        // the selection is run asynchronously to avoid blocking the caller
+        Iter last = first + nelem;
+        bool const select = nmid != 0 && nmid != nelem;
 
-        std::uint32_t level = parallel::detail::nbits64(nelem) * 2;
-        return detail::parallel_partial_sort(HPX_FORWARD(ExPolicy, policy),
-            first, middle, first + nelem, level, HPX_FORWARD(Comp, comp));
+        return execution::async_execute(policy.executor(),
+            [policy, first, middle, last, comp,
+                select]() mutable -> hpx::future<Iter> {
+                if (select)
+                {
+                    detail::parallel_select(policy, first, middle, last, comp);
+                }
+
+                hpx::future<Iter> sorted = detail::parallel_sort_async(
+                    HPX_MOVE(policy), first, middle, HPX_MOVE(comp));
+
+                return sorted.then(hpx::launch::sync,
+                    [last](hpx::future<Iter>&& f) -> Iter {
+                        f.get();    // propagate exceptions
+                        return last;
+                    });
+            });
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -468,6 +468,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/partition.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
@@ -754,67 +755,6 @@ namespace hpx::parallel {
     namespace detail {
         /// \cond NOINTERNAL
 
-        // sequential partition with projection function for bidirectional iterator.
-        template <typename BidirIter, typename Pred, typename Proj,
-            HPX_CONCEPT_REQUIRES_(
-                hpx::traits::is_bidirectional_iterator_v<BidirIter>)>
-        constexpr BidirIter sequential_partition(
-            BidirIter first, BidirIter last, Pred&& pred, Proj&& proj)
-        {
-            while (true)
-            {
-                while (
-                    first != last && HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
-                {
-                    ++first;
-                }
-                if (first == last)
-                    break;
-
-                while (first != --last &&
-                    !HPX_INVOKE(pred, HPX_INVOKE(proj, *last)))
-                    ;
-                if (first == last)
-                    break;
-
-#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
-                std::ranges::iter_swap(first++, last);
-#else
-                std::iter_swap(first++, last);
-#endif
-            }
-
-            return first;
-        }
-
-        // sequential partition with projection function for forward iterator.
-        template <typename FwdIter, typename Pred, typename Proj,
-            HPX_CONCEPT_REQUIRES_(hpx::traits::is_forward_iterator_v<FwdIter> &&
-                !hpx::traits::is_bidirectional_iterator_v<FwdIter>)>
-        constexpr FwdIter sequential_partition(
-            FwdIter first, FwdIter last, Pred&& pred, Proj&& proj)
-        {
-            while (first != last && HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
-                ++first;
-
-            if (first == last)
-                return first;
-
-            for (FwdIter it = std::next(first); it != last; ++it)
-            {
-                if (HPX_INVOKE(pred, HPX_INVOKE(proj, *it)))
-                {
-#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
-                    std::ranges::iter_swap(first++, it);
-#else
-                    std::iter_swap(first++, it);
-#endif
-                }
-            }
-
-            return first;
-        }
-
         struct partition_helper
         {
             template <typename FwdIter>
@@ -1402,8 +1342,9 @@ namespace hpx::parallel {
 
                 // Perform sequential partition to unpartitioned range.
                 FwdIter real_boundary =
-                    sequential_partition(unpartitioned_block.first,
-                        unpartitioned_block.last, pred, proj);
+                    sequential_partition<std::decay_t<ExPolicy>>(
+                        unpartitioned_block.first, unpartitioned_block.last,
+                        pred, proj);
 
                 return real_boundary;
             }
@@ -1445,7 +1386,7 @@ namespace hpx::parallel {
                 ExPolicy, FwdIter first, Sent last, Pred&& pred, Proj&& proj)
             {
                 auto last_iter = detail::advance_to_sentinel(first, last);
-                return sequential_partition(first, last_iter,
+                return sequential_partition<ExPolicy>(first, last_iter,
                     HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
             }
 
@@ -1513,29 +1454,6 @@ namespace hpx::parallel {
     namespace detail {
         /// \cond NOINTERNAL
 
-        // sequential partition_copy with projection function
-        template <typename InIter, typename OutIter1, typename OutIter2,
-            typename Pred, typename Proj>
-        constexpr hpx::tuple<InIter, OutIter1, OutIter2>
-        sequential_partition_copy(InIter first, InIter last, OutIter1 dest_true,
-            OutIter2 dest_false, Pred&& pred, Proj&& proj)
-        {
-            while (first != last)
-            {
-                if (HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
-                {
-                    *dest_true++ = *first;
-                }
-                else
-                {
-                    *dest_false++ = *first;
-                }
-                ++first;
-            }
-            return hpx::make_tuple(
-                HPX_MOVE(last), HPX_MOVE(dest_true), HPX_MOVE(dest_false));
-        }
-
         template <typename IterTuple>
         struct partition_copy
           : public algorithm<partition_copy<IterTuple>, IterTuple>
@@ -1553,8 +1471,8 @@ namespace hpx::parallel {
                 OutIter2 dest_false, Pred&& pred, Proj&& proj)
             {
                 auto last_iter = detail::advance_to_sentinel(first, last);
-                return sequential_partition_copy(first, last_iter, dest_true,
-                    dest_false, HPX_FORWARD(Pred, pred),
+                return sequential_partition_copy<ExPolicy>(first, last_iter,
+                    dest_true, dest_false, HPX_FORWARD(Pred, pred),
                     HPX_FORWARD(Proj, proj));
             }
 
@@ -1590,6 +1508,12 @@ namespace hpx::parallel {
 #endif
                 output_iterator_offset init = {0, 0};
 
+                // the loops over the flags operate on individual elements, even
+                // for vector-pack execution policies
+                using loop_policy_type = std::conditional_t<
+                    hpx::is_vectorpack_execution_policy_v<ExPolicy>,
+                    hpx::execution::sequenced_policy, std::decay_t<ExPolicy>>;
+
                 using hpx::get;
                 using scan_partitioner_type = util::scan_partitioner<ExPolicy,
                     hpx::tuple<FwdIter1, FwdIter2, FwdIter3>,
@@ -1604,7 +1528,7 @@ namespace hpx::parallel {
                     std::size_t true_count = 0;
 
                     // MSVC complains if pred or proj is captured by ref below
-                    util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
+                    util::loop_n<loop_policy_type>(part_begin, part_size,
                         [pred, proj, &true_count](
                             zip_iterator it) mutable -> void {
                             bool f = hpx::invoke(
@@ -1635,7 +1559,7 @@ namespace hpx::parallel {
                     std::advance(dest_true, count_true);
                     std::advance(dest_false, count_false);
 
-                    util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
+                    util::loop_n<loop_policy_type>(part_begin, part_size,
                         [&dest_true, &dest_false](zip_iterator it) mutable {
                             if (get<1>(*it))
                                 *dest_true++ = get<0>(*it);
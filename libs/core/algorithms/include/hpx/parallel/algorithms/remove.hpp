@@ -220,6 +220,7 @@ namespace hpx {
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/iterator_support/zip_iterator.hpp>
+#include <hpx/parallel/algorithms/detail/copy_if.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/find.hpp>
@@ -277,11 +278,38 @@ namespace hpx::parallel {
 
             template <typename ExPolicy, typename Iter, typename Sent,
                 typename Pred, typename Proj>
-            static constexpr Iter sequential(
-                ExPolicy, Iter first, Sent last, Pred&& pred, Proj&& proj)
+            static constexpr Iter sequential([[maybe_unused]] ExPolicy&& policy,
+                Iter first, Sent last, Pred&& pred, Proj&& proj)
             {
-                return sequential_remove_if(first, last,
-                    HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+                using value_type =
+                    typename std::iterator_traits<Iter>::value_type;
+
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy> &&
+                    std::is_arithmetic_v<value_type>)
+                {
+                    // compact the remaining elements using the (vectorized)
+                    // copy_if, copying and moving arithmetic values is
+                    // equivalent
+                    first = sequential_find_if<std::decay_t<ExPolicy>>(
+                        first, last, pred, proj);
+                    if (first == last)
+                    {
+                        return first;
+                    }
+
+                    return sequential_copy_if(HPX_FORWARD(ExPolicy, policy),
+                        std::next(first), last, first,
+                        [&pred](auto const& v) {
+                            return !HPX_INVOKE(pred, v);
+                        },
+                        HPX_FORWARD(Proj, proj))
+                        .out;
+                }
+                else
+                {
+                    return sequential_remove_if(first, last,
+                        HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+                }
             }
 
             template <typename ExPolicy, typename Iter, typename Sent,
@@ -307,6 +335,12 @@ namespace hpx::parallel {
                 boost::shared_array<bool> flags(new bool[count]);
 #endif
 
+                // the loops over the flags operate on individual elements, even
+                // for vector-pack execution policies
+                using loop_policy_type = std::conditional_t<
+                    hpx::is_vectorpack_execution_policy_v<ExPolicy>,
+                    hpx::execution::sequenced_policy, std::decay_t<ExPolicy>>;
+
                 using hpx::get;
 
                 // Note: replacing the invoke() with HPX_INVOKE()
@@ -316,7 +350,7 @@ namespace hpx::parallel {
                               zip_iterator part_begin,
                               std::size_t part_size) -> void {
                     // MSVC complains if pred or proj is captured by ref below
-                    util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
+                    util::loop_n<loop_policy_type>(part_begin, part_size,
                         [pred, proj](zip_iterator it) mutable {
                             bool f = hpx::invoke(
                                 pred, hpx::invoke(proj, get<0>(*it)));
@@ -333,11 +367,10 @@ namespace hpx::parallel {
                     auto dest = first;
                     auto part_size = count;
 
-                    using execution_policy_type = std::decay_t<ExPolicy>;
                     if (dest == get<0>(part_begin.get_iterator_tuple()))
                     {
                         // Self-assignment must be detected.
-                        util::loop_n<execution_policy_type>(
+                        util::loop_n<loop_policy_type>(
                             part_begin, part_size, [&dest](zip_iterator it) {
                                 if (!get<1>(*it))
                                 {
@@ -351,7 +384,7 @@ namespace hpx::parallel {
                     else
                     {
                         // Self-assignment can't be performed.
-                        util::loop_n<execution_policy_type>(
+                        util::loop_n<loop_policy_type>(
                             part_begin, part_size, [&dest](zip_iterator it) {
                                 if (!get<1>(*it))
                                     *dest++ = HPX_MOVE(get<0>(*it));
@@ -265,6 +265,7 @@ namespace hpx {
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/algorithms/copy.hpp>
+#include <hpx/parallel/algorithms/detail/copy_if.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
@@ -339,23 +340,6 @@ namespace hpx::parallel {
     namespace detail {
         /// \cond NOINTERNAL
 
-        // sequential remove_copy_if
-        template <typename InIter, typename Sent, typename OutIter, typename F,
-            typename Proj>
-        constexpr util::in_out_result<InIter, OutIter>
-        sequential_remove_copy_if(
-            InIter first, Sent last, OutIter dest, F p, Proj&& proj)
-        {
-            for (/* */; first != last; ++first)
-            {
-                if (!HPX_INVOKE(p, HPX_INVOKE(proj, *first)))
-                {
-                    *dest++ = *first;
-                }
-            }
-            return util::in_out_result<InIter, OutIter>{first, dest};
-        }
-
         template <typename IterPair>
         struct remove_copy_if
           : public algorithm<remove_copy_if<IterPair>, IterPair>
@@ -368,11 +352,15 @@ namespace hpx::parallel {
             template <typename ExPolicy, typename InIter, typename Sent,
                 typename OutIter, typename F, typename Proj>
             static constexpr util::in_out_result<InIter, OutIter> sequential(
-                ExPolicy, InIter first, Sent last, OutIter dest, F&& f,
+                ExPolicy&& policy, InIter first, Sent last, OutIter dest, F&& f,
                 Proj&& proj)
             {
-                return sequential_remove_copy_if(first, last, dest,
-                    HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
+                // the negated predicate is generic to allow for it to be
+                // invoked with vector packs
+                return sequential_copy_if(HPX_FORWARD(ExPolicy, policy), first,
+                    last, dest,
+                    [&f](auto const& v) { return !HPX_INVOKE(f, v); },
+                    HPX_FORWARD(Proj, proj));
             }
 
             template <typename ExPolicy, typename FwdIter1, typename Sent,
@@ -306,6 +306,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/unique.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
@@ -376,8 +377,29 @@ namespace hpx::parallel {
             static constexpr InIter sequential(
                 ExPolicy, InIter first, Sent last, Pred&& pred, Proj&& proj)
             {
-                return sequential_unique(first, last, HPX_FORWARD(Pred, pred),
-                    HPX_FORWARD(Proj, proj));
+                using value_type =
+                    typename std::iterator_traits<InIter>::value_type;
+
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy> &&
+                    std::is_arithmetic_v<value_type>)
+                {
+                    // compact the elements in place using the (vectorized)
+                    // unique_copy, copying and moving arithmetic values is
+                    // equivalent
+                    auto const count =
+                        static_cast<std::size_t>(detail::distance(first, last));
+                    if (count == 0)
+                    {
+                        return first;
+                    }
+                    return sequential_unique_copy_n<ExPolicy>(
+                        first, count, first, pred, proj);
+                }
+                else
+                {
+                    return sequential_unique(first, last,
+                        HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+                }
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -407,6 +429,12 @@ namespace hpx::parallel {
 #endif
                 flags[0] = false;
 
+                // the loops over the flags operate on individual elements, even
+                // for vector-pack execution policies
+                using loop_policy_type = std::conditional_t<
+                    hpx::is_vectorpack_execution_policy_v<ExPolicy>,
+                    hpx::execution::sequenced_policy, std::decay_t<ExPolicy>>;
+
                 using hpx::get;
 
                 auto f1 = [pred = HPX_FORWARD(Pred, pred),
@@ -419,8 +447,7 @@ namespace hpx::parallel {
                     // below makes gcc generate errors
 
                     // MSVC complains if pred or proj is captured by ref below
-                    util::loop_n<std::decay_t<ExPolicy>>(++part_begin,
-                        part_size,
+                    util::loop_n<loop_policy_type>(++part_begin, part_size,
                         [base, pred, proj](zip_iterator it) mutable -> void {
                             bool r = hpx::invoke(pred, hpx::invoke(proj, *base),
                                 hpx::invoke(proj, get<0>(*it)));
@@ -439,11 +466,10 @@ namespace hpx::parallel {
                     auto dest = first;
                     auto part_size = count;
 
-                    using execution_policy_type = std::decay_t<ExPolicy>;
                     if (dest == get<0>(part_begin.get_iterator_tuple()))
                     {
                         // Self-assignment must be detected.
-                        util::loop_n<execution_policy_type>(
+                        util::loop_n<loop_policy_type>(
                             part_begin, part_size, [&dest](zip_iterator it) {
                                 if (!get<1>(*it))
                                 {
@@ -457,7 +483,7 @@ namespace hpx::parallel {
                     else
                     {
                         // Self-assignment can't be performed.
-                        util::loop_n<execution_policy_type>(
+                        util::loop_n<loop_policy_type>(
                             part_begin, part_size, [&dest](zip_iterator it) {
                                 if (!get<1>(*it))
                                     *dest++ = HPX_MOVE(get<0>(*it));
@@ -595,9 +621,30 @@ namespace hpx::parallel {
                 ExPolicy, InIter first, Sent last, OutIter dest, Pred&& pred,
                 Proj&& proj)
             {
-                return sequential_unique_copy(first, last, dest,
-                    HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj),
-                    hpx::traits::is_forward_iterator<InIter>());
+                using value_type =
+                    typename std::iterator_traits<InIter>::value_type;
+
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy> &&
+                    hpx::traits::is_forward_iterator_v<InIter> &&
+                    std::is_arithmetic_v<value_type>)
+                {
+                    auto last_iter = first;
+                    auto const count = static_cast<std::size_t>(
+                        detail::advance_and_get_distance(last_iter, last));
+                    if (count != 0)
+                    {
+                        dest = sequential_unique_copy_n<ExPolicy>(
+                            first, count, dest, pred, proj);
+                    }
+                    return unique_copy_result<InIter, OutIter>{
+                        HPX_MOVE(last_iter), HPX_MOVE(dest)};
+                }
+                else
+                {
+                    return sequential_unique_copy(first, last, dest,
+                        HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj),
+                        hpx::traits::is_forward_iterator<InIter>());
+                }
             }
 
             template <typename ExPolicy, typename FwdIter1, typename Sent,
@@ -640,6 +687,12 @@ namespace hpx::parallel {
 #endif
                 std::size_t init = 0;
 
+                // the loops over the flags operate on individual elements, even
+                // for vector-pack execution policies
+                using loop_policy_type = std::conditional_t<
+                    hpx::is_vectorpack_execution_policy_v<ExPolicy>,
+                    hpx::execution::sequenced_policy, std::decay_t<ExPolicy>>;
+
                 using hpx::get;
                 using scan_partitioner_type = util::scan_partitioner<ExPolicy,
                     unique_copy_result<FwdIter1, FwdIter2>, std::size_t>;
@@ -652,7 +705,7 @@ namespace hpx::parallel {
                     std::size_t curr = 0;
 
                     // MSVC complains if pred or proj is captured by ref below
-                    util::loop_n<std::decay_t<ExPolicy>>(
+                    util::loop_n<loop_policy_type>(
                         ++part_begin, part_size, [&](zip_iterator it) mutable {
                             bool r = HPX_INVOKE(pred, HPX_INVOKE(proj, *base),
                                 HPX_INVOKE(proj, get<0>(*it)));
@@ -671,8 +724,8 @@ namespace hpx::parallel {
                               std::size_t val) mutable -> void {
                     HPX_UNUSED(flags);
                     std::advance(dest, val);
-                    util::loop_n<std::decay_t<ExPolicy>>(++part_begin,
-                        part_size, [&dest](zip_iterator it) mutable {
+                    util::loop_n<loop_policy_type>(++part_begin, part_size,
+                        [&dest](zip_iterator it) mutable {
                             if (!get<1>(*it))
                                 *dest++ = get<0>(*it);
                         });
@@ -0,0 +1,146 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_compress_store.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/copy_if.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The selected elements of each pack are collected in a staging buffer
+    // which is written to the destination in chunks of a full pack. This
+    // avoids a data dependent number of (scalar) stores per pack. The number
+    // of elements written plus the number of elements waiting in the buffer
+    // never exceeds the number of elements pushed, which allows for the
+    // destination to overlap the input sequence as long as it does not start
+    // after the input.
+    template <typename V, typename T>
+    struct datapar_compress_buffer
+    {
+        static constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+        template <typename Mask, typename OutIter>
+        HPX_HOST_DEVICE HPX_FORCEINLINE OutIter push(
+            V const& value, Mask const& msk, OutIter dest)
+        {
+            pending += traits::compress(value, msk, buffer + pending);
+            if (pending >= size)
+            {
+                dest = std::copy_n(buffer, size, dest);
+                std::copy_n(buffer + size, size, buffer);
+                pending -= size;
+            }
+            return dest;
+        }
+
+        template <typename OutIter>
+        HPX_HOST_DEVICE HPX_FORCEINLINE OutIter flush(OutIter dest)
+        {
+            dest = std::copy_n(buffer, pending, dest);
+            pending = 0;
+            return dest;
+        }
+
+        alignas(traits::vector_pack_alignment_v<V>) T buffer[2 * size];
+        std::size_t pending = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The input sequence is only read, i.e. the packs are not stored back.
+    // This allows for the destination to overlap the input sequence as long
+    // as it does not start after the input (as used by remove_if).
+    struct datapar_copy_if
+    {
+        template <typename InIter, typename Sent, typename OutIter,
+            typename Pred, typename Proj>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static util::in_out_result<InIter,
+            OutIter>
+        call(InIter first, Sent last, OutIter dest, Pred&& pred, Proj&& proj)
+        {
+            using value_type =
+                typename std::iterator_traits<InIter>::value_type;
+
+            using V1 = traits::vector_pack_type_t<value_type, 1>;
+            using V = traits::vector_pack_type_t<value_type>;
+
+            constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+            std::size_t count =
+                static_cast<std::size_t>(detail::distance(first, last));
+
+            while (count != 0 && !util::detail::is_data_aligned(first))
+            {
+                V1 tmp(
+                    traits::vector_pack_load<V1, value_type>::unaligned(first));
+                dest = traits::compress_store(
+                    tmp, HPX_INVOKE(pred, HPX_INVOKE(proj, tmp)), dest);
+                ++first;
+                --count;
+            }
+
+            if (count >= size)
+            {
+                datapar_compress_buffer<V, value_type> buffer;
+                for (/**/; count >= size; count -= size)
+                {
+                    V tmp(traits::vector_pack_load<V, value_type>::aligned(
+                        first));
+                    dest = buffer.push(
+                        tmp, HPX_INVOKE(pred, HPX_INVOKE(proj, tmp)), dest);
+                    std::advance(first, size);
+                }
+                dest = buffer.flush(dest);
+            }
+
+            for (/**/; count != 0; --count)
+            {
+                V1 tmp(
+                    traits::vector_pack_load<V1, value_type>::unaligned(first));
+                dest = traits::compress_store(
+                    tmp, HPX_INVOKE(pred, HPX_INVOKE(proj, tmp)), dest);
+                ++first;
+            }
+
+            return util::in_out_result<InIter, OutIter>{
+                HPX_MOVE(first), HPX_MOVE(dest)};
+        }
+    };
+
+    template <typename ExPolicy, typename InIter, typename Sent,
+        typename OutIter, typename Pred, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy_v<ExPolicy>&& hpx::parallel::
+                util::detail::iterator_datapar_compatible_v<InIter>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::in_out_result<InIter, OutIter>
+    tag_invoke(sequential_copy_if_t, ExPolicy&&, InIter first, Sent last,
+        OutIter dest, Pred&& pred, Proj&& proj)
+    {
+        return datapar_copy_if::call(first, last, dest, HPX_FORWARD(Pred, pred),
+            HPX_FORWARD(Proj, proj));
+    }
+}    // namespace hpx::parallel::detail
+#endif
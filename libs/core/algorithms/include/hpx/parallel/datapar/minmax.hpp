@@ -0,0 +1,312 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_all_any_none.hpp>
+#include <hpx/execution/traits/vector_pack_conditionals.hpp>
+#include <hpx/execution/traits/vector_pack_find.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The smallest and largest projected values are determined lane by lane
+    // first, the lanes are combined at the end. A second (vectorized) pass
+    // then locates the first element equivalent to the smallest and the last
+    // element equivalent to the largest value, as done by the scalar
+    // implementation. The elements before the first aligned pack and after
+    // the last full pack are handled one by one.
+    struct datapar_minmax_element
+    {
+        template <typename Iter>
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        template <typename Iter>
+        using pack_type = traits::vector_pack_type_t<value_type<Iter>>;
+
+        template <typename Iter>
+        static constexpr std::size_t pack_size =
+            traits::vector_pack_size_v<pack_type<Iter>>;
+
+        // [first, last) is the range of the sequence covered by aligned packs
+        struct partition
+        {
+            std::size_t first;
+            std::size_t last;
+        };
+
+        template <typename Iter>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static partition get_partition(
+            Iter it, std::size_t count) noexcept
+        {
+            std::size_t first = 0;
+            while (first != count && !util::detail::is_data_aligned(it))
+            {
+                ++it;
+                ++first;
+            }
+            return {first, first + (count - first) / pack_size<Iter> *
+                    pack_size<Iter>};
+        }
+
+        template <typename Iter, typename Proj>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static auto load(
+            Iter it, Proj const& proj)
+        {
+            using V = pack_type<Iter>;
+            return HPX_INVOKE(proj,
+                V(traits::vector_pack_load<V, value_type<Iter>>::aligned(it)));
+        }
+
+        // Return the smallest and the largest projected value of the given
+        // range, which holds at least one aligned pack.
+        template <bool Min, bool Max, typename Iter, typename F, typename Proj>
+        static auto extreme_values(Iter it, std::size_t count,
+            partition const& part, F const& f, Proj const& proj)
+        {
+            constexpr std::size_t size = pack_size<Iter>;
+            using element_type =
+                std::decay_t<decltype(HPX_INVOKE(proj, *it))>;
+
+            auto smallest = load(it + part.first, proj);
+            auto largest = smallest;
+
+            for (std::size_t i = part.first + size; i != part.last; i += size)
+            {
+                auto curr = load(it + i, proj);
+                if constexpr (Min)
+                {
+                    traits::mask_assign(
+                        HPX_INVOKE(f, curr, smallest), smallest, curr);
+                }
+                if constexpr (Max)
+                {
+                    traits::mask_assign(
+                        HPX_INVOKE(f, largest, curr), largest, curr);
+                }
+            }
+
+            element_type min_value = traits::get(smallest, 0);
+            element_type max_value = traits::get(largest, 0);
+
+            auto update = [&](element_type const& value) {
+                if constexpr (Min)
+                {
+                    if (HPX_INVOKE(f, value, min_value))
+                        min_value = value;
+                }
+                if constexpr (Max)
+                {
+                    if (HPX_INVOKE(f, max_value, value))
+                        max_value = value;
+                }
+            };
+
+            for (std::size_t lane = 1; lane != size; ++lane)
+            {
+                if constexpr (Min)
+                {
+                    update(traits::get(smallest, lane));
+                }
+                if constexpr (Max)
+                {
+                    update(traits::get(largest, lane));
+                }
+            }
+
+            for (std::size_t i = 0; i != part.first; ++i)
+            {
+                update(HPX_INVOKE(proj, *(it + i)));
+            }
+            for (std::size_t i = part.last; i != count; ++i)
+            {
+                update(HPX_INVOKE(proj, *(it + i)));
+            }
+
+            return std::make_pair(min_value, max_value);
+        }
+
+        // Find the first element not greater than the smallest value.
+        template <typename Iter, typename T, typename F, typename Proj>
+        static Iter find_first(Iter it, std::size_t count,
+            partition const& part, T const& value, F const& f,
+            Proj const& proj)
+        {
+            constexpr std::size_t size = pack_size<Iter>;
+            using W = decltype(load(it, proj));
+
+            for (std::size_t i = 0; i != part.first; ++i)
+            {
+                if (!HPX_INVOKE(f, value, HPX_INVOKE(proj, *(it + i))))
+                    return it + i;
+            }
+
+            W const v(value);
+            for (std::size_t i = part.first; i != part.last; i += size)
+            {
+                int const offset = traits::find_first_of(
+                    !HPX_INVOKE(f, v, load(it + i, proj)));
+                if (offset != -1)
+                    return it + (i + offset);
+            }
+
+            std::size_t i = part.last;
+            for (/**/; i != count; ++i)
+            {
+                if (!HPX_INVOKE(f, value, HPX_INVOKE(proj, *(it + i))))
+                    break;
+            }
+            return it + i;
+        }
+
+        // Find the last element not less than the largest value.
+        template <typename Iter, typename T, typename F, typename Proj>
+        static Iter find_last(Iter it, std::size_t count,
+            partition const& part, T const& value, F const& f,
+            Proj const& proj)
+        {
+            constexpr std::size_t size = pack_size<Iter>;
+            using W = decltype(load(it, proj));
+
+            for (std::size_t i = count; i != part.last; --i)
+            {
+                if (!HPX_INVOKE(f, HPX_INVOKE(proj, *(it + (i - 1))), value))
+                    return it + (i - 1);
+            }
+
+            // find the last pack holding a candidate, the candidate itself is
+            // located by the scalar loop below
+            W const v(value);
+            std::size_t i = part.last;
+            for (/**/; i != part.first; i -= size)
+            {
+                if (traits::any_of(
+                        !HPX_INVOKE(f, load(it + (i - size), proj), v)))
+                {
+                    break;
+                }
+            }
+
+            while (i != 0)
+            {
+                --i;
+                if (!HPX_INVOKE(f, HPX_INVOKE(proj, *(it + i)), value))
+                    break;
+            }
+            return it + i;
+        }
+
+        template <typename Iter, typename F, typename Proj>
+        static Iter min_element(
+            Iter it, std::size_t count, F const& f, Proj const& proj)
+        {
+            partition const part = get_partition(it, count);
+            auto values = extreme_values<true, false>(it, count, part, f, proj);
+            return find_first(it, count, part, values.first, f, proj);
+        }
+
+        template <typename Iter, typename F, typename Proj>
+        static Iter max_element(
+            Iter it, std::size_t count, F const& f, Proj const& proj)
+        {
+            partition const part = get_partition(it, count);
+            auto values = extreme_values<false, true>(it, count, part, f, proj);
+            return find_last(it, count, part, values.second, f, proj);
+        }
+
+        template <typename Iter, typename F, typename Proj>
+        static util::min_max_result<Iter> minmax_element(
+            Iter it, std::size_t count, F const& f, Proj const& proj)
+        {
+            partition const part = get_partition(it, count);
+            auto values = extreme_values<true, true>(it, count, part, f, proj);
+            return {find_first(it, count, part, values.first, f, proj),
+                find_last(it, count, part, values.second, f, proj)};
+        }
+    };
+
+    // Short sequences (less than two packs) are handled by the scalar
+    // implementation.
+    template <typename ExPolicy, typename Iter>
+    inline constexpr bool minmax_use_datapar_v =
+        hpx::is_vectorpack_execution_policy_v<ExPolicy> &&
+        hpx::parallel::util::detail::iterator_datapar_compatible_v<Iter>;
+
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter tag_invoke(sequential_min_element_t,
+        ExPolicy&& policy, Iter it, std::size_t count, F const& f,
+        Proj const& proj)
+    {
+        if constexpr (minmax_use_datapar_v<ExPolicy, Iter>)
+        {
+            if (count >= 2 * datapar_minmax_element::pack_size<Iter>)
+            {
+                return datapar_minmax_element::min_element(it, count, f, proj);
+            }
+        }
+        return sequential_min_element(
+            hpx::execution::experimental::to_non_simd(policy), it, count, f,
+            proj);
+    }
+
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter tag_invoke(sequential_max_element_t,
+        ExPolicy&& policy, Iter it, std::size_t count, F const& f,
+        Proj const& proj)
+    {
+        if constexpr (minmax_use_datapar_v<ExPolicy, Iter>)
+        {
+            if (count >= 2 * datapar_minmax_element::pack_size<Iter>)
+            {
+                return datapar_minmax_element::max_element(it, count, f, proj);
+            }
+        }
+        return sequential_max_element(
+            hpx::execution::experimental::to_non_simd(policy), it, count, f,
+            proj);
+    }
+
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::min_max_result<Iter> tag_invoke(
+        sequential_minmax_element_t, ExPolicy&& policy, Iter it,
+        std::size_t count, F const& f, Proj const& proj)
+    {
+        if constexpr (minmax_use_datapar_v<ExPolicy, Iter>)
+        {
+            if (count >= 2 * datapar_minmax_element::pack_size<Iter>)
+            {
+                return datapar_minmax_element::minmax_element(
+                    it, count, f, proj);
+            }
+        }
+        return sequential_minmax_element(
+            hpx::execution::experimental::to_non_simd(policy), it, count, f,
+            proj);
+    }
+}    // namespace hpx::parallel::detail
+#endif
@@ -23,6 +23,7 @@
 #include <hpx/parallel/util/result_types.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <type_traits>
 #include <utility>
@@ -146,24 +147,21 @@ namespace hpx { namespace parallel { namespace detail {
         call2(Iter1 first1, Sent1 last1, Iter2 first2, Sent2 last2, F&& f,
             Proj1&& proj1, Proj2&& proj2)
         {
-            auto count = hpx::parallel::detail::distance(first1, last1);
+            // only the common prefix of both sequences can be compared
+            std::size_t const count = (std::min)(
+                static_cast<std::size_t>(
+                    hpx::parallel::detail::distance(first1, last1)),
+                static_cast<std::size_t>(
+                    hpx::parallel::detail::distance(first2, last2)));
 
             util::cancellation_token<std::size_t> tok(count);
             call1(0, hpx::util::zip_iterator(first1, first2), count, tok,
                 HPX_FORWARD(F, f), HPX_FORWARD(Proj1, proj1),
                 HPX_FORWARD(Proj2, proj2));
-            std::size_t mismatched = tok.get_data();
+            std::size_t const mismatched = tok.get_data();
 
-            if (mismatched != count)
-            {
-                std::advance(first1, mismatched);
-                std::advance(first2, mismatched);
-            }
-            else
-            {
-                first1 = detail::advance_to_sentinel(first1, last1);
-                first2 = detail::advance_to_sentinel(first2, last2);
-            }
+            std::advance(first1, mismatched);
+            std::advance(first2, mismatched);
             return {first1, first2};
         }
     };
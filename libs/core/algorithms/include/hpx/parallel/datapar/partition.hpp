@@ -0,0 +1,267 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_compress_store.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/partition.hpp>
+#include <hpx/parallel/datapar/copy_if.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The aligned packs are partitioned in place: the selected lanes of each
+    // pack are written to the front, the others to the back of the sequence.
+    // The first and the last pack are held in registers, which leaves room
+    // for the elements of one pack on both sides. The next pack is always
+    // read from the side having less room, which makes sure that both sides
+    // can take all elements of the pack. The elements before the first and
+    // after the last aligned pack are partitioned separately and merged
+    // with the rest.
+    struct datapar_partition
+    {
+        // If the front has room for a full pack (always the case while there
+        // are unread packs), all compressed lanes are written to it, which
+        // avoids copying a data dependent number of elements. The surplus
+        // lanes end up in the unused room.
+        template <bool FullPacks, typename V, typename Iter, typename Pred,
+            typename Proj>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static void partition_pack(
+            V const& value, Iter& left, Iter& right, Pred& pred, Proj& proj)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+            alignas(traits::vector_pack_alignment_v<V>)
+                value_type buffer[size];
+
+            auto const msk = HPX_INVOKE(pred, HPX_INVOKE(proj, value));
+
+            std::size_t const selected = traits::compress(value, msk, buffer);
+            std::copy_n(buffer, FullPacks ? size : selected, left);
+            std::advance(left, selected);
+
+            std::size_t const rejected = traits::compress(value, !msk, buffer);
+            std::copy_n(buffer, rejected, right - rejected);
+            std::advance(right, -static_cast<std::ptrdiff_t>(rejected));
+        }
+
+        // Partition the aligned packs in [first, last), at least two.
+        template <typename V, typename Iter, typename Pred, typename Proj>
+        static Iter partition_packs(
+            Iter first, Iter last, Pred& pred, Proj& proj)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+            V const first_pack(
+                traits::vector_pack_load<V, value_type>::aligned(first));
+            V const last_pack(
+                traits::vector_pack_load<V, value_type>::aligned(last - size));
+
+            Iter left = first;
+            Iter right = last;
+            Iter read_first = first + size;
+            Iter read_last = last - size;
+
+            while (read_first != read_last)
+            {
+                if (read_first - left <= right - read_last)
+                {
+                    V const value(traits::vector_pack_load<V,
+                        value_type>::aligned(read_first));
+                    read_first += size;
+                    partition_pack<true>(value, left, right, pred, proj);
+                }
+                else
+                {
+                    read_last -= size;
+                    V const value(traits::vector_pack_load<V,
+                        value_type>::aligned(read_last));
+                    partition_pack<true>(value, left, right, pred, proj);
+                }
+            }
+
+            partition_pack<false>(first_pack, left, right, pred, proj);
+            partition_pack<false>(last_pack, left, right, pred, proj);
+            return left;
+        }
+
+        // Merge the adjacent partitioned sequences [.., boundary1) and
+        // [middle, boundary2) by swapping the smaller of the two groups
+        // between them.
+        template <typename Iter>
+        static Iter merge_partitions(
+            Iter boundary1, Iter middle, Iter boundary2)
+        {
+            auto const count = (std::min)(
+                middle - boundary1, boundary2 - middle);
+            std::swap_ranges(boundary1, boundary1 + count, boundary2 - count);
+            return boundary1 + (boundary2 - middle);
+        }
+
+        template <typename Iter, typename Pred, typename Proj>
+        static Iter call(Iter first, Iter last, Pred& pred, Proj& proj)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V = traits::vector_pack_type_t<value_type>;
+
+            constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+            Iter middle = first;
+            while (middle != last && !util::detail::is_data_aligned(middle))
+            {
+                ++middle;
+            }
+
+            std::size_t const packs =
+                static_cast<std::size_t>(last - middle) / size;
+            if (packs < 2)
+            {
+                return sequential_partition_helper(first, last, pred, proj);
+            }
+
+            Iter const middle_last = middle + packs * size;
+
+            Iter boundary =
+                sequential_partition_helper(first, middle, pred, proj);
+            boundary = merge_partitions(boundary, middle,
+                partition_packs<V>(middle, middle_last, pred, proj));
+            return merge_partitions(boundary, middle_last,
+                sequential_partition_helper(middle_last, last, pred, proj));
+        }
+    };
+
+    template <typename ExPolicy, typename FwdIter, typename Pred,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE FwdIter tag_invoke(
+        sequential_partition_t<ExPolicy>, FwdIter first, FwdIter last,
+        Pred&& pred, Proj&& proj)
+    {
+        if constexpr (hpx::parallel::util::detail::
+                          iterator_datapar_compatible_v<FwdIter>)
+        {
+            return datapar_partition::call(first, last, pred, proj);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_partition<base_policy_type>(first, last,
+                HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The selected and the other lanes of each aligned pack are collected in
+    // two staging buffers (see datapar_copy_if).
+    struct datapar_partition_copy
+    {
+        template <typename InIter, typename OutIter1, typename OutIter2,
+            typename Pred, typename Proj>
+        static hpx::tuple<InIter, OutIter1, OutIter2> call(InIter first,
+            InIter last, OutIter1 dest_true, OutIter2 dest_false, Pred& pred,
+            Proj& proj)
+        {
+            using value_type =
+                typename std::iterator_traits<InIter>::value_type;
+            using V = traits::vector_pack_type_t<value_type>;
+
+            constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+            auto step = [&]() {
+                if (HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
+                {
+                    *dest_true++ = *first;
+                }
+                else
+                {
+                    *dest_false++ = *first;
+                }
+            };
+
+            auto count = static_cast<std::size_t>(last - first);
+            for (/**/; count != 0 && !util::detail::is_data_aligned(first);
+                 (void) --count, ++first)
+            {
+                step();
+            }
+
+            if (count >= size)
+            {
+                datapar_compress_buffer<V, value_type> true_buffer;
+                datapar_compress_buffer<V, value_type> false_buffer;
+                for (/**/; count >= size;
+                     count -= size, std::advance(first, size))
+                {
+                    V const value(traits::vector_pack_load<V,
+                        value_type>::aligned(first));
+                    auto const msk = HPX_INVOKE(pred, HPX_INVOKE(proj, value));
+
+                    dest_true = true_buffer.push(value, msk, dest_true);
+                    dest_false = false_buffer.push(value, !msk, dest_false);
+                }
+                dest_true = true_buffer.flush(dest_true);
+                dest_false = false_buffer.flush(dest_false);
+            }
+
+            for (/**/; count != 0; (void) --count, ++first)
+            {
+                step();
+            }
+
+            return hpx::make_tuple(
+                HPX_MOVE(first), HPX_MOVE(dest_true), HPX_MOVE(dest_false));
+        }
+    };
+
+    template <typename ExPolicy, typename InIter, typename OutIter1,
+        typename OutIter2, typename Pred, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE hpx::tuple<InIter, OutIter1, OutIter2>
+    tag_invoke(sequential_partition_copy_t<ExPolicy>, InIter first,
+        InIter last, OutIter1 dest_true, OutIter2 dest_false, Pred&& pred,
+        Proj&& proj)
+    {
+        if constexpr (hpx::parallel::util::detail::
+                          iterator_datapar_compatible_v<InIter>)
+        {
+            return datapar_partition_copy::call(
+                first, last, dest_true, dest_false, pred, proj);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_partition_copy<base_policy_type>(first, last,
+                dest_true, dest_false, HPX_FORWARD(Pred, pred),
+                HPX_FORWARD(Proj, proj));
+        }
+    }
+}    // namespace hpx::parallel::detail
+#endif
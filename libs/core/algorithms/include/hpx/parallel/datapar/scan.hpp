@@ -0,0 +1,247 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_scan.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/scan.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // std::plus<T> and std::multiplies<T> (the former being the default
+    // operation of the scans) can't be invoked with vector packs, their
+    // transparent counterparts are used for those instead.
+    template <typename Op>
+    struct datapar_scan_op
+    {
+        template <typename Op_>
+        static constexpr Op_&& get(Op_&& op) noexcept
+        {
+            return HPX_FORWARD(Op_, op);
+        }
+    };
+
+    template <typename T>
+    struct datapar_scan_op<std::plus<T>>
+    {
+        static constexpr std::plus<> get(std::plus<T> const&) noexcept
+        {
+            return {};
+        }
+    };
+
+    template <typename T>
+    struct datapar_scan_op<std::multiplies<T>>
+    {
+        static constexpr std::multiplies<> get(
+            std::multiplies<T> const&) noexcept
+        {
+            return {};
+        }
+    };
+
+    template <typename Op>
+    using datapar_scan_op_t = std::decay_t<decltype(
+        datapar_scan_op<std::decay_t<Op>>::get(std::declval<Op&>()))>;
+
+    // The elements of both sequences have to be of the type of the scanned
+    // values, and the operation has to be invocable with vector packs.
+    template <typename Iter, typename T, typename Op, typename Enable = void>
+    struct scan_use_datapar : std::false_type
+    {
+    };
+
+    template <typename Iter, typename T, typename Op>
+    struct scan_use_datapar<Iter, T, Op,
+        std::enable_if_t<
+            hpx::parallel::util::detail::iterator_datapar_compatible_v<Iter> &&
+            std::is_same_v<typename std::iterator_traits<Iter>::value_type,
+                T>>>
+      : std::is_invocable_r<traits::vector_pack_type_t<T>,
+            datapar_scan_op_t<Op>&, traits::vector_pack_type_t<T> const&,
+            traits::vector_pack_type_t<T> const&>
+    {
+    };
+
+    template <typename InIter, typename OutIter, typename T, typename Op>
+    inline constexpr bool scan_use_datapar_v =
+        scan_use_datapar<InIter, T, Op>::value &&
+        scan_use_datapar<OutIter, T, Op>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Each pack is scanned in registers, the result of the preceding elements
+    // is carried from one pack to the next. The elements are processed one by
+    // one until both sequences are aligned, sequences which are never aligned
+    // at the same time are not vectorized.
+    struct datapar_scan
+    {
+        template <bool Inclusive, typename InIter, typename OutIter,
+            typename T, typename Op>
+        static T call(InIter first, std::size_t count, OutIter dest, T init,
+            Op const& op)
+        {
+            using V = traits::vector_pack_type_t<T>;
+            constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+            auto step = [&]() {
+                T temp = init;
+                init = HPX_INVOKE(op, init, *first);
+                *dest = Inclusive ? init : temp;
+            };
+
+            for (/* */; count != 0 &&
+                 !(util::detail::is_data_aligned(first) &&
+                     util::detail::is_data_aligned(dest));
+                 (void) --count, ++first, ++dest)
+            {
+                step();
+            }
+
+            auto&& pack_op = datapar_scan_op<Op>::get(op);
+            for (/* */; count >= size;
+                 count -= size, std::advance(first, size),
+                 std::advance(dest, size))
+            {
+                V value = traits::vector_pack_load<V, T>::aligned(first);
+                V result;
+                if constexpr (Inclusive)
+                {
+                    result = V(HPX_INVOKE(pack_op, V(init),
+                        traits::inclusive_scan(pack_op, value)));
+                    init = static_cast<T>(traits::get(result, size - 1));
+                }
+                else
+                {
+                    result = traits::exclusive_scan(pack_op, value, init);
+                    init = HPX_INVOKE(op,
+                        static_cast<T>(traits::get(result, size - 1)),
+                        static_cast<T>(traits::get(value, size - 1)));
+                }
+                traits::vector_pack_store<V, T>::aligned(result, dest);
+            }
+
+            for (/* */; count != 0; (void) --count, ++first, ++dest)
+            {
+                step();
+            }
+            return init;
+        }
+
+        template <typename Iter, typename T, typename Op>
+        static void update(
+            Iter dest, std::size_t count, T const& val, Op const& op)
+        {
+            using V = traits::vector_pack_type_t<T>;
+            constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+            for (/* */; count != 0 && !util::detail::is_data_aligned(dest);
+                 (void) --count, ++dest)
+            {
+                *dest = HPX_INVOKE(op, val, *dest);
+            }
+
+            auto&& pack_op = datapar_scan_op<Op>::get(op);
+            V const v(val);
+            for (/* */; count >= size;
+                 count -= size, std::advance(dest, size))
+            {
+                V result(HPX_INVOKE(pack_op, v,
+                    traits::vector_pack_load<V, T>::aligned(dest)));
+                traits::vector_pack_store<V, T>::aligned(result, dest);
+            }
+
+            for (/* */; count != 0; (void) --count, ++dest)
+            {
+                *dest = HPX_INVOKE(op, val, *dest);
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename InIter, typename OutIter,
+        typename T, typename Op,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(
+        sequential_inclusive_scan_n_t<ExPolicy>, InIter first,
+        std::size_t count, OutIter dest, T init, Op&& op)
+    {
+        if constexpr (scan_use_datapar_v<InIter, OutIter, T, Op>)
+        {
+            return datapar_scan::call<true>(
+                first, count, dest, HPX_MOVE(init), op);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_inclusive_scan_n<base_policy_type>(
+                first, count, dest, HPX_MOVE(init), HPX_FORWARD(Op, op));
+        }
+    }
+
+    template <typename ExPolicy, typename InIter, typename OutIter,
+        typename T, typename Op,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(
+        sequential_exclusive_scan_n_t<ExPolicy>, InIter first,
+        std::size_t count, OutIter dest, T init, Op&& op)
+    {
+        if constexpr (scan_use_datapar_v<InIter, OutIter, T, Op>)
+        {
+            return datapar_scan::call<false>(
+                first, count, dest, HPX_MOVE(init), op);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_exclusive_scan_n<base_policy_type>(
+                first, count, dest, HPX_MOVE(init), HPX_FORWARD(Op, op));
+        }
+    }
+
+    template <typename ExPolicy, typename Iter, typename T, typename Op,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void tag_invoke(
+        sequential_scan_update_n_t<ExPolicy>, Iter dest, std::size_t count,
+        T const& val, Op&& op)
+    {
+        if constexpr (scan_use_datapar<Iter, T, Op>::value)
+        {
+            datapar_scan::update(dest, count, val, op);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            sequential_scan_update_n<base_policy_type>(
+                dest, count, val, HPX_FORWARD(Op, op));
+        }
+    }
+}    // namespace hpx::parallel::detail
+#endif
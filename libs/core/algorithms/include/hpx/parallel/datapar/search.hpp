@@ -0,0 +1,128 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_all_any_none.hpp>
+#include <hpx/execution/traits/vector_pack_find.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/search.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Candidate positions are found by comparing whole packs of the searched
+    // sequence with the first element of the needle, only the candidates are
+    // verified element by element. The positions before the first aligned
+    // pack and after the last full pack are checked one by one.
+    struct datapar_search
+    {
+        template <typename Iter, typename FwdIter2, typename Pred,
+            typename Proj1, typename Proj2>
+        static std::size_t call(Iter first, std::size_t count,
+            FwdIter2 s_first, std::size_t diff, Pred& op, Proj1& proj1,
+            Proj2& proj2)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V = traits::vector_pack_type_t<value_type>;
+            using W = std::decay_t<decltype(
+                HPX_INVOKE(proj1, std::declval<V>()))>;
+
+            constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+            std::size_t pos = 0;
+            for (/**/; pos != count && !util::detail::is_data_aligned(first);
+                 (void) ++pos, ++first)
+            {
+                if (search_matches(first, s_first, diff, op, proj1, proj2))
+                    return pos;
+            }
+
+            W const needle(HPX_INVOKE(proj2, *s_first));
+            for (/**/; count - pos >= size; pos += size, first += size)
+            {
+                auto msk = HPX_INVOKE(op,
+                    HPX_INVOKE(proj1,
+                        V(traits::vector_pack_load<V, value_type>::aligned(
+                            first))),
+                    needle);
+
+                int const offset = traits::find_first_of(msk);
+                if (offset == -1)
+                    continue;
+
+                for (auto lane = static_cast<std::size_t>(offset);
+                     lane != size; ++lane)
+                {
+                    if (static_cast<bool>(traits::get(msk, lane)) &&
+                        search_matches(
+                            first + lane, s_first, diff, op, proj1, proj2))
+                    {
+                        return pos + lane;
+                    }
+                }
+            }
+
+            for (/**/; pos != count; (void) ++pos, ++first)
+            {
+                if (search_matches(first, s_first, diff, op, proj1, proj2))
+                    return pos;
+            }
+            return count;
+        }
+    };
+
+    // The needle is broadcast to a vector pack, which requires both sequences
+    // to project to the same type.
+    template <typename Iter, typename FwdIter2, typename Proj1,
+        typename Proj2>
+    inline constexpr bool search_use_datapar_v =
+        hpx::parallel::util::detail::iterator_datapar_compatible_v<Iter> &&
+        std::is_same_v<std::decay_t<decltype(HPX_INVOKE(std::declval<Proj1&>(),
+                           *std::declval<Iter>()))>,
+            std::decay_t<decltype(HPX_INVOKE(
+                std::declval<Proj2&>(), *std::declval<FwdIter2>()))>>;
+
+    template <typename ExPolicy, typename Iter, typename FwdIter2,
+        typename Pred, typename Proj1, typename Proj2,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::size_t tag_invoke(
+        sequential_search_partition_t<ExPolicy>, Iter first,
+        std::size_t count, FwdIter2 s_first, std::size_t diff, Pred& op,
+        Proj1& proj1, Proj2& proj2)
+    {
+        if constexpr (search_use_datapar_v<Iter, FwdIter2, Proj1, Proj2>)
+        {
+            return datapar_search::call(
+                first, count, s_first, diff, op, proj1, proj2);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_search_partition<base_policy_type>(
+                first, count, s_first, diff, op, proj1, proj2);
+        }
+    }
+}    // namespace hpx::parallel::detail
+#endif
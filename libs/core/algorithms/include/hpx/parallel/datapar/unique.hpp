@@ -0,0 +1,119 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_scan.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/unique.hpp>
+#include <hpx/parallel/datapar/copy_if.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Each aligned pack is compared with the pack of the preceding elements,
+    // which is formed by shifting its lanes up by one. The element preceding
+    // a pack is kept in a register as the destination may overlap the input.
+    struct datapar_unique_copy
+    {
+        template <typename InIter, typename OutIter, typename Pred,
+            typename Proj>
+        static OutIter call(InIter first, std::size_t count, OutIter dest,
+            Pred& pred, Proj& proj)
+        {
+            using value_type =
+                typename std::iterator_traits<InIter>::value_type;
+            using V = traits::vector_pack_type_t<value_type>;
+
+            constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+            value_type prev = *first;
+            *dest++ = prev;
+
+            auto step = [&]() {
+                value_type const value = *first;
+                if (!HPX_INVOKE(
+                        pred, HPX_INVOKE(proj, prev), HPX_INVOKE(proj, value)))
+                {
+                    *dest++ = value;
+                }
+                prev = value;
+            };
+
+            for (++first, --count;
+                 count != 0 && !util::detail::is_data_aligned(first);
+                 (void) --count, ++first)
+            {
+                step();
+            }
+
+            if (count >= size)
+            {
+                datapar_compress_buffer<V, value_type> buffer;
+                for (/**/; count >= size;
+                     count -= size, std::advance(first, size))
+                {
+                    V const value(traits::vector_pack_load<V,
+                        value_type>::aligned(first));
+                    V const prev_value = traits::shift_lanes_up(value, prev);
+                    prev =
+                        static_cast<value_type>(traits::get(value, size - 1));
+
+                    dest = buffer.push(value,
+                        !HPX_INVOKE(pred, HPX_INVOKE(proj, prev_value),
+                            HPX_INVOKE(proj, value)),
+                        dest);
+                }
+                dest = buffer.flush(dest);
+            }
+
+            for (/**/; count != 0; (void) --count, ++first)
+            {
+                step();
+            }
+            return dest;
+        }
+    };
+
+    template <typename ExPolicy, typename InIter, typename OutIter,
+        typename Pred, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE OutIter tag_invoke(
+        sequential_unique_copy_n_t<ExPolicy>, InIter first, std::size_t count,
+        OutIter dest, Pred&& pred, Proj&& proj)
+    {
+        if constexpr (hpx::parallel::util::detail::
+                          iterator_datapar_compatible_v<InIter>)
+        {
+            return datapar_unique_copy::call(first, count, dest, pred, proj);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_unique_copy_n<base_policy_type>(first, count,
+                dest, HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+        }
+    }
+}    // namespace hpx::parallel::detail
+#endif
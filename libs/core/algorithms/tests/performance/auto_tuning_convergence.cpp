@@ -0,0 +1,216 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark shows how the auto_tuning_chunk_size executor parameters
+// object converges for for_each and transform_reduce kernels of varying
+// sizes and costs per element. For every invocation it prints the time per
+// element and, once the tuning has converged, the selected chunk size and
+// number of cores. The results can be written to a file (--save-table) and
+// loaded by a subsequent run (--load-table), which will start off using the
+// tuned parameters.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/numeric.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int test_count = 50;
+bool csvoutput = false;
+
+// perform 'work' dependent floating point operations per element
+HPX_FORCEINLINE double kernel(double v, int work)
+{
+    for (int i = 0; i != work; ++i)
+    {
+        v = std::sqrt(v * v + 1.0);
+    }
+    return v;
+}
+
+void print_result(std::string const& name, std::string const& key,
+    std::size_t size, int work, int iteration, std::uint64_t elapsed)
+{
+    std::size_t chunk_size = 0;
+    std::size_t cores = 0;
+    bool const converged =
+        hpx::execution::experimental::chunk_size_tuning_table::get().lookup(
+            key, size, chunk_size, cores);
+
+    double const ns_per_element =
+        static_cast<double>(elapsed) / static_cast<double>(size);
+
+    if (csvoutput)
+    {
+        std::cout << name << "," << size << "," << work << "," << iteration
+                  << ","
+                  << ns_per_element << "," << converged << "," << chunk_size
+                  << "," << cores << "\n"
+                  << std::flush;
+    }
+    else
+    {
+        std::cout << std::left << std::setw(18) << name << std::right
+                  << std::setw(12) << size << std::setw(6) << work
+                  << std::setw(6) << iteration
+                  << std::setw(14) << ns_per_element << " ns/element";
+        if (converged)
+        {
+            std::cout << "  (converged, chunk_size: " << chunk_size
+                      << ", cores: " << cores << ")";
+        }
+        std::cout << "\n" << std::flush;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void measure_for_each(std::size_t size, int work)
+{
+    std::vector<double> data(size, 1.0);
+
+    std::string const key = "for_each<double>/" + std::to_string(work);
+    hpx::execution::experimental::auto_tuning_chunk_size params(
+        key, sizeof(double));
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+        hpx::for_each(hpx::execution::par.with(params), data.begin(),
+            data.end(), [work](double& v) { v = kernel(v, work); });
+
+        print_result("for_each", key, size, work, i,
+            hpx::chrono::high_resolution_clock::now() - start);
+    }
+}
+
+void measure_transform_reduce(std::size_t size, int work)
+{
+    std::vector<double> data(size, 0.0);
+
+    std::string const key = "transform_reduce<double>/" + std::to_string(work);
+    hpx::execution::experimental::auto_tuning_chunk_size params(
+        key, sizeof(double));
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+        [[maybe_unused]] double const result = hpx::transform_reduce(
+            hpx::execution::par.with(params), data.begin(), data.end(), 0.0,
+            std::plus<double>(), [work](double v) { return kernel(v, work); });
+
+        print_result("transform_reduce", key, size, work, i,
+            hpx::chrono::high_resolution_clock::now() - start);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    using hpx::execution::experimental::chunk_size_tuning_table;
+
+    test_count = vm["test_count"].as<int>();
+    csvoutput = vm["csv_output"].as<int>() ? true : false;
+
+    if (vm.count("load-table"))
+    {
+        std::string const filename = vm["load-table"].as<std::string>();
+        if (!chunk_size_tuning_table::get().load(filename))
+        {
+            std::cerr << "could not load tuning table from: " << filename
+                      << "\n";
+        }
+    }
+
+    if (test_count <= 0)
+    {
+        std::cout << "test_count cannot be less than one...\n" << std::flush;
+        return hpx::local::finalize();
+    }
+
+    std::size_t const min_size = vm["min_vector_size"].as<std::size_t>();
+    std::size_t const max_size = vm["max_vector_size"].as<std::size_t>();
+
+    if (csvoutput)
+    {
+        std::cout << "kernel,size,work,iteration,ns_per_element,converged,"
+                     "chunk_size,cores\n";
+    }
+
+    int const max_work = vm["max_work"].as<int>();
+    for (std::size_t size = min_size; size <= max_size; size *= 10)
+    {
+        for (int work = 1; work <= max_work; work *= 16)
+        {
+            measure_for_each(size, work);
+            measure_transform_reduce(size, work);
+        }
+    }
+
+    if (vm.count("save-table"))
+    {
+        std::string const filename = vm["save-table"].as<std::string>();
+        if (!chunk_size_tuning_table::get().save(filename))
+        {
+            std::cerr << "could not save tuning table to: " << filename
+                      << "\n";
+        }
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("min_vector_size",
+            hpx::program_options::value<std::size_t>()->default_value(10000),
+            "smallest size of vectors to run the kernels on")
+        ("max_vector_size",
+            hpx::program_options::value<std::size_t>()->default_value(10000000),
+            "largest size of vectors to run the kernels on")
+        ("max_work",
+            hpx::program_options::value<int>()->default_value(256),
+            "largest number of operations per element (the cost of the "
+            "kernels is varied from 1 to max_work in steps of 16x)")
+        ("test_count",
+            hpx::program_options::value<int>()->default_value(50),
+            "number of invocations per kernel and size")
+        ("csv_output",
+            hpx::program_options::value<int>()->default_value(0),
+            "print results in csv format")
+        ("load-table",
+            hpx::program_options::value<std::string>(),
+            "load tuning results from the given file before running")
+        ("save-table",
+            hpx::program_options::value<std::string>(),
+            "save the tuning results to the given file after running")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,228 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the scalar and the vectorized (simd) versions of the
+// counting, searching, comparing, minimum/maximum, scanning, filtering,
+// and partitioning algorithms.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/format.hpp>
+#include <hpx/init.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+int test_count = 10;
+
+template <typename F>
+double measure(F&& f)
+{
+    std::uint64_t time = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+        f();
+        time += hpx::chrono::high_resolution_clock::now() - start;
+    }
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Note: the vectorized loops require mutable iterators
+template <typename ExPolicy>
+void run_benchmarks(ExPolicy policy, std::string const& name,
+    std::vector<int>& c, std::vector<int>& d, int threshold)
+{
+    std::vector<int> dest(c.size());
+    std::vector<int> tmp(c.size());
+
+    // the predicates are generic to allow for them to be invoked with
+    // vector packs
+    auto less = [threshold](auto v) { return v < threshold; };
+    auto negative = [](auto v) { return v < 0; };
+
+    auto fmt = "{1} ({2}) : {3}(sec)";
+
+    hpx::util::format_to(std::cout, fmt, "count_if", name, measure([&] {
+        (void) hpx::count_if(policy, c.begin(), c.end(), less);
+    })) << std::endl;
+
+    hpx::util::format_to(std::cout, fmt, "all_of", name, measure([&] {
+        (void) hpx::all_of(policy, c.begin(), c.end(),
+            [](auto v) { return v >= 0; });
+    })) << std::endl;
+
+    hpx::util::format_to(std::cout, fmt, "none_of", name, measure([&] {
+        (void) hpx::none_of(policy, c.begin(), c.end(), negative);
+    })) << std::endl;
+
+    hpx::util::format_to(std::cout, fmt, "any_of", name, measure([&] {
+        (void) hpx::any_of(policy, c.begin(), c.end(), negative);
+    })) << std::endl;
+
+    hpx::util::format_to(std::cout, fmt, "lexicographical_compare", name,
+        measure([&] {
+            (void) hpx::lexicographical_compare(
+                policy, c.begin(), c.end(), d.begin(), d.end());
+        }))
+        << std::endl;
+
+    hpx::util::format_to(std::cout, fmt, "min_element", name, measure([&] {
+        (void) hpx::min_element(policy, c.begin(), c.end());
+    })) << std::endl;
+
+    hpx::util::format_to(std::cout, fmt, "max_element", name, measure([&] {
+        (void) hpx::max_element(policy, c.begin(), c.end());
+    })) << std::endl;
+
+    hpx::util::format_to(std::cout, fmt, "minmax_element", name, measure([&] {
+        (void) hpx::minmax_element(policy, c.begin(), c.end());
+    })) << std::endl;
+
+    // the needle is taken from the end of the sequence, which makes sure it
+    // is found close to the end
+    std::vector<int> needle(c.end() - (std::min)(c.size(), std::size_t(4)),
+        c.end());
+    hpx::util::format_to(std::cout, fmt, "search", name, measure([&] {
+        (void) hpx::search(
+            policy, c.begin(), c.end(), needle.begin(), needle.end());
+    })) << std::endl;
+
+    // the scans are vectorized only if both sequences can be aligned at the
+    // same time, which is usually the case for large allocations
+    hpx::util::format_to(std::cout, fmt, "inclusive_scan", name, measure([&] {
+        (void) hpx::inclusive_scan(policy, c.begin(), c.end(), dest.begin());
+    })) << std::endl;
+
+    hpx::util::format_to(std::cout, fmt, "exclusive_scan", name, measure([&] {
+        (void) hpx::exclusive_scan(
+            policy, c.begin(), c.end(), dest.begin(), 0);
+    })) << std::endl;
+
+    hpx::util::format_to(std::cout, fmt, "copy_if", name, measure([&] {
+        (void) hpx::copy_if(policy, c.begin(), c.end(), dest.begin(), less);
+    })) << std::endl;
+
+    hpx::util::format_to(std::cout, fmt, "remove_copy_if", name, measure([&] {
+        (void) hpx::remove_copy_if(
+            policy, c.begin(), c.end(), dest.begin(), less);
+    })) << std::endl;
+
+    // the time needed for restoring the input data is included
+    hpx::util::format_to(std::cout, fmt, "remove_if", name, measure([&] {
+        std::copy(c.begin(), c.end(), tmp.begin());
+        (void) hpx::remove_if(policy, tmp.begin(), tmp.end(), less);
+    })) << std::endl;
+
+    hpx::util::format_to(std::cout, fmt, "unique_copy", name, measure([&] {
+        (void) hpx::unique_copy(policy, c.begin(), c.end(), dest.begin());
+    })) << std::endl;
+
+    hpx::util::format_to(std::cout, fmt, "unique", name, measure([&] {
+        std::copy(c.begin(), c.end(), tmp.begin());
+        (void) hpx::unique(policy, tmp.begin(), tmp.end());
+    })) << std::endl;
+
+    hpx::util::format_to(std::cout, fmt, "partition_copy", name, measure([&] {
+        (void) hpx::partition_copy(
+            policy, c.begin(), c.end(), dest.begin(), tmp.begin(), less);
+    })) << std::endl;
+
+    hpx::util::format_to(std::cout, fmt, "partition", name, measure([&] {
+        std::copy(c.begin(), c.end(), tmp.begin());
+        (void) hpx::partition(policy, tmp.begin(), tmp.end(), less);
+    })) << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const vector_size = vm["vector_size"].as<std::size_t>();
+    int const random_range = vm["random_range"].as<int>();
+    int const selectivity = vm["selectivity"].as<int>();
+    test_count = vm["test_count"].as<int>();
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed         : " << seed << std::endl;
+    std::cout << "vector_size  : " << vector_size << std::endl;
+    std::cout << "random_range : " << random_range << std::endl;
+    std::cout << "selectivity  : " << selectivity << "%" << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<> dis(0, random_range - 1);
+
+    std::vector<int> c(vector_size);
+    for (auto& v : c)
+        v = dis(gen);
+
+    // the sequences differ in their last element only
+    std::vector<int> d = c;
+    if (!d.empty())
+        ++d.back();
+
+    // the filtering algorithms select the given percentage of the elements
+    int const threshold = static_cast<int>(
+        (static_cast<std::int64_t>(random_range) * selectivity) / 100);
+
+    using namespace hpx::execution;
+    run_benchmarks(seq, "seq", c, d, threshold);
+    run_benchmarks(simd, "simd", c, d, threshold);
+    run_benchmarks(par, "par", c, d, threshold);
+    run_benchmarks(par_simd, "par_simd", c, d, threshold);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size",
+            value<std::size_t>()->default_value(10000000),
+            "size of vector (default: 10000000)")
+        ("random_range",
+            value<int>()->default_value(1000),
+            "range of random numbers [0, x) (default: 1000)")
+        ("selectivity",
+            value<int>()->default_value(50),
+            "percentage of elements selected by copy_if and friends "
+            "(default: 50)")
+        ("test_count",
+            value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
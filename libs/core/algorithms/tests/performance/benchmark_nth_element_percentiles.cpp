@@ -0,0 +1,151 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the computation of percentiles (nth_element) and of
+// the smallest elements of a large set of samples (partial_sort). The samples
+// are drawn from an exponential distribution and are rounded, which results
+// in many equivalent values (similar to measured latencies).
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/format.hpp>
+#include <hpx/init.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+int test_count = 10;
+
+// measure the time needed for f(), the time needed for restoring the input
+// data (as done by reset()) is not included
+template <typename Reset, typename F>
+double measure(Reset&& reset, F&& f)
+{
+    std::uint64_t time = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        reset();
+
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+        f();
+        time += hpx::chrono::high_resolution_clock::now() - start;
+    }
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const vector_size = vm["vector_size"].as<std::size_t>();
+    test_count = vm["test_count"].as<int>();
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed         : " << seed << std::endl;
+    std::cout << "vector_size  : " << vector_size << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    std::mt19937 gen(seed);
+    std::exponential_distribution<> dis(1e-3);
+
+    std::vector<std::uint64_t> samples(vector_size);
+    for (auto& v : samples)
+        v = static_cast<std::uint64_t>(dis(gen));
+
+    std::vector<std::uint64_t> data(vector_size);
+    auto reset = [&] {
+        std::copy(samples.begin(), samples.end(), data.begin());
+    };
+
+    auto fmt = "{1} ({2}) : {3}(sec)";
+
+    for (double percentile : {0.5, 0.9, 0.99, 0.999})
+    {
+        auto const nth = data.begin() +
+            static_cast<std::ptrdiff_t>(percentile * (vector_size - 1));
+        std::string const name =
+            hpx::util::format("nth_element, p{}", percentile * 100);
+
+        hpx::util::format_to(std::cout, fmt, name, "std", measure(reset, [&] {
+            std::nth_element(data.begin(), nth, data.end());
+        })) << std::endl;
+
+        hpx::util::format_to(std::cout, fmt, name, "seq", measure(reset, [&] {
+            hpx::nth_element(
+                hpx::execution::seq, data.begin(), nth, data.end());
+        })) << std::endl;
+
+        hpx::util::format_to(std::cout, fmt, name, "par", measure(reset, [&] {
+            hpx::nth_element(
+                hpx::execution::par, data.begin(), nth, data.end());
+        })) << std::endl;
+    }
+
+    for (double fraction : {0.001, 0.01, 0.1})
+    {
+        auto const middle = data.begin() +
+            static_cast<std::ptrdiff_t>(fraction * vector_size);
+        std::string const name =
+            hpx::util::format("partial_sort, {}%", fraction * 100);
+
+        hpx::util::format_to(std::cout, fmt, name, "std", measure(reset, [&] {
+            std::partial_sort(data.begin(), middle, data.end());
+        })) << std::endl;
+
+        hpx::util::format_to(std::cout, fmt, name, "seq", measure(reset, [&] {
+            hpx::partial_sort(
+                hpx::execution::seq, data.begin(), middle, data.end());
+        })) << std::endl;
+
+        hpx::util::format_to(std::cout, fmt, name, "par", measure(reset, [&] {
+            hpx::partial_sort(
+                hpx::execution::par, data.begin(), middle, data.end());
+        })) << std::endl;
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size",
+            value<std::size_t>()->default_value(10000000),
+            "number of samples (default: 10000000)")
+        ("test_count",
+            value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
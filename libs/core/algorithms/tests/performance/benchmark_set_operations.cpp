@@ -0,0 +1,162 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of the set operations on two large
+// sorted sequences holding many equivalent elements. The reported memory is
+// the size of the input and output sequences, the parallel algorithms do not
+// allocate any intermediate buffers proportional to the input size.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/format.hpp>
+#include <hpx/init.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+int test_count = 10;
+
+template <typename F>
+double measure(F&& f)
+{
+    std::uint64_t time = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+        f();
+        time += hpx::chrono::high_resolution_clock::now() - start;
+    }
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void run_benchmarks(ExPolicy policy, std::string const& name,
+    std::vector<std::uint64_t> const& c, std::vector<std::uint64_t> const& d)
+{
+    std::vector<std::uint64_t> dest(c.size() + d.size());
+
+    // report the number of input elements processed per second
+    double const elements = static_cast<double>(c.size() + d.size());
+    auto fmt = "{1} ({2}) : {3}(sec), {4}(Melem/sec), {5}(MB)";
+
+    auto report = [&](char const* algorithm, double time,
+                      std::vector<std::uint64_t>::iterator last) {
+        std::size_t const output =
+            static_cast<std::size_t>(last - dest.begin());
+        std::size_t const memory =
+            (c.size() + d.size() + output) * sizeof(std::uint64_t);
+
+        hpx::util::format_to(std::cout, fmt, algorithm, name, time,
+            elements / time * 1e-6, memory / (1024 * 1024))
+            << std::endl;
+    };
+
+    auto last = dest.begin();
+
+    double time = measure([&] {
+        last = hpx::set_union(
+            policy, c.begin(), c.end(), d.begin(), d.end(), dest.begin());
+    });
+    report("set_union", time, last);
+
+    time = measure([&] {
+        last = hpx::set_intersection(
+            policy, c.begin(), c.end(), d.begin(), d.end(), dest.begin());
+    });
+    report("set_intersection", time, last);
+
+    time = measure([&] {
+        last = hpx::set_difference(
+            policy, c.begin(), c.end(), d.begin(), d.end(), dest.begin());
+    });
+    report("set_difference", time, last);
+
+    time = measure([&] {
+        last = hpx::set_symmetric_difference(
+            policy, c.begin(), c.end(), d.begin(), d.end(), dest.begin());
+    });
+    report("set_symmetric_difference", time, last);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const vector_size = vm["vector_size"].as<std::size_t>();
+    std::uint64_t const random_range =
+        vm["random_range"].as<std::uint64_t>();
+    test_count = vm["test_count"].as<int>();
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed         : " << seed << std::endl;
+    std::cout << "vector_size  : " << vector_size << std::endl;
+    std::cout << "random_range : " << random_range << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<std::uint64_t> dis(0, random_range - 1);
+
+    std::vector<std::uint64_t> c(vector_size);
+    std::vector<std::uint64_t> d(vector_size);
+    for (auto& v : c)
+        v = dis(gen);
+    for (auto& v : d)
+        v = dis(gen);
+
+    hpx::sort(hpx::execution::par, c.begin(), c.end());
+    hpx::sort(hpx::execution::par, d.begin(), d.end());
+
+    using namespace hpx::execution;
+    run_benchmarks(seq, "seq", c, d);
+    run_benchmarks(par, "par", c, d);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size",
+            value<std::size_t>()->default_value(100000000),
+            "size of each of the input sequences (default: 100000000)")
+        ("random_range",
+            value<std::uint64_t>()->default_value(10000000),
+            "range of random numbers [0, x) (default: 10000000)")
+        ("test_count",
+            value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
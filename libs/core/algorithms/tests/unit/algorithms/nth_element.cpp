@@ -123,6 +123,32 @@ void test_nth_element_async(ExPolicy p, IteratorTag)
     }
 }
 
+// exercise the parallel selection, including many equivalent elements
+template <typename ExPolicy>
+void test_nth_element_large(ExPolicy policy, std::size_t range)
+{
+    std::size_t const size = 1 << 20;
+
+    std::uniform_int_distribution<std::size_t> dis(0, range - 1);
+    std::vector<std::size_t> c(size);
+    std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+    std::vector<std::size_t> d = c;
+
+    for (std::size_t n : {std::size_t(0), size / 100, size / 2,
+             size - size / 1000, size - 1})
+    {
+        hpx::nth_element(
+            policy, std::begin(c), std::begin(c) + n, std::end(c));
+        std::nth_element(std::begin(d), std::begin(d) + n, std::end(d));
+
+        HPX_TEST_EQ(c[n], d[n]);
+        HPX_TEST(std::all_of(std::begin(c), std::begin(c) + n,
+            [&](std::size_t v) { return v <= c[n]; }));
+        HPX_TEST(std::all_of(std::begin(c) + n, std::end(c),
+            [&](std::size_t v) { return v >= c[n]; }));
+    }
+}
+
 template <typename IteratorTag>
 void test_nth_element()
 {
@@ -139,6 +165,11 @@ void test_nth_element()
 void nth_element_test()
 {
     test_nth_element<std::random_access_iterator_tag>();
+
+    using namespace hpx::execution;
+    test_nth_element_large(par, 1 << 30);
+    test_nth_element_large(par, 3);
+    test_nth_element_large(par_unseq, 1000);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
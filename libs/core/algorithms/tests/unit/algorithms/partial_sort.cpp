@@ -11,6 +11,7 @@
 #include <hpx/modules/testing.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <random>
@@ -109,6 +110,28 @@ void test_partial_sort_async(ExPolicy p, IteratorTag)
     }
 }
 
+// exercise the parallel selection, including many equivalent elements
+template <typename ExPolicy>
+void test_partial_sort_large(ExPolicy policy, std::uint64_t range)
+{
+    std::size_t const size = 1 << 20;
+
+    std::uniform_int_distribution<std::uint64_t> dis(0, range - 1);
+    std::vector<std::uint64_t> A(size);
+    std::generate(A.begin(), A.end(), [&]() { return dis(gen); });
+
+    std::vector<std::uint64_t> sorted = A;
+    std::sort(sorted.begin(), sorted.end());
+
+    for (std::size_t n : {std::size_t(1), size / 100, size / 2, size})
+    {
+        std::vector<std::uint64_t> B = A;
+        hpx::partial_sort(policy, B.begin(), B.begin() + n, B.end());
+
+        HPX_TEST(std::equal(B.begin(), B.begin() + n, sorted.begin()));
+    }
+}
+
 template <typename IteratorTag>
 void test_partial_sort()
 {
@@ -126,6 +149,10 @@ void partial_sort_test()
 {
     test_partial_sort<std::random_access_iterator_tag>();
     test_partial_sort<std::forward_iterator_tag>();
+
+    using namespace hpx::execution;
+    test_partial_sort_large(par, 1ull << 40);
+    test_partial_sort_large(par, 3);
 }
 
 int hpx_main(hpx::program_options::variables_map& vm)
@@ -224,6 +224,52 @@ void set_intersection_test2()
     test_set_intersection2<std::forward_iterator_tag>();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// the sequences contain long runs of equivalent elements which have to be
+// handled by the same partition
+template <typename ExPolicy>
+void test_set_intersection3(ExPolicy&& policy)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    for (std::size_t range : {1, 3, 100, 10000})
+    {
+        std::vector<std::size_t> c1 = test::random_fill(100007);
+        std::vector<std::size_t> c2 = test::random_fill(50021);
+        for (auto& v : c1)
+            v %= range;
+        for (auto& v : c2)
+            v %= range;
+
+        std::sort(std::begin(c1), std::end(c1));
+        std::sort(std::begin(c2), std::end(c2));
+
+        std::vector<std::size_t> c3(c1.size() + c2.size());
+        std::vector<std::size_t> c4(c1.size() + c2.size());
+
+        auto result = hpx::set_intersection(policy, std::begin(c1),
+            std::end(c1), std::begin(c2), std::end(c2), std::begin(c3));
+
+        auto expected = std::set_intersection(std::begin(c1), std::end(c1),
+            std::begin(c2), std::end(c2), std::begin(c4));
+
+        // verify values
+        HPX_TEST_EQ(std::distance(std::begin(c3), result),
+            std::distance(std::begin(c4), expected));
+        HPX_TEST(std::equal(std::begin(c3), std::end(c3), std::begin(c4)));
+    }
+}
+
+void set_intersection_test3()
+{
+    using namespace hpx::execution;
+
+    test_set_intersection3(seq);
+    test_set_intersection3(par);
+    test_set_intersection3(par_unseq);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_set_intersection_exception(IteratorTag)
@@ -536,6 +582,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     set_intersection_test1();
     set_intersection_test2();
+    set_intersection_test3();
     set_intersection_exception_test();
     set_intersection_bad_alloc_test();
     return hpx::local::finalize();
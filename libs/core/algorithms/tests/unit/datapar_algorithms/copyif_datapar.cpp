@@ -0,0 +1,191 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen(std::random_device{}());
+
+std::vector<int> make_data(std::size_t size)
+{
+    std::uniform_int_distribution<> dis(-1000, 1000);
+
+    std::vector<int> c(size);
+    std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+    return c;
+}
+
+// the predicate has to be generic to be invoked with vector packs
+struct is_positive
+{
+    template <typename T>
+    auto operator()(T const& v) const
+    {
+        return v > 0;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_copy_if(ExPolicy policy, IteratorTag)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    // use odd sizes to exercise the non-vectorized head and tail parts
+    for (std::size_t size : {0, 1, 7, 10007})
+    {
+        std::vector<int> c = make_data(size);
+        std::vector<int> d(c.size());
+        std::vector<int> expected;
+        std::copy_if(std::begin(c), std::end(c), std::back_inserter(expected),
+            is_positive());
+
+        auto result = hpx::copy_if(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), std::begin(d), is_positive());
+
+        HPX_TEST_EQ(std::distance(std::begin(d), result),
+            static_cast<std::ptrdiff_t>(expected.size()));
+        HPX_TEST(std::equal(
+            std::begin(expected), std::end(expected), std::begin(d)));
+    }
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_copy_if_async(ExPolicy p, IteratorTag)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<int> c = make_data(10007);
+    std::vector<int> d(c.size());
+    std::vector<int> expected;
+    std::copy_if(std::begin(c), std::end(c), std::back_inserter(expected),
+        is_positive());
+
+    auto f = hpx::copy_if(p, iterator(std::begin(c)), iterator(std::end(c)),
+        std::begin(d), is_positive());
+    f.wait();
+
+    HPX_TEST(
+        std::equal(std::begin(expected), std::end(expected), std::begin(d)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_remove_copy_if(ExPolicy policy)
+{
+    std::vector<int> c = make_data(10007);
+    std::vector<int> d(c.size());
+    std::vector<int> expected;
+    std::remove_copy_if(std::begin(c), std::end(c),
+        std::back_inserter(expected), is_positive());
+
+    auto result = hpx::remove_copy_if(
+        policy, std::begin(c), std::end(c), std::begin(d), is_positive());
+
+    HPX_TEST_EQ(std::distance(std::begin(d), result),
+        static_cast<std::ptrdiff_t>(expected.size()));
+    HPX_TEST(
+        std::equal(std::begin(expected), std::end(expected), std::begin(d)));
+}
+
+template <typename ExPolicy>
+void test_remove_if(ExPolicy policy)
+{
+    std::vector<int> c = make_data(10007);
+    std::vector<int> expected = c;
+    expected.erase(
+        std::remove_if(std::begin(expected), std::end(expected), is_positive()),
+        std::end(expected));
+
+    auto result =
+        hpx::remove_if(policy, std::begin(c), std::end(c), is_positive());
+
+    HPX_TEST_EQ(std::distance(std::begin(c), result),
+        static_cast<std::ptrdiff_t>(expected.size()));
+    HPX_TEST(
+        std::equal(std::begin(expected), std::end(expected), std::begin(c)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_copy_if()
+{
+    using namespace hpx::execution;
+
+    test_copy_if(simd, IteratorTag());
+    test_copy_if(par_simd, IteratorTag());
+
+    test_copy_if_async(simd(task), IteratorTag());
+    test_copy_if_async(par_simd(task), IteratorTag());
+}
+
+void copy_if_test()
+{
+    using namespace hpx::execution;
+
+    test_copy_if<std::random_access_iterator_tag>();
+    test_copy_if<std::forward_iterator_tag>();
+
+    test_remove_copy_if(simd);
+    test_remove_copy_if(par_simd);
+
+    test_remove_if(simd);
+    test_remove_if(par_simd);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    copy_if_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
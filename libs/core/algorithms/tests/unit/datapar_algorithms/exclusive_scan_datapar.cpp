@@ -0,0 +1,150 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen(std::random_device{}());
+
+std::vector<int> make_data(std::size_t size)
+{
+    std::uniform_int_distribution<> dis(-100, 100);
+
+    std::vector<int> c(size);
+    std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_exclusive_scan(ExPolicy policy, IteratorTag)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    // use odd sizes to exercise the non-vectorized head and tail parts
+    for (std::size_t size : {0, 1, 7, 10007})
+    {
+        std::vector<int> c = make_data(size);
+        std::vector<int> expected(size);
+        std::exclusive_scan(std::begin(c), std::end(c), std::begin(expected),
+            0, std::plus<>());
+
+        // the vectorized loop is used only if both sequences can be aligned
+        // at the same time, shifting the destination makes sure that this
+        // happens for one of the offsets
+        for (std::size_t offset = 0; offset != 16; ++offset)
+        {
+            std::vector<int> d(size + offset);
+            auto dest = std::next(std::begin(d), offset);
+
+            auto result = hpx::exclusive_scan(policy, iterator(std::begin(c)),
+                iterator(std::end(c)), dest, 0);
+            HPX_TEST(result == std::end(d));
+            HPX_TEST(std::equal(dest, std::end(d), std::begin(expected)));
+
+            hpx::exclusive_scan(policy, iterator(std::begin(c)),
+                iterator(std::end(c)), dest, 42, std::plus<int>());
+            HPX_TEST(std::equal(dest, std::end(d), std::begin(expected),
+                [](int lhs, int rhs) { return lhs == rhs + 42; }));
+        }
+    }
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_exclusive_scan_async(ExPolicy p, IteratorTag)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<int> c = make_data(10007);
+    std::vector<int> d(c.size());
+
+    auto f = hpx::exclusive_scan(p, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), 42, std::plus<>());
+    f.wait();
+
+    std::vector<int> expected(c.size());
+    std::exclusive_scan(std::begin(c), std::end(c), std::begin(expected), 42,
+        std::plus<>());
+
+    HPX_TEST(f.get() == std::end(d));
+    HPX_TEST(d == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_exclusive_scan()
+{
+    using namespace hpx::execution;
+
+    test_exclusive_scan(simd, IteratorTag());
+    test_exclusive_scan(par_simd, IteratorTag());
+
+    test_exclusive_scan_async(simd(task), IteratorTag());
+    test_exclusive_scan_async(par_simd(task), IteratorTag());
+}
+
+void exclusive_scan_test()
+{
+    test_exclusive_scan<std::random_access_iterator_tag>();
+    test_exclusive_scan<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    exclusive_scan_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,145 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen(std::random_device{}());
+
+template <typename ExPolicy, typename IteratorTag>
+void test_lexicographical_compare(ExPolicy policy, IteratorTag)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<int> c(10007);
+    std::iota(std::begin(c), std::end(c), 0);
+
+    // equal sequences
+    {
+        std::vector<int> d = c;
+        HPX_TEST(!hpx::lexicographical_compare(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), std::begin(d), std::end(d)));
+    }
+
+    // proper prefixes are less, independently of which sequence is shorter
+    {
+        std::vector<int> d(std::begin(c), std::end(c) - 1);
+        HPX_TEST(!hpx::lexicographical_compare(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), std::begin(d), std::end(d)));
+        HPX_TEST(hpx::lexicographical_compare(policy, iterator(std::begin(d)),
+            iterator(std::end(d)), std::begin(c), std::end(c)));
+    }
+
+    // the first differing element decides
+    {
+        std::uniform_int_distribution<std::size_t> dis(0, c.size() - 1);
+        std::size_t const pos = dis(gen);
+
+        std::vector<int> d = c;
+        ++d[pos];
+        if (pos + 1 != d.size())
+        {
+            d.back() = -1;
+        }
+
+        HPX_TEST(hpx::lexicographical_compare(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), std::begin(d), std::end(d)));
+        HPX_TEST(!hpx::lexicographical_compare(policy, iterator(std::begin(d)),
+            iterator(std::end(d)), std::begin(c), std::end(c)));
+    }
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_lexicographical_compare_async(ExPolicy p, IteratorTag)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<int> c(10007);
+    std::iota(std::begin(c), std::end(c), 0);
+
+    std::vector<int> d = c;
+    ++d[c.size() / 2];
+
+    hpx::future<bool> f = hpx::lexicographical_compare(p,
+        iterator(std::begin(c)), iterator(std::end(c)), std::begin(d),
+        std::end(d));
+    f.wait();
+
+    HPX_TEST(f.get());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_lexicographical_compare()
+{
+    using namespace hpx::execution;
+
+    test_lexicographical_compare(simd, IteratorTag());
+    test_lexicographical_compare(par_simd, IteratorTag());
+
+    test_lexicographical_compare_async(simd(task), IteratorTag());
+    test_lexicographical_compare_async(par_simd(task), IteratorTag());
+}
+
+void lexicographical_compare_test()
+{
+    test_lexicographical_compare<std::random_access_iterator_tag>();
+    test_lexicographical_compare<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    lexicographical_compare_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
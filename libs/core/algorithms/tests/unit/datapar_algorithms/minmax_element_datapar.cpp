@@ -0,0 +1,151 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen(std::random_device{}());
+
+// a small range of values makes sure the smallest and largest values occur
+// more than once
+std::vector<int> make_data(std::size_t size)
+{
+    std::uniform_int_distribution<> dis(-10, 10);
+
+    std::vector<int> c(size);
+    std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+    return c;
+}
+
+// the comparison has to be generic to be invoked with vector packs
+struct greater
+{
+    template <typename T>
+    auto operator()(T const& lhs, T const& rhs) const
+    {
+        return lhs > rhs;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_minmax_element(ExPolicy policy, IteratorTag)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    // use odd sizes to exercise the non-vectorized head and tail parts
+    for (std::size_t size : {0, 1, 7, 10007})
+    {
+        std::vector<int> c = make_data(size);
+        iterator first(std::begin(c));
+        iterator last(std::end(c));
+
+        // the first smallest and the last largest elements are expected
+        auto min_expected = hpx::min_element(hpx::execution::seq, first, last);
+        auto max_expected = hpx::max_element(hpx::execution::seq, first, last);
+
+        HPX_TEST(hpx::min_element(policy, first, last) == min_expected);
+        HPX_TEST(hpx::max_element(policy, first, last) == max_expected);
+
+        auto result = hpx::minmax_element(policy, first, last);
+        HPX_TEST(result.min == min_expected);
+        HPX_TEST(result.max == max_expected);
+
+        HPX_TEST(hpx::min_element(policy, first, last, greater()) ==
+            hpx::min_element(hpx::execution::seq, first, last, greater()));
+    }
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_minmax_element_async(ExPolicy p, IteratorTag)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<int> c = make_data(10007);
+    iterator first(std::begin(c));
+    iterator last(std::end(c));
+
+    auto f = hpx::minmax_element(p, first, last);
+    auto result = f.get();
+
+    HPX_TEST(
+        result.min == hpx::min_element(hpx::execution::seq, first, last));
+    HPX_TEST(
+        result.max == hpx::max_element(hpx::execution::seq, first, last));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_minmax_element()
+{
+    using namespace hpx::execution;
+
+    test_minmax_element(simd, IteratorTag());
+    test_minmax_element(par_simd, IteratorTag());
+
+    test_minmax_element_async(simd(task), IteratorTag());
+    test_minmax_element_async(par_simd(task), IteratorTag());
+}
+
+void minmax_element_test()
+{
+    test_minmax_element<std::random_access_iterator_tag>();
+    test_minmax_element<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    minmax_element_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,211 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen(std::random_device{}());
+
+std::vector<int> make_data(std::size_t size)
+{
+    std::uniform_int_distribution<> dis(-100, 100);
+
+    std::vector<int> c(size);
+    std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+    return c;
+}
+
+struct less_than
+{
+    template <typename T>
+    auto operator()(T const& value) const
+    {
+        return value < T(pivot);
+    }
+
+    int pivot;
+};
+
+// partition is not stable, compare the sorted groups
+bool equal_groups(
+    std::vector<int> lhs, std::vector<int>::iterator lhs_middle, int pivot)
+{
+    std::vector<int> rhs = lhs;
+    auto const rhs_middle = std::stable_partition(
+        std::begin(rhs), std::end(rhs), less_than{pivot});
+
+    if (std::distance(std::begin(lhs), lhs_middle) !=
+        std::distance(std::begin(rhs), rhs_middle))
+    {
+        return false;
+    }
+
+    std::sort(std::begin(lhs), lhs_middle);
+    std::sort(lhs_middle, std::end(lhs));
+    std::sort(std::begin(rhs), rhs_middle);
+    std::sort(rhs_middle, std::end(rhs));
+    return lhs == rhs;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_partition(ExPolicy policy, IteratorTag)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    // use odd sizes to exercise the non-vectorized head and tail parts
+    for (std::size_t size : {0, 1, 7, 10007})
+    {
+        std::vector<int> const data = make_data(size + 16);
+
+        // shifting the input exercises all lengths of the head part, the
+        // pivots create groups of (almost) all, half, or none of the elements
+        for (std::size_t offset = 0; offset != 16; ++offset)
+        {
+            for (int pivot : {-95, 0, 95})
+            {
+                std::vector<int> c(std::next(std::begin(data), offset),
+                    std::next(std::begin(data), offset + size));
+                std::vector<int> orig = c;
+
+                auto middle = hpx::partition(policy, iterator(std::begin(c)),
+                    iterator(std::end(c)), less_than{pivot});
+
+                HPX_TEST(std::is_partitioned(
+                    std::begin(c), std::end(c), less_than{pivot}));
+                HPX_TEST(std::partition_point(std::begin(c), std::end(c),
+                             less_than{pivot}) == middle.base());
+
+                std::vector<int> expected = orig;
+                auto expected_middle = std::stable_partition(
+                    std::begin(expected), std::end(expected),
+                    less_than{pivot});
+                HPX_TEST(equal_groups(c,
+                    std::next(std::begin(c),
+                        std::distance(std::begin(expected), expected_middle)),
+                    pivot));
+
+                // partition_copy is stable
+                std::vector<int> d_true(size);
+                std::vector<int> d_false(size);
+                auto result = hpx::partition_copy(policy,
+                    iterator(std::begin(orig)), iterator(std::end(orig)),
+                    std::begin(d_true), std::begin(d_false),
+                    less_than{pivot});
+
+                HPX_TEST(std::equal(std::begin(d_true), result.first,
+                    std::begin(expected), expected_middle));
+                HPX_TEST(std::equal(std::begin(d_false), result.second,
+                    expected_middle, std::end(expected)));
+            }
+        }
+    }
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_partition_async(ExPolicy p, IteratorTag)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<int> c = make_data(10007);
+    std::vector<int> expected = c;
+    auto expected_middle = std::stable_partition(
+        std::begin(expected), std::end(expected), less_than{0});
+
+    std::vector<int> d_true(c.size());
+    std::vector<int> d_false(c.size());
+    auto f1 = hpx::partition_copy(p, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d_true), std::begin(d_false),
+        less_than{0});
+    f1.wait();
+
+    auto result = f1.get();
+    HPX_TEST(std::equal(std::begin(d_true), result.first,
+        std::begin(expected), expected_middle));
+    HPX_TEST(std::equal(std::begin(d_false), result.second, expected_middle,
+        std::end(expected)));
+
+    auto f2 = hpx::partition(
+        p, iterator(std::begin(c)), iterator(std::end(c)), less_than{0});
+    f2.wait();
+
+    auto middle = f2.get().base();
+    HPX_TEST(std::is_partitioned(std::begin(c), std::end(c), less_than{0}));
+    HPX_TEST(equal_groups(c, middle, 0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_partition()
+{
+    using namespace hpx::execution;
+
+    test_partition(simd, IteratorTag());
+    test_partition(par_simd, IteratorTag());
+
+    test_partition_async(simd(task), IteratorTag());
+    test_partition_async(par_simd(task), IteratorTag());
+}
+
+void partition_test()
+{
+    test_partition<std::random_access_iterator_tag>();
+    test_partition<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    partition_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,145 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen(std::random_device{}());
+
+// a small range of values makes sure the first element of the needle occurs
+// frequently, which exercises the verification of the candidates
+std::vector<int> make_data(std::size_t size)
+{
+    std::uniform_int_distribution<> dis(0, 3);
+
+    std::vector<int> c(size);
+    std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_search(ExPolicy policy, IteratorTag)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    // the results are expected to be the same as for the corresponding
+    // non-vectorized execution policy
+    auto non_simd_policy = hpx::execution::experimental::to_non_simd(policy);
+
+    // use odd sizes to exercise the non-vectorized head and tail parts
+    for (std::size_t size : {1, 7, 10007})
+    {
+        std::vector<int> c = make_data(size);
+        iterator first(std::begin(c));
+        iterator last(std::end(c));
+
+        // the needle is not found
+        std::vector<int> h = {0, 1, 2, 4};
+        HPX_TEST(hpx::search(policy, first, last, std::begin(h),
+                     std::end(h)) == hpx::search(non_simd_policy, first, last,
+                                         std::begin(h), std::end(h)));
+
+        // the needle is found at the end of the sequence
+        std::size_t const needle_size = (std::min)(size, std::size_t(5));
+        h.assign(std::end(c) - needle_size, std::end(c));
+
+        auto result =
+            hpx::search(policy, first, last, std::begin(h), std::end(h));
+        HPX_TEST(result.base() ==
+            std::search(
+                std::begin(c), std::end(c), std::begin(h), std::end(h)));
+    }
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_search_async(ExPolicy p, IteratorTag)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<int> c = make_data(10007);
+    std::vector<int> h(std::end(c) - 5, std::end(c));
+
+    auto f = hpx::search(p, iterator(std::begin(c)), iterator(std::end(c)),
+        std::begin(h), std::end(h));
+    f.wait();
+
+    HPX_TEST(f.get().base() ==
+        std::search(std::begin(c), std::end(c), std::begin(h), std::end(h)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_search()
+{
+    using namespace hpx::execution;
+
+    test_search(simd, IteratorTag());
+    test_search(par_simd, IteratorTag());
+
+    test_search_async(simd(task), IteratorTag());
+    test_search_async(par_simd(task), IteratorTag());
+}
+
+void search_test()
+{
+    test_search<std::random_access_iterator_tag>();
+    test_search<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    search_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,154 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen(std::random_device{}());
+
+// use a small range of values to create runs of equal elements
+std::vector<int> make_data(std::size_t size)
+{
+    std::uniform_int_distribution<> dis(0, 2);
+
+    std::vector<int> c(size);
+    std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_unique(ExPolicy policy, IteratorTag)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    // use odd sizes to exercise the non-vectorized head and tail parts
+    for (std::size_t size : {0, 1, 7, 10007})
+    {
+        std::vector<int> const data = make_data(size + 16);
+
+        // shifting the input exercises all lengths of the head part
+        for (std::size_t offset = 0; offset != 16; ++offset)
+        {
+            std::vector<int> c(std::next(std::begin(data), offset),
+                std::next(std::begin(data), offset + size));
+            std::vector<int> expected = c;
+            expected.erase(std::unique(std::begin(expected),
+                               std::end(expected), std::equal_to<>()),
+                std::end(expected));
+
+            std::vector<int> d(size);
+            auto dest = hpx::unique_copy(policy, iterator(std::begin(c)),
+                iterator(std::end(c)), std::begin(d), std::equal_to<>());
+            HPX_TEST(std::equal(std::begin(d), dest, std::begin(expected),
+                std::end(expected)));
+
+            auto result = hpx::unique(policy, iterator(std::begin(c)),
+                iterator(std::end(c)), std::equal_to<>());
+            HPX_TEST(std::equal(std::begin(c), result.base(),
+                std::begin(expected), std::end(expected)));
+        }
+    }
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_unique_async(ExPolicy p, IteratorTag)
+{
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<int> c = make_data(10007);
+    std::vector<int> expected = c;
+    expected.erase(std::unique(std::begin(expected), std::end(expected)),
+        std::end(expected));
+
+    std::vector<int> d(c.size());
+    auto f1 = hpx::unique_copy(
+        p, iterator(std::begin(c)), iterator(std::end(c)), std::begin(d));
+    f1.wait();
+
+    HPX_TEST(std::equal(
+        std::begin(d), f1.get(), std::begin(expected), std::end(expected)));
+
+    auto f2 = hpx::unique(p, iterator(std::begin(c)), iterator(std::end(c)));
+    f2.wait();
+
+    HPX_TEST(std::equal(std::begin(c), f2.get().base(), std::begin(expected),
+        std::end(expected)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_unique()
+{
+    using namespace hpx::execution;
+
+    test_unique(simd, IteratorTag());
+    test_unique(par_simd, IteratorTag());
+
+    test_unique_async(simd(task), IteratorTag());
+    test_unique_async(par_simd(task), IteratorTag());
+}
+
+void unique_test()
+{
+    test_unique<std::random_access_iterator_tag>();
+    test_unique<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    unique_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,820 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util::cache {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The \a default_shard_selector assigns each key to exactly one
+    ///        shard of a \a concurrent_cache, based on the hash value of the
+    ///        key.
+    template <typename Key, typename Hash = std::hash<Key>>
+    struct default_shard_selector
+    {
+        /// Return the set of shards the given key belongs to, bit \a i of the
+        /// returned value corresponds to shard \a i.
+        [[nodiscard]] std::uint64_t operator()(
+            Key const& key, std::size_t num_shards) const
+        {
+            return static_cast<std::uint64_t>(1)
+                << (Hash()(key) % num_shards);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class concurrent_cache concurrent_cache.hpp
+    ///
+    /// \brief The \a concurrent_cache implements a local (non-distributed)
+    ///        cache that can be safely accessed by concurrent threads.
+    ///
+    /// The entries are distributed over a number of shards, each of which is
+    /// protected by its own mutex. Each shard evicts its entries using the
+    /// CLOCK algorithm, an approximation of LRU: accessing an entry sets its
+    /// reference bit only, the clock hand gives entries with the reference
+    /// bit set a second chance before evicting them.
+    ///
+    /// A key may belong to more than one shard, in which case it is inserted
+    /// into all of them and looked up in each of them in turn. This allows
+    /// for keys representing ranges (like the keys of the AGAS cache). The
+    /// shards a key used for a lookup belongs to must be a subset of the
+    /// shards of any equivalent key stored in the cache. Modifications lock
+    /// all shards of a key at once (in the order of the shards), the size
+    /// and the insertions and evictions are accounted for by the first shard
+    /// of a key only.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache. Keys are compared
+    ///                       using operator<, the type must be default
+    ///                       constructible.
+    /// \tparam Entry         The type of the items to be held in the cache,
+    ///                       the type must be default constructible.
+    /// \tparam Mutex         The type of the mutex protecting each of the
+    ///                       shards.
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance. The statistics are collected for each
+    ///                       of the shards separately.
+    /// \tparam ShardSelector A (optional) function object returning the set
+    ///                       of shards a key belongs to (see
+    ///                       \a default_shard_selector).
+    template <typename Key, typename Entry, typename Mutex,
+        typename Statistics = statistics::no_statistics,
+        typename ShardSelector = default_shard_selector<Key>>
+    class concurrent_cache
+    {
+    public:
+        using key_type = Key;
+        using entry_type = Entry;
+        using mutex_type = Mutex;
+        using statistics_type = Statistics;
+        using entry_pair = std::pair<key_type, entry_type>;
+        using size_type = std::size_t;
+
+        // the shards a key belongs to are represented by a bit mask
+        static constexpr std::size_t max_shards = 64;
+
+    private:
+        using update_on_exit = typename statistics_type::update_on_exit;
+
+        struct slot
+        {
+            entry_pair value_;
+            bool used_ = false;
+            bool referenced_ = false;
+            bool first_shard_ = false;    // stored in the key's first shard
+        };
+
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            std::map<key_type, std::size_t> map_;    // key -> index in slots_
+            std::vector<slot> slots_;
+            std::vector<std::size_t> free_slots_;
+            std::size_t hand_ = 0;
+            std::size_t size_ = 0;    // entries stored in their first shard
+            statistics_type statistics_;
+        };
+
+        using shard_type = util::cache_aligned_data_derived<shard>;
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a concurrent_cache.
+        ///
+        /// \param max_size   [in] The maximal number of entries this cache is
+        ///                   allowed to hold, the entries are evenly
+        ///                   distributed over the shards.
+        /// \param num_shards [in] The number of shards to use, at most
+        ///                   \a max_shards.
+        ///
+        explicit concurrent_cache(
+            size_type max_size = 0, std::size_t num_shards = 16)
+          : num_shards_(num_shards == 0 ?
+                    1 :
+                    (num_shards > max_shards ? max_shards : num_shards))
+          , shards_(new shard_type[num_shards_])
+          , max_size_(0)
+        {
+            reserve(max_size);
+        }
+
+        concurrent_cache(concurrent_cache const& other) = delete;
+        concurrent_cache(concurrent_cache&& other) = delete;
+        concurrent_cache& operator=(concurrent_cache const& other) = delete;
+        concurrent_cache& operator=(concurrent_cache&& other) = delete;
+
+        ~concurrent_cache() = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current size of the cache.
+        ///
+        /// \note       Keys stored in more than one shard are counted once
+        ///             (by their first shard).
+        ///
+        /// \returns The current size of this cache instance.
+        [[nodiscard]] size_type size() const
+        {
+            size_type result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard const& s = shards_[i];
+                std::lock_guard<mutex_type> l(s.mtx_);
+                result += s.size_;
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        ///
+        /// \returns    The maximum size this cache instance is currently
+        ///             allowed to reach.
+        [[nodiscard]] size_type capacity() const noexcept
+        {
+            return max_size_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum size this cache can grow to
+        ///
+        /// \param max_size    [in] The new maximum size this cache will be
+        ///             allowed to grow to.
+        ///
+        void reserve(size_type max_size)
+        {
+            max_size_ = max_size;
+
+            size_type const shard_size =
+                (max_size + num_shards_ - 1) / num_shards_;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i];
+                std::lock_guard<mutex_type> l(s.mtx_);
+                resize(s, shard_size);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        ///
+        /// \param key    [in] The key for the entry which should be looked up
+        ///               in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        [[nodiscard]] bool holds_key(key_type const& key) const
+        {
+            std::uint64_t const shards = selector_(key, num_shards_);
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                if (shards & (static_cast<std::uint64_t>(1) << i))
+                {
+                    shard const& s = shards_[i];
+                    std::lock_guard<mutex_type> l(s.mtx_);
+                    if (s.map_.find(key) != s.map_.end())
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key     [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param realkey[out] Return the full real key found in the cache
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will mark the entry as recently used if
+        ///               the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(
+            key_type const& key, key_type& realkey, entry_type& entry)
+        {
+            std::uint64_t shards = selector_(key, num_shards_);
+            for (std::size_t i = 0; shards != 0; ++i)
+            {
+                std::uint64_t const bit = static_cast<std::uint64_t>(1) << i;
+                if (!(shards & bit))
+                {
+                    continue;
+                }
+                shards &= ~bit;
+
+                shard& s = shards_[i];
+                std::lock_guard<mutex_type> l(s.mtx_);
+                update_on_exit update(
+                    s.statistics_, statistics::method::get_entry);
+
+                auto const it = s.map_.find(key);
+                if (it == s.map_.end())
+                {
+                    // Got miss, count it once only
+                    if (shards == 0)
+                    {
+                        s.statistics_.got_miss();
+                    }
+                    continue;
+                }
+
+                // got hit
+                slot& sl = s.slots_[it->second];
+                sl.referenced_ = true;
+                s.statistics_.got_hit();
+
+                realkey = sl.value_.first;
+                entry = sl.value_.second;
+                return true;
+            }
+            return false;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key    [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            key_type tmp;
+            return get_entry(key, tmp, entry);
+        }
+
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \param key    [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param entry  [in] The entry which should be added to the cache.
+        ///
+        /// \returns      This function returns \a false if the entry was
+        ///               already held by all of the shards of the key.
+        bool insert(key_type const& key, entry_type const& entry)
+        {
+            return with_shards_locked(key, [&](std::uint64_t shards) {
+                update_on_exit update(shards_[first_shard(shards)].statistics_,
+                    statistics::method::insert_entry);
+
+                bool inserted = false;
+                for_each_shard(shards, [&](shard& s, bool first) {
+                    if (s.map_.find(key) == s.map_.end())
+                    {
+                        insert_nonexist(s, key, entry, first);
+                        inserted = true;
+                    }
+                });
+                return inserted;
+            });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The entry which should be used as a replacement
+        ///               for the existing value in the cache. If the entry is
+        ///               not held by the cache it is added.
+        void update(key_type const& key, entry_type const& entry)
+        {
+            with_shards_locked(key, [&](std::uint64_t shards) {
+                update_on_exit update(shards_[first_shard(shards)].statistics_,
+                    statistics::method::update_entry);
+
+                update_entries(shards, key, entry);
+                return true;
+            });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The value which should be used as a replacement
+        ///               for the existing value in the cache.
+        /// \param f      [in] A callable taking two arguments, \a k and the
+        ///               key found in the cache (in that order). If \a f
+        ///               returns true, the update will not succeed.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated (or added), otherwise it
+        ///               returns \a false.
+        ///
+        /// \note         \a f is invoked for the keys found in all shards of
+        ///               \a key before any of them is modified, the entry is
+        ///               updated in either all or none of the shards.
+        template <typename F>
+        bool update_if(key_type const& key, entry_type const& entry, F&& f)
+        {
+            return with_shards_locked(key, [&](std::uint64_t shards) {
+                update_on_exit update(shards_[first_shard(shards)].statistics_,
+                    statistics::method::update_entry);
+
+                bool rejected = false;
+                for_each_shard(shards, [&](shard& s, bool) {
+                    auto const it = s.map_.find(key);
+                    if (!rejected && it != s.map_.end())
+                    {
+                        rejected = f(key, s.slots_[it->second].value_.first);
+                    }
+                });
+                if (rejected)
+                {
+                    return false;
+                }
+
+                update_entries(shards, key, entry);
+                return true;
+            });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \param ep     [in] This parameter has to be a (unary) function
+        ///               object. It is invoked for each of the entries
+        ///               currently held in the cache. An entry is considered
+        ///               for removal from the cache whenever the value
+        ///               returned from this invocation is \a true.
+        ///
+        /// \returns      This function returns the number of the removed
+        ///               entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            // the shards are locked in order, the statistics are collected
+            // by the first shard only
+            shard& first = shards_[0];
+            std::lock_guard<mutex_type> l(first.mtx_);
+            update_on_exit update(
+                first.statistics_, statistics::method::erase_entry);
+
+            size_type erased = erase_entries(first, ep);
+            for (std::size_t i = 1; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i];
+                std::lock_guard<mutex_type> ls(s.mtx_);
+                erased += erase_entries(s, ep);
+            }
+            return erased;
+        }
+
+        /// \brief Remove all stored entries from the cache
+        ///
+        /// \returns      This function returns the number of the removed
+        ///               entries.
+        size_type erase()
+        {
+            return clear();
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache.
+        size_type clear()
+        {
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i];
+                std::lock_guard<mutex_type> l(s.mtx_);
+
+                erased += s.size_;
+                s.size_ = 0;
+                s.map_.clear();
+
+                std::size_t const num_slots = s.slots_.size();
+                s.slots_.clear();
+                s.slots_.resize(num_slots);
+                reset_free_slots(s);
+                s.hand_ = 0;
+            }
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Allow to access the statistics of all shards
+        ///
+        /// The returned object exposes the same interface as the statistics
+        /// type, the values of all shards are accumulated.
+        class statistics_accumulator
+        {
+        public:
+            explicit statistics_accumulator(concurrent_cache& cache) noexcept
+              : cache_(cache)
+            {
+            }
+
+            [[nodiscard]] std::size_t hits(bool reset)
+            {
+                return accumulate(
+                    [reset](statistics_type& s) { return s.hits(reset); });
+            }
+
+            [[nodiscard]] std::size_t misses(bool reset)
+            {
+                return accumulate(
+                    [reset](statistics_type& s) { return s.misses(reset); });
+            }
+
+            [[nodiscard]] std::size_t insertions(bool reset)
+            {
+                return accumulate([reset](statistics_type& s) {
+                    return s.insertions(reset);
+                });
+            }
+
+            [[nodiscard]] std::size_t evictions(bool reset)
+            {
+                return accumulate([reset](statistics_type& s) {
+                    return s.evictions(reset);
+                });
+            }
+
+            [[nodiscard]] std::int64_t get_get_entry_count(bool reset)
+            {
+                return accumulate([reset](statistics_type& s) {
+                    return s.get_get_entry_count(reset);
+                });
+            }
+
+            [[nodiscard]] std::int64_t get_insert_entry_count(bool reset)
+            {
+                return accumulate([reset](statistics_type& s) {
+                    return s.get_insert_entry_count(reset);
+                });
+            }
+
+            [[nodiscard]] std::int64_t get_update_entry_count(bool reset)
+            {
+                return accumulate([reset](statistics_type& s) {
+                    return s.get_update_entry_count(reset);
+                });
+            }
+
+            [[nodiscard]] std::int64_t get_erase_entry_count(bool reset)
+            {
+                return accumulate([reset](statistics_type& s) {
+                    return s.get_erase_entry_count(reset);
+                });
+            }
+
+            [[nodiscard]] std::int64_t get_get_entry_time(bool reset)
+            {
+                return accumulate([reset](statistics_type& s) {
+                    return s.get_get_entry_time(reset);
+                });
+            }
+
+            [[nodiscard]] std::int64_t get_insert_entry_time(bool reset)
+            {
+                return accumulate([reset](statistics_type& s) {
+                    return s.get_insert_entry_time(reset);
+                });
+            }
+
+            [[nodiscard]] std::int64_t get_update_entry_time(bool reset)
+            {
+                return accumulate([reset](statistics_type& s) {
+                    return s.get_update_entry_time(reset);
+                });
+            }
+
+            [[nodiscard]] std::int64_t get_erase_entry_time(bool reset)
+            {
+                return accumulate([reset](statistics_type& s) {
+                    return s.get_erase_entry_time(reset);
+                });
+            }
+
+        private:
+            template <typename F>
+            auto accumulate(F&& f)
+            {
+                decltype(f(std::declval<statistics_type&>())) result = 0;
+                for (std::size_t i = 0; i != cache_.num_shards_; ++i)
+                {
+                    shard& s = cache_.shards_[i];
+                    std::lock_guard<mutex_type> l(s.mtx_);
+                    result += f(s.statistics_);
+                }
+                return result;
+            }
+
+            concurrent_cache& cache_;
+        };
+
+        [[nodiscard]] statistics_accumulator get_statistics() noexcept
+        {
+            return statistics_accumulator(*this);
+        }
+
+    private:
+        static std::size_t first_shard(std::uint64_t shards) noexcept
+        {
+            HPX_ASSERT(shards != 0);
+
+            std::size_t i = 0;
+            while (!(shards & (static_cast<std::uint64_t>(1) << i)))
+            {
+                ++i;
+            }
+            return i;
+        }
+
+        // Invoke the given function with the locks of all shards the key
+        // belongs to being held. The locks are acquired in the order of the
+        // shards (as done by erase), which avoids deadlocks.
+        template <typename F>
+        bool with_shards_locked(key_type const& key, F&& f)
+        {
+            std::uint64_t const shards = selector_(key, num_shards_);
+            HPX_ASSERT(shards != 0);
+
+            return lock_shards(shards, 0, f);
+        }
+
+        template <typename F>
+        bool lock_shards(std::uint64_t shards, std::size_t i, F& f)
+        {
+            for (/**/; i != num_shards_; ++i)
+            {
+                if (shards & (static_cast<std::uint64_t>(1) << i))
+                {
+                    std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                    return lock_shards(shards, i + 1, f);
+                }
+            }
+            return f(shards);
+        }
+
+        // Invoke the given function for each of the given (locked) shards,
+        // the second argument is true for the first of them.
+        template <typename F>
+        void for_each_shard(std::uint64_t shards, F&& f)
+        {
+            bool first = true;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                if (shards & (static_cast<std::uint64_t>(1) << i))
+                {
+                    f(shards_[i], first);
+                    first = false;
+                }
+            }
+        }
+
+        // Update or add the entry in all of the given (locked) shards, hits
+        // and misses are counted by the first shard only.
+        void update_entries(std::uint64_t shards, key_type const& key,
+            entry_type const& entry)
+        {
+            for_each_shard(shards, [&](shard& s, bool first) {
+                // Is it already in the cache?
+                auto const it = s.map_.find(key);
+                if (it == s.map_.end())
+                {
+                    // got miss
+                    if (first)
+                    {
+                        s.statistics_.got_miss();
+                    }
+                    insert_nonexist(s, key, entry, first);
+                    return;
+                }
+
+                // got hit!
+                slot& sl = s.slots_[it->second];
+                sl.value_.second = entry;
+                sl.referenced_ = true;
+                if (first)
+                {
+                    s.statistics_.got_hit();
+                }
+            });
+        }
+
+        static void reset_free_slots(shard& s)
+        {
+            std::size_t const num_slots = s.slots_.size();
+
+            s.free_slots_.clear();
+            s.free_slots_.reserve(num_slots);
+            for (std::size_t i = num_slots; i != 0; --i)
+            {
+                s.free_slots_.push_back(i - 1);
+            }
+        }
+
+        static void free_slot(shard& s, std::size_t idx)
+        {
+            slot& sl = s.slots_[idx];
+            sl.value_ = entry_pair();
+            sl.used_ = false;
+            sl.referenced_ = false;
+            sl.first_shard_ = false;
+            s.free_slots_.push_back(idx);
+        }
+
+        // Change the number of entries the given shard can hold.
+        static void resize(shard& s, std::size_t num_slots)
+        {
+            if (num_slots < s.slots_.size())
+            {
+                // evict the entries held by the slots being removed
+                for (std::size_t i = num_slots; i != s.slots_.size(); ++i)
+                {
+                    if (s.slots_[i].used_)
+                    {
+                        s.map_.erase(s.slots_[i].value_.first);
+                        evicted(s, s.slots_[i]);
+                    }
+                }
+            }
+
+            s.slots_.resize(num_slots);
+            if (s.hand_ >= num_slots)
+            {
+                s.hand_ = 0;
+            }
+
+            s.free_slots_.clear();
+            for (std::size_t i = num_slots; i != 0; --i)
+            {
+                if (!s.slots_[i - 1].used_)
+                {
+                    s.free_slots_.push_back(i - 1);
+                }
+            }
+        }
+
+        // Find a slot for a new entry, evict an entry if necessary.
+        static std::size_t evict(shard& s)
+        {
+            HPX_ASSERT(!s.slots_.empty());
+
+            if (!s.free_slots_.empty())
+            {
+                std::size_t const idx = s.free_slots_.back();
+                s.free_slots_.pop_back();
+                return idx;
+            }
+
+            // All slots are in use, give entries that were recently accessed
+            // a second chance. This terminates after at most one full turn.
+            for (;;)
+            {
+                std::size_t const idx = s.hand_;
+                if (++s.hand_ == s.slots_.size())
+                {
+                    s.hand_ = 0;
+                }
+
+                slot& sl = s.slots_[idx];
+                if (sl.referenced_)
+                {
+                    sl.referenced_ = false;
+                    continue;
+                }
+
+                s.map_.erase(sl.value_.first);
+                evicted(s, sl);
+                return idx;
+            }
+        }
+
+        // Account for an entry having been removed from the given shard.
+        static void evicted(shard& s, slot const& sl)
+        {
+            if (sl.first_shard_)
+            {
+                --s.size_;
+                s.statistics_.got_eviction();
+            }
+        }
+
+        static void insert_nonexist(shard& s, key_type const& key,
+            entry_type const& entry, bool first_shard)
+        {
+            // update statistics
+            if (first_shard)
+            {
+                s.statistics_.got_insertion();
+            }
+
+            // a shard without capacity can't hold any entries
+            if (s.slots_.empty())
+            {
+                if (first_shard)
+                {
+                    s.statistics_.got_eviction();
+                }
+                return;
+            }
+
+            std::size_t const idx = evict(s);
+
+            slot& sl = s.slots_[idx];
+            sl.value_.first = key;
+            sl.value_.second = entry;
+            sl.used_ = true;
+            sl.referenced_ = true;
+            sl.first_shard_ = first_shard;
+            if (first_shard)
+            {
+                ++s.size_;
+            }
+
+            s.map_.emplace(key, idx);
+        }
+
+        template <typename Func>
+        static size_type erase_entries(shard& s, Func const& ep)
+        {
+            size_type erased = 0;
+            for (auto it = s.map_.begin(); it != s.map_.end();)
+            {
+                std::size_t const idx = it->second;
+                if (ep(std::as_const(s.slots_[idx].value_)))
+                {
+                    if (s.slots_[idx].first_shard_)
+                    {
+                        ++erased;
+                    }
+
+                    // update statistics
+                    evicted(s, s.slots_[idx]);
+
+                    free_slot(s, idx);
+                    it = s.map_.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+            return erased;
+        }
+
+        std::size_t const num_shards_;
+        std::unique_ptr<shard_type[]> shards_;
+        std::atomic<size_type> max_size_;
+
+        ShardSelector selector_;
+    };
+}    // namespace hpx::util::cache
@@ -0,0 +1,277 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/concurrent_cache.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using cache_type = hpx::util::cache::concurrent_cache<std::string, std::string,
+    std::mutex, hpx::util::cache::statistics::local_statistics>;
+
+void test_insert()
+{
+    cache_type c(3, 1);
+
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.capacity());
+
+    char const* const keys[] = {"white", "yellow", "green", "blue", "black"};
+    for (char const* key : keys)
+    {
+        HPX_TEST(c.insert(key, key));
+        HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(3));
+    }
+
+    // there should be 3 items in the cache
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+    HPX_TEST(!c.insert("black", "black"));
+
+    HPX_TEST_EQ(c.get_statistics().insertions(false),
+        static_cast<std::size_t>(5));
+    HPX_TEST_EQ(
+        c.get_statistics().evictions(false), static_cast<std::size_t>(2));
+}
+
+void test_insert_with_touch()
+{
+    cache_type c(3, 1);
+
+    HPX_TEST(c.insert("white", "255,255,255"));
+    HPX_TEST(c.insert("yellow", "255,255,0"));
+    HPX_TEST(c.insert("green", "0,255,0"));
+
+    // inserting a new item clears all reference bits and evicts the first
+    // item
+    HPX_TEST(c.insert("blue", "0,0,255"));
+    HPX_TEST(!c.holds_key("white"));
+
+    // now touch the oldest item, it gets a second chance
+    std::string yellow;
+    HPX_TEST(c.get_entry("yellow", yellow));
+    HPX_TEST_EQ(yellow, "255,255,0");
+
+    HPX_TEST(c.insert("black", "0,0,0"));
+    HPX_TEST(c.holds_key("yellow"));
+    HPX_TEST(!c.holds_key("green"));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+}
+
+void test_update_and_erase()
+{
+    cache_type c(64, 4);
+
+    HPX_TEST(c.insert("white", "255,255,255"));
+    HPX_TEST(c.insert("yellow", "255,255,0"));
+
+    c.update("yellow", "255,0,0");
+    c.update("black", "0,0,0");    // isn't in the cache
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+
+    std::string value;
+    HPX_TEST(c.get_entry("yellow", value));
+    HPX_TEST_EQ(value, "255,0,0");
+    HPX_TEST(c.get_entry("black", value));
+    HPX_TEST_EQ(value, "0,0,0");
+
+    // updates can be rejected
+    HPX_TEST(!c.update_if("white", "0,0,0",
+        [](std::string const&, std::string const&) { return true; }));
+    HPX_TEST(c.get_entry("white", value));
+    HPX_TEST_EQ(value, "255,255,255");
+
+    HPX_TEST_EQ(c.erase([](std::pair<std::string, std::string> const& p) {
+        return p.first == "white";
+    }),
+        static_cast<cache_type::size_type>(1));
+    HPX_TEST(!c.get_entry("white", value));
+
+    HPX_TEST_EQ(c.clear(), static_cast<cache_type::size_type>(2));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(0), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// keys representing ranges of numbers compare equivalent if they overlap
+struct range_key
+{
+    range_key() = default;
+
+    explicit range_key(std::uint64_t first, std::uint64_t count = 1)
+      : first_(first)
+      , last_(first + count - 1)
+    {
+    }
+
+    friend bool operator<(range_key const& lhs, range_key const& rhs)
+    {
+        return lhs.last_ < rhs.first_;
+    }
+
+    std::uint64_t first_ = 0;
+    std::uint64_t last_ = 0;
+};
+
+// assign blocks of 4 consecutive numbers to the same shard
+struct range_key_shards
+{
+    std::uint64_t operator()(
+        range_key const& key, std::size_t num_shards) const
+    {
+        std::uint64_t result = 0;
+        for (std::uint64_t b = key.first_ / 4; b <= key.last_ / 4; ++b)
+        {
+            result |= static_cast<std::uint64_t>(1) << (b % num_shards);
+        }
+        return result;
+    }
+};
+
+void test_range_keys()
+{
+    using range_cache_type = hpx::util::cache::concurrent_cache<range_key,
+        std::string, std::mutex, hpx::util::cache::statistics::no_statistics,
+        range_key_shards>;
+
+    range_cache_type c(64, 8);
+
+    HPX_TEST(c.insert(range_key(10, 12), "range"));
+
+    // each number of the range refers to the range
+    for (std::uint64_t i = 10; i != 22; ++i)
+    {
+        range_key realkey;
+        std::string value;
+        HPX_TEST(c.get_entry(range_key(i), realkey, value));
+        HPX_TEST_EQ(realkey.first_, static_cast<std::uint64_t>(10));
+        HPX_TEST_EQ(realkey.last_, static_cast<std::uint64_t>(21));
+        HPX_TEST_EQ(value, "range");
+    }
+
+    std::string value;
+    HPX_TEST(!c.get_entry(range_key(9), value));
+    HPX_TEST(!c.get_entry(range_key(22), value));
+}
+
+// keys stored in more than one shard are accounted for once
+void test_range_keys_size()
+{
+    using range_cache_type = hpx::util::cache::concurrent_cache<range_key,
+        std::string, std::mutex, hpx::util::cache::statistics::local_statistics,
+        range_key_shards>;
+
+    range_cache_type c(64, 8);
+
+    HPX_TEST(c.insert(range_key(10, 12), "range"));
+    HPX_TEST_EQ(static_cast<range_cache_type::size_type>(1), c.size());
+    HPX_TEST_EQ(
+        c.get_statistics().insertions(false), static_cast<std::size_t>(1));
+
+    c.update(range_key(10, 12), "other");
+    HPX_TEST_EQ(static_cast<range_cache_type::size_type>(1), c.size());
+
+    HPX_TEST_EQ(c.erase([](std::pair<range_key, std::string> const&) {
+        return true;
+    }),
+        static_cast<range_cache_type::size_type>(1));
+    HPX_TEST_EQ(static_cast<range_cache_type::size_type>(0), c.size());
+    HPX_TEST_EQ(
+        c.get_statistics().evictions(false), static_cast<std::size_t>(1));
+}
+
+// a rejected update leaves all shards unchanged
+void test_range_keys_update_if()
+{
+    using range_cache_type = hpx::util::cache::concurrent_cache<range_key,
+        std::string, std::mutex, hpx::util::cache::statistics::no_statistics,
+        range_key_shards>;
+
+    range_cache_type c(64, 8);
+
+    HPX_TEST(c.insert(range_key(0, 4), "first"));     // shard 0
+    HPX_TEST(c.insert(range_key(4, 4), "second"));    // shard 1
+
+    // the key spans both shards, the update is rejected by the second one
+    HPX_TEST(!c.update_if(range_key(0, 8), "updated",
+        [](range_key const&, range_key const& found) {
+            return found.first_ == 4;
+        }));
+
+    std::string value;
+    HPX_TEST(c.get_entry(range_key(0), value));
+    HPX_TEST_EQ(value, "first");
+    HPX_TEST(c.get_entry(range_key(4), value));
+    HPX_TEST_EQ(value, "second");
+
+    HPX_TEST(c.update_if(range_key(0, 8), "updated",
+        [](range_key const&, range_key const&) { return false; }));
+    HPX_TEST(c.get_entry(range_key(0), value));
+    HPX_TEST_EQ(value, "updated");
+    HPX_TEST(c.get_entry(range_key(4), value));
+    HPX_TEST_EQ(value, "updated");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_access()
+{
+    constexpr std::size_t num_threads = 4;
+    constexpr std::size_t num_keys = 256;
+
+    cache_type c(128);
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&c, t]() {
+            for (std::size_t i = 0; i != 10 * num_keys; ++i)
+            {
+                std::string const key =
+                    std::to_string((i * (t + 1)) % num_keys);
+
+                std::string value;
+                if (c.get_entry(key, value))
+                {
+                    HPX_TEST_EQ(value, key);
+                }
+                else
+                {
+                    c.update(key, key);
+                }
+            }
+        });
+    }
+
+    for (std::thread& t : threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST_LTE(c.size(), c.capacity());
+    HPX_TEST_EQ(c.get_statistics().insertions(false) -
+            c.get_statistics().evictions(false),
+        c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_insert();
+    test_insert_with_touch();
+    test_update_and_erase();
+    test_range_keys();
+    test_range_keys_size();
+    test_range_keys_update_if();
+    test_concurrent_access();
+
+    return hpx::util::report_errors();
+}
@@ -12,6 +12,7 @@
 #include <hpx/compute_local/host/block_executor.hpp>
 #include <hpx/compute_local/host/get_targets.hpp>
 #include <hpx/compute_local/host/numa_domains.hpp>
+#include <hpx/compute_local/host/numa_placement_executor.hpp>
 #include <hpx/compute_local/host/target.hpp>
 #include <hpx/compute_local/host/traits/access_target.hpp>
 #include <hpx/compute_local/traits.hpp>
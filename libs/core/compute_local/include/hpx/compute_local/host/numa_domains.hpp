@@ -10,9 +10,36 @@
 
 #include <hpx/compute_local/host/target.hpp>
 
+#include <cstddef>
+#include <utility>
 #include <vector>
 
 namespace hpx::compute::host {
 
     HPX_CORE_EXPORT std::vector<target> numa_domains();
+
+    /// Return the targets for all NUMA domains that have worker threads
+    /// associated, together with the number of the NUMA domain
+    HPX_CORE_EXPORT std::vector<std::pair<std::size_t, target>>
+    numa_domain_targets();
+
+    /// The NUMA domain reported for memory pages which have not been touched
+    /// yet (and are therefore not associated with any domain)
+    inline constexpr std::size_t unplaced_numa_domain = ~std::size_t(0);
+
+    /// Describes a contiguous part of a memory area whose pages are located
+    /// in the same NUMA domain
+    struct numa_domain_range
+    {
+        std::size_t first = 0;    // offset of the first byte of the part
+        std::size_t last = 0;     // offset after the last byte of the part
+        std::size_t domain = unplaced_numa_domain;
+    };
+
+    /// Return the NUMA domains holding the memory pages of the given memory
+    /// area. The pages are sampled at up to \a max_samples positions, the
+    /// boundaries between domains are located using a binary search between
+    /// the samples.
+    HPX_CORE_EXPORT std::vector<numa_domain_range> get_numa_domain_ranges(
+        void const* addr, std::size_t len, std::size_t max_samples = 1024);
 }    // namespace hpx::compute::host
@@ -0,0 +1,475 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/compute_local/host/numa_domains.hpp>
+#include <hpx/compute_local/host/target.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution/executors/default_parameters.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution/traits/executor_traits.hpp>
+#include <hpx/execution_base/traits/is_executor.hpp>
+#include <hpx/executors/restricted_thread_pool_executor.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/type_support/is_contiguous_iterator.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::compute::host {
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        // Return the address of the first element of the chunk referred to
+        // by an element of a shape, if any.
+        template <typename T>
+        void const* shape_element_address(T const&) noexcept
+        {
+            return nullptr;
+        }
+
+        template <typename Iter, typename... Ts>
+        void const* shape_element_address(hpx::tuple<Iter, Ts...> const& elem)
+        {
+            if constexpr (hpx::traits::is_contiguous_iterator_v<Iter>)
+            {
+                return std::addressof(*hpx::get<0>(elem));
+            }
+            else
+            {
+                return nullptr;
+            }
+        }
+        /// \endcond
+    }    // namespace detail
+
+    /// The NUMA placement executor runs work on the NUMA domains holding the
+    /// data it operates on. It is created for a memory area (usually the
+    /// data of a container) and queries the NUMA domains the memory pages of
+    /// that area are located in.
+    ///
+    /// The elements of the shapes created by the parallel algorithms refer
+    /// to their chunk of the data by an iterator (stored as their first
+    /// member). Each element of a shape passed to a bulk execution whose
+    /// iterator points into the memory area is executed on the worker threads
+    /// of the NUMA domain holding the first element of its chunk. All other
+    /// elements, including those referring to pages not touched yet, are
+    /// distributed evenly across all NUMA domains (as done by the
+    /// block_executor). Using this executor for initializing the data will
+    /// therefore place the pages consistently with the later execution of
+    /// algorithms after calling \a refresh().
+    ///
+    /// \tparam Executor The underlying executor to use
+    template <typename Executor =
+                  hpx::parallel::execution::restricted_thread_pool_executor>
+    struct numa_placement_executor
+    {
+    public:
+        using executor_parameters_type =
+            hpx::execution::experimental::default_parameters;
+
+        /// Create an executor for the memory area holding \a count elements
+        /// starting at \a data.
+        template <typename T>
+        numa_placement_executor(T const* data, std::size_t count,
+            threads::thread_priority priority = threads::thread_priority::high,
+            threads::thread_stacksize stacksize =
+                threads::thread_stacksize::default_,
+            threads::thread_schedule_hint schedulehint = {})
+          : data_(data)
+          , size_(count * sizeof(T))
+          , current_(0)
+          , priority_(priority)
+          , stacksize_(stacksize)
+          , schedulehint_(schedulehint)
+        {
+            init_executors();
+            refresh();
+        }
+
+        numa_placement_executor(numa_placement_executor const& other)
+          : data_(other.data_)
+          , size_(other.size_)
+          , domains_(other.domains_)
+          , ranges_(other.ranges_)
+          , range_executors_(other.range_executors_)
+          , current_(0)
+          , executors_(other.executors_)
+          , num_pus_(other.num_pus_)
+          , priority_(other.priority_)
+          , stacksize_(other.stacksize_)
+          , schedulehint_(other.schedulehint_)
+        {
+        }
+
+        numa_placement_executor(numa_placement_executor&& other) noexcept
+          : data_(other.data_)
+          , size_(other.size_)
+          , domains_(HPX_MOVE(other.domains_))
+          , ranges_(HPX_MOVE(other.ranges_))
+          , range_executors_(HPX_MOVE(other.range_executors_))
+          , current_(other.current_.load())
+          , executors_(HPX_MOVE(other.executors_))
+          , num_pus_(other.num_pus_)
+          , priority_(other.priority_)
+          , stacksize_(other.stacksize_)
+          , schedulehint_(other.schedulehint_)
+        {
+        }
+
+        numa_placement_executor& operator=(numa_placement_executor const& other)
+        {
+            if (&other != this)
+            {
+                data_ = other.data_;
+                size_ = other.size_;
+                domains_ = other.domains_;
+                ranges_ = other.ranges_;
+                range_executors_ = other.range_executors_;
+                current_ = 0;
+                executors_ = other.executors_;
+                num_pus_ = other.num_pus_;
+                priority_ = other.priority_;
+                stacksize_ = other.stacksize_;
+                schedulehint_ = other.schedulehint_;
+            }
+            return *this;
+        }
+
+        numa_placement_executor& operator=(
+            numa_placement_executor&& other) noexcept
+        {
+            if (&other != this)
+            {
+                data_ = other.data_;
+                size_ = other.size_;
+                domains_ = HPX_MOVE(other.domains_);
+                ranges_ = HPX_MOVE(other.ranges_);
+                range_executors_ = HPX_MOVE(other.range_executors_);
+                current_ = other.current_.load();
+                executors_ = HPX_MOVE(other.executors_);
+                num_pus_ = other.num_pus_;
+                priority_ = other.priority_;
+                stacksize_ = other.stacksize_;
+                schedulehint_ = other.schedulehint_;
+            }
+            return *this;
+        }
+
+        /// \cond NOINTERNAL
+        bool operator==(numa_placement_executor const& rhs) const noexcept
+        {
+            return data_ == rhs.data_ && size_ == rhs.size_ &&
+                domains_ == rhs.domains_;
+        }
+
+        bool operator!=(numa_placement_executor const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        numa_placement_executor const& context() const noexcept
+        {
+            return *this;
+        }
+        /// \endcond
+
+        /// Query the placement of the memory pages again. This is necessary
+        /// after the pages were touched for the first time (or migrated)
+        /// after creating the executor.
+        void refresh()
+        {
+            ranges_ = get_numa_domain_ranges(data_, size_);
+
+            range_executors_.clear();
+            range_executors_.reserve(ranges_.size());
+            for (auto const& range : ranges_)
+            {
+                std::size_t index = unplaced_numa_domain;
+                for (std::size_t i = 0; i != domains_.size(); ++i)
+                {
+                    if (domains_[i] == range.domain)
+                    {
+                        index = i;
+                        break;
+                    }
+                }
+                range_executors_.push_back(index);
+            }
+        }
+
+        /// Return the NUMA domains holding the pages of the memory area
+        std::vector<numa_domain_range> const& placement() const noexcept
+        {
+            return ranges_;
+        }
+
+    private:
+        // this function is conceptually const (current_ is mutable)
+        auto get_next_executor() const
+        {
+            return executors_[current_++ % executors_.size()];
+        }
+
+        // Return the index of the executor responsible for the part of the
+        // memory area starting at the given address, or 'unplaced_numa_domain'
+        // if the address does not refer to a placed page of the area.
+        std::size_t get_executor_index(void const* addr) const
+        {
+            auto const base = reinterpret_cast<std::uintptr_t>(data_);
+            auto const pos = reinterpret_cast<std::uintptr_t>(addr);
+            if (pos < base || pos - base >= size_)
+            {
+                return unplaced_numa_domain;
+            }
+
+            auto const it = std::upper_bound(ranges_.begin(), ranges_.end(),
+                static_cast<std::size_t>(pos - base),
+                [](std::size_t offset, numa_domain_range const& range) {
+                    return offset < range.last;
+                });
+            if (it == ranges_.end())
+            {
+                return unplaced_numa_domain;
+            }
+            return range_executors_[it - ranges_.begin()];
+        }
+
+        // Return the index of the executor responsible for each element of
+        // the given shape. Elements referring to placed parts of the memory
+        // area are assigned to the executor of the NUMA domain holding the
+        // part, all others are distributed evenly across all executors.
+        template <typename Shape>
+        std::vector<std::size_t> get_executor_indices(
+            Shape const& shape, std::size_t cnt) const
+        {
+            std::vector<std::size_t> indices(cnt);
+
+            std::size_t const num_executors = executors_.size();
+            auto it = util::begin(shape);
+            for (std::size_t i = 0; i != cnt; (void) ++i, ++it)
+            {
+                std::size_t index = unplaced_numa_domain;
+                if (void const* addr = detail::shape_element_address(*it))
+                {
+                    index = get_executor_index(addr);
+                }
+                indices[i] = index != unplaced_numa_domain ?
+                    index :
+                    (i * num_executors) / cnt;
+            }
+
+            return indices;
+        }
+
+        template <typename F, typename... Ts>
+        friend decltype(auto) tag_invoke(hpx::parallel::execution::post_t,
+            numa_placement_executor const& exec, F&& f, Ts&&... ts)
+        {
+            hpx::parallel::execution::post(exec.get_next_executor(),
+                HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+        template <typename F, typename... Ts>
+        friend decltype(auto) tag_invoke(
+            hpx::parallel::execution::async_execute_t,
+            numa_placement_executor const& exec, F&& f, Ts&&... ts)
+        {
+            return hpx::parallel::execution::async_execute(
+                exec.get_next_executor(), HPX_FORWARD(F, f),
+                HPX_FORWARD(Ts, ts)...);
+        }
+
+        template <typename F, typename... Ts>
+        friend decltype(auto) tag_invoke(
+            hpx::parallel::execution::sync_execute_t,
+            numa_placement_executor const& exec, F&& f, Ts&&... ts)
+        {
+            return hpx::parallel::execution::sync_execute(
+                exec.get_next_executor(), HPX_FORWARD(F, f),
+                HPX_FORWARD(Ts, ts)...);
+        }
+
+        template <typename F, typename Shape, typename... Ts>
+        decltype(auto) bulk_async_execute_impl(
+            F&& f, Shape const& shape, Ts&&... ts) const
+        {
+            using result_type =
+                parallel::execution::detail::bulk_function_result_t<F, Shape,
+                    Ts...>;
+
+            std::vector<hpx::future<result_type>> results;
+            std::size_t const cnt = util::size(shape);
+            results.reserve(cnt);
+
+            try
+            {
+                std::vector<std::size_t> const indices =
+                    get_executor_indices(shape, cnt);
+
+                // schedule each run of consecutive elements assigned to the
+                // same executor at once
+                auto const begin = util::begin(shape);
+                std::size_t part_begin_offset = 0;
+                while (part_begin_offset != cnt)
+                {
+                    std::size_t const index = indices[part_begin_offset];
+                    std::size_t part_end_offset = part_begin_offset + 1;
+                    while (part_end_offset != cnt &&
+                        indices[part_end_offset] == index)
+                    {
+                        ++part_end_offset;
+                    }
+
+                    auto part_begin = begin;
+                    auto part_end = begin;
+                    std::advance(part_begin, part_begin_offset);
+                    std::advance(part_end, part_end_offset);
+
+                    auto futures = hpx::parallel::execution::bulk_async_execute(
+                        executors_[index], HPX_FORWARD(F, f),
+                        util::iterator_range(part_begin, part_end),
+                        HPX_FORWARD(Ts, ts)...);
+
+                    if constexpr (hpx::traits::is_future_v<decltype(futures)>)
+                    {
+                        results.push_back(HPX_MOVE(futures));
+                    }
+                    else
+                    {
+                        results.insert(results.end(),
+                            std::make_move_iterator(futures.begin()),
+                            std::make_move_iterator(futures.end()));
+                    }
+
+                    part_begin_offset = part_end_offset;
+                }
+            }
+            catch (std::bad_alloc const&)
+            {
+                throw;
+            }
+            catch (...)
+            {
+                results.clear();
+                results.emplace_back(hpx::make_exceptional_future<result_type>(
+                    std::current_exception()));
+            }
+            return results;
+        }
+
+        template <typename F, typename Shape, typename... Ts>
+        friend decltype(auto) tag_invoke(
+            hpx::parallel::execution::bulk_async_execute_t,
+            numa_placement_executor const& exec, F&& f, Shape const& shape,
+            Ts&&... ts)
+        {
+            return exec.bulk_async_execute_impl(
+                HPX_FORWARD(F, f), shape, HPX_FORWARD(Ts, ts)...);
+        }
+
+        // clang-format off
+        template <typename Parameters,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_executor_parameters_v<Parameters>
+            )>
+        // clang-format on
+        friend std::size_t tag_invoke(
+            hpx::parallel::execution::processing_units_count_t,
+            Parameters&&, numa_placement_executor const& exec,
+            hpx::chrono::steady_duration const& = hpx::chrono::null_duration,
+            std::size_t = 0)
+        {
+            return exec.num_pus_;
+        }
+
+    public:
+        /// Return the numbers of the NUMA domains the work is executed on
+        std::vector<std::size_t> const& domains() const noexcept
+        {
+            return domains_;
+        }
+
+    private:
+        void init_executors()
+        {
+            auto const targets = numa_domain_targets();
+
+            domains_.reserve(targets.size());
+            executors_.reserve(targets.size());
+            for (auto const& [domain, tgt] : targets)
+            {
+                auto num_pus = tgt.num_pus();
+                domains_.push_back(domain);
+                executors_.emplace_back(num_pus.first, num_pus.second,
+                    priority_, stacksize_, schedulehint_);
+                num_pus_ += num_pus.second;
+            }
+        }
+
+        void const* data_;
+        std::size_t size_;
+        std::vector<std::size_t> domains_;
+        std::vector<numa_domain_range> ranges_;
+        std::vector<std::size_t> range_executors_;
+        mutable std::atomic<std::size_t> current_;
+        std::vector<Executor> executors_;
+        std::size_t num_pus_ = 0;
+        threads::thread_priority priority_ = threads::thread_priority::high;
+        threads::thread_stacksize stacksize_ =
+            threads::thread_stacksize::default_;
+        threads::thread_schedule_hint schedulehint_ = {};
+    };
+}    // namespace hpx::compute::host
+
+namespace hpx::parallel::execution {
+
+    template <typename Executor>
+    struct executor_execution_category<
+        compute::host::numa_placement_executor<Executor>>
+    {
+        using type = hpx::execution::parallel_execution_tag;
+    };
+
+    template <typename Executor>
+    struct is_one_way_executor<
+        compute::host::numa_placement_executor<Executor>> : std::true_type
+    {
+    };
+
+    template <typename Executor>
+    struct is_two_way_executor<
+        compute::host::numa_placement_executor<Executor>> : std::true_type
+    {
+    };
+
+    template <typename Executor>
+    struct is_bulk_one_way_executor<
+        compute::host::numa_placement_executor<Executor>> : std::true_type
+    {
+    };
+
+    template <typename Executor>
+    struct is_bulk_two_way_executor<
+        compute::host::numa_placement_executor<Executor>> : std::true_type
+    {
+    };
+}    // namespace hpx::parallel::execution
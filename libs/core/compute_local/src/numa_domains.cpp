@@ -8,56 +8,73 @@
 
 #include <hpx/compute_local/host/numa_domains.hpp>
 #include <hpx/compute_local/host/target.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
 #include <hpx/runtime_local/get_os_thread_count.hpp>
 #include <hpx/topology/cpu_mask.hpp>
 #include <hpx/topology/topology.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 namespace hpx::compute::host {
 
-    std::vector<target> numa_domains()
-    {
-        auto const& topo = hpx::threads::create_topology();
-
-        std::size_t numa_nodes = topo.get_number_of_numa_nodes();
-        if (numa_nodes == 0)
-        {
-            numa_nodes = topo.get_number_of_sockets();
-        }
+    namespace {
 
-        std::vector<hpx::threads::mask_type> node_masks(numa_nodes);
-        for (auto& mask : node_masks)
+        // Return the mask of processing units used by worker threads for each
+        // of the NUMA domains
+        std::vector<hpx::threads::mask_type> numa_domain_masks()
         {
-            hpx::threads::resize(mask, topo.get_number_of_pus());
-        }
+            auto const& topo = hpx::threads::create_topology();
 
-        auto const& rp = hpx::resource::get_partitioner();
+            std::size_t numa_nodes = topo.get_number_of_numa_nodes();
+            if (numa_nodes == 0)
+            {
+                numa_nodes = topo.get_number_of_sockets();
+            }
 
-        std::size_t const num_os_threads = hpx::get_os_thread_count();
-        for (std::size_t num_thread = 0; num_thread != num_os_threads;
-             ++num_thread)
-        {
-            std::size_t const pu_num = rp.get_pu_num(num_thread);
-            std::size_t const numa_node = topo.get_numa_node_number(pu_num);
+            std::vector<hpx::threads::mask_type> node_masks(numa_nodes);
+            for (auto& mask : node_masks)
+            {
+                hpx::threads::resize(mask, topo.get_number_of_pus());
+            }
 
-            auto const& mask = topo.get_thread_affinity_mask(pu_num);
+            auto const& rp = hpx::resource::get_partitioner();
 
-            std::size_t const mask_size = hpx::threads::mask_size(mask);
-            for (std::size_t idx = 0; idx != mask_size; ++idx)
+            std::size_t const num_os_threads = hpx::get_os_thread_count();
+            for (std::size_t num_thread = 0; num_thread != num_os_threads;
+                 ++num_thread)
             {
-                if (hpx::threads::test(mask, idx))
+                std::size_t const pu_num = rp.get_pu_num(num_thread);
+                std::size_t const numa_node =
+                    topo.get_numa_node_number(pu_num);
+
+                auto const& mask = topo.get_thread_affinity_mask(pu_num);
+
+                std::size_t const mask_size = hpx::threads::mask_size(mask);
+                for (std::size_t idx = 0; idx != mask_size; ++idx)
                 {
-                    hpx::threads::set(node_masks[numa_node], idx);
+                    if (hpx::threads::test(mask, idx))
+                    {
+                        hpx::threads::set(node_masks[numa_node], idx);
+                    }
                 }
             }
+
+            return node_masks;
         }
+    }    // namespace
+
+    std::vector<target> numa_domains()
+    {
+        std::vector<hpx::threads::mask_type> node_masks = numa_domain_masks();
 
         // Sort out the masks which don't have any bits set
         std::vector<target> res;
-        res.reserve(numa_nodes);
+        res.reserve(node_masks.size());
 
         for (auto& mask : node_masks)
         {
@@ -69,4 +86,119 @@ namespace hpx::compute::host {
 
         return res;
     }
+
+    std::vector<std::pair<std::size_t, target>> numa_domain_targets()
+    {
+        std::vector<hpx::threads::mask_type> node_masks = numa_domain_masks();
+
+        std::vector<std::pair<std::size_t, target>> res;
+        res.reserve(node_masks.size());
+
+        for (std::size_t domain = 0; domain != node_masks.size(); ++domain)
+        {
+            if (hpx::threads::any(node_masks[domain]))
+            {
+                res.emplace_back(domain, target(node_masks[domain]));
+            }
+        }
+
+        return res;
+    }
+
+    std::vector<numa_domain_range> get_numa_domain_ranges(
+        void const* addr, std::size_t len, std::size_t max_samples)
+    {
+        std::vector<numa_domain_range> ranges;
+        if (len == 0)
+        {
+            return ranges;
+        }
+
+        auto const& topo = hpx::threads::create_topology();
+        std::size_t const page_size = hpx::threads::get_memory_page_size();
+
+        // the first page may start before the beginning of the memory area
+        auto const base = reinterpret_cast<std::uintptr_t>(addr);
+        std::uintptr_t const first_page = base - base % page_size;
+        std::size_t const num_pages =
+            (base + len - first_page + page_size - 1) / page_size;
+
+        auto domain_of = [&](std::size_t page) -> std::size_t {
+            int const domain = topo.get_numa_domain(
+                reinterpret_cast<void const*>(first_page + page * page_size));
+            return domain < 0 ? unplaced_numa_domain :
+                                static_cast<std::size_t>(domain);
+        };
+
+        // add the pages [begin, end) to the list of ranges
+        auto add_range = [&](std::size_t begin, std::size_t end,
+                             std::size_t domain) {
+            std::size_t const first =
+                begin == 0 ? 0 : first_page + begin * page_size - base;
+            std::size_t const last =
+                end == num_pages ? len : first_page + end * page_size - base;
+
+            if (!ranges.empty() && ranges.back().domain == domain)
+            {
+                ranges.back().last = last;
+            }
+            else
+            {
+                ranges.push_back(numa_domain_range{first, last, domain});
+            }
+        };
+
+        try
+        {
+            std::size_t const num_samples = (std::min)(
+                num_pages, (std::max)(max_samples, std::size_t(1)));
+
+            std::size_t begin = 0;    // first page of the current range
+            std::size_t known = 0;    // last page known to be in the range
+            std::size_t domain = domain_of(0);
+
+            for (std::size_t i = 1; i != num_samples; ++i)
+            {
+                std::size_t const sample = (i * num_pages) / num_samples;
+                std::size_t const sample_domain = domain_of(sample);
+
+                // locate all domain boundaries between the samples
+                while (sample_domain != domain)
+                {
+                    std::size_t low = known;
+                    std::size_t high = sample;
+                    while (high - low > 1)
+                    {
+                        std::size_t const mid = low + (high - low) / 2;
+                        if (domain_of(mid) == domain)
+                        {
+                            low = mid;
+                        }
+                        else
+                        {
+                            high = mid;
+                        }
+                    }
+
+                    add_range(begin, high, domain);
+
+                    begin = high;
+                    known = high;
+                    domain = domain_of(high);
+                }
+
+                known = sample;
+            }
+
+            add_range(begin, num_pages, domain);
+        }
+        catch (hpx::exception const&)
+        {
+            // the placement of the pages can't be queried on this system
+            ranges.clear();
+            ranges.push_back(numa_domain_range{0, len, unplaced_numa_domain});
+        }
+
+        return ranges;
+    }
 }    // namespace hpx::compute::host
@@ -0,0 +1,196 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the bandwidth of the STREAM triad kernel
+// (a = b + scalar * c) for different ways of placing the data on the NUMA
+// domains and of scheduling the work. The arrays are not initialized when
+// allocated, the first touch happens through the executor that is used for
+// the kernel.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/compute.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/format.hpp>
+#include <hpx/init.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int test_count = 10;
+
+struct triad_step
+{
+    double scalar;
+
+    double operator()(double b, double c) const noexcept
+    {
+        return b + scalar * c;
+    }
+};
+
+// Initialize the arrays using the given policy, then run the triad kernel
+// using the policy returned by make_policy() (invoked after the first touch).
+template <typename InitPolicy, typename MakePolicy>
+double run_triad(std::size_t size, InitPolicy&& init_policy,
+    MakePolicy&& make_policy, std::unique_ptr<double[]>& a,
+    std::unique_ptr<double[]>& b, std::unique_ptr<double[]>& c)
+{
+    hpx::fill(init_policy, a.get(), a.get() + size, 0.0);
+    hpx::fill(init_policy, b.get(), b.get() + size, 1.0);
+    hpx::fill(init_policy, c.get(), c.get() + size, 2.0);
+
+    auto policy = make_policy();
+
+    // warm up
+    hpx::transform(policy, b.get(), b.get() + size, c.get(), a.get(),
+        triad_step{3.0});
+
+    std::uint64_t best = ~std::uint64_t(0);
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+        hpx::transform(policy, b.get(), b.get() + size, c.get(), a.get(),
+            triad_step{3.0});
+        best = (std::min)(
+            best, hpx::chrono::high_resolution_clock::now() - start);
+    }
+
+    // report the bandwidth in GB/s (three arrays are accessed)
+    return (3.0 * sizeof(double) * size) / static_cast<double>(best);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const vector_size = vm["vector_size"].as<std::size_t>();
+    test_count = vm["test_count"].as<int>();
+
+    auto const domains = hpx::compute::host::numa_domains();
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "vector_size  : " << vector_size << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "numa domains : " << domains.size() << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    auto fmt = "triad ({1}) : {2}(GB/s)";
+
+    {
+        // default parallel policy
+        std::unique_ptr<double[]> a(new double[vector_size]);
+        std::unique_ptr<double[]> b(new double[vector_size]);
+        std::unique_ptr<double[]> c(new double[vector_size]);
+
+        hpx::util::format_to(std::cout, fmt, "par",
+            run_triad(
+                vector_size, hpx::execution::par,
+                [] { return hpx::execution::par; }, a, b, c))
+            << std::endl;
+    }
+
+    {
+        // block executor distributing the work evenly across NUMA domains
+        std::unique_ptr<double[]> a(new double[vector_size]);
+        std::unique_ptr<double[]> b(new double[vector_size]);
+        std::unique_ptr<double[]> c(new double[vector_size]);
+
+        hpx::compute::host::block_executor<> exec(domains);
+        auto policy = hpx::execution::par.on(exec);
+
+        hpx::util::format_to(std::cout, fmt, "block_executor",
+            run_triad(
+                vector_size, policy, [&] { return policy; }, a, b, c))
+            << std::endl;
+    }
+
+    {
+        // NUMA placement executor, the work is executed on the NUMA domain
+        // holding the pages of the output array
+        std::unique_ptr<double[]> a(new double[vector_size]);
+        std::unique_ptr<double[]> b(new double[vector_size]);
+        std::unique_ptr<double[]> c(new double[vector_size]);
+
+        hpx::compute::host::numa_placement_executor<> exec(
+            a.get(), vector_size);
+        auto policy = hpx::execution::par.on(exec);
+
+        hpx::util::format_to(std::cout, fmt, "numa_placement_executor",
+            run_triad(
+                vector_size, policy,
+                [&] {
+                    exec.refresh();
+                    return hpx::execution::par.on(exec);
+                },
+                a, b, c))
+            << std::endl;
+    }
+
+    {
+        // the arrays are initialized by a single thread (all pages are
+        // placed in the same NUMA domain), the NUMA placement executor
+        // executes all work in that domain
+        std::unique_ptr<double[]> a(new double[vector_size]);
+        std::unique_ptr<double[]> b(new double[vector_size]);
+        std::unique_ptr<double[]> c(new double[vector_size]);
+
+        hpx::compute::host::numa_placement_executor<> exec(
+            a.get(), vector_size);
+
+        hpx::util::format_to(std::cout, fmt, "par, serial first touch",
+            run_triad(
+                vector_size, hpx::execution::seq,
+                [] { return hpx::execution::par; }, a, b, c))
+            << std::endl;
+
+        hpx::util::format_to(std::cout, fmt,
+            "numa_placement_executor, serial first touch",
+            run_triad(
+                vector_size, hpx::execution::seq,
+                [&] {
+                    exec.refresh();
+                    return hpx::execution::par.on(exec);
+                },
+                a, b, c))
+            << std::endl;
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size",
+            value<std::size_t>()->default_value(100000000),
+            "size of each of the arrays (default: 100000000)")
+        ("test_count",
+            value<int>()->default_value(10),
+            "number of tests to run, the best is reported (default: 10)")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,113 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/compute.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// the ranges have to cover the whole memory area without gaps
+void verify_placement(
+    std::vector<hpx::compute::host::numa_domain_range> const& ranges,
+    std::size_t size)
+{
+    HPX_TEST(!ranges.empty());
+    if (ranges.empty())
+    {
+        return;
+    }
+
+    HPX_TEST_EQ(ranges.front().first, static_cast<std::size_t>(0));
+    HPX_TEST_EQ(ranges.back().last, size);
+    for (std::size_t i = 1; i != ranges.size(); ++i)
+    {
+        HPX_TEST_EQ(ranges[i - 1].last, ranges[i].first);
+        HPX_TEST_NEQ(ranges[i - 1].domain, ranges[i].domain);
+    }
+}
+
+void test_numa_placement_executor(std::size_t size)
+{
+    using executor_type = hpx::compute::host::numa_placement_executor<>;
+
+    // the memory is not initialized, the first touch happens through the
+    // executor
+    std::unique_ptr<int[]> data(new int[size]);
+    executor_type exec(data.get(), size);
+
+    HPX_TEST(!exec.domains().empty());
+    verify_placement(exec.placement(), size * sizeof(int));
+
+    auto policy = hpx::execution::par.on(exec);
+    hpx::fill(policy, data.get(), data.get() + size, 1);
+
+    exec.refresh();
+    verify_placement(exec.placement(), size * sizeof(int));
+
+    policy = hpx::execution::par.on(exec);
+
+    std::atomic<std::size_t> count(0);
+    hpx::for_each(policy, data.get(), data.get() + size, [&](int& v) {
+        ++count;
+        v *= 2;
+    });
+    HPX_TEST_EQ(count.load(), size);
+
+    int const sum = hpx::reduce(policy, data.get(), data.get() + size, 0);
+    HPX_TEST_EQ(static_cast<std::size_t>(sum), 2 * size);
+
+    HPX_TEST(std::all_of(
+        data.get(), data.get() + size, [](int v) { return v == 2; }));
+
+    // the chunks are assigned based on the addresses they refer to, which
+    // must work for parts of the memory area and for unrelated data as well
+    hpx::for_each(
+        policy, data.get() + size / 2, data.get() + size, [](int& v) { ++v; });
+    HPX_TEST(std::all_of(
+        data.get(), data.get() + size / 2, [](int v) { return v == 2; }));
+    HPX_TEST(std::all_of(data.get() + size / 2, data.get() + size,
+        [](int v) { return v == 3; }));
+
+    std::vector<int> other(size, 1);
+    hpx::for_each(policy, other.begin(), other.end(), [](int& v) { ++v; });
+    HPX_TEST(std::all_of(
+        other.begin(), other.end(), [](int v) { return v == 2; }));
+}
+
+int hpx_main()
+{
+    for (std::size_t size : {1, 1000, 1000000, 10000000})
+    {
+        test_numa_placement_executor(size);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -157,6 +157,19 @@
 #  define HPX_PARCEL_MAX_OUTBOUND_MESSAGE_SIZE 1000000
 #endif
 
+/// This defines the maximal average execution time (in nanoseconds) of an
+/// action for its remote invocations to be executed directly on the thread
+/// which has received the parcel. A value of zero disables this. This value
+/// can be changed at runtime by setting the configuration parameter:
+///
+///   hpx.parcel.direct_execution_threshold = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_PARCEL_DIRECT_EXECUTION_THRESHOLD).
+#if !defined(HPX_PARCEL_DIRECT_EXECUTION_THRESHOLD)
+#  define HPX_PARCEL_DIRECT_EXECUTION_THRESHOLD 1000
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // This defines the number of bytes of overhead it takes to serialize a
 // parcel.
@@ -184,6 +197,17 @@
 #  define HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS 4096
 #endif
 
+/// This defines the time (in microseconds) buffered decrement requests for the
+/// global reference counts are held back before being sent to their
+/// destination locality. A value of zero disables time based flushing.
+///
+/// This value can be changes at runtime by setting the configuration parameter:
+///
+///   hpx.agas.refcnt_flush_interval = ...
+#if !defined(HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL)
+#  define HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL 10000
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 /// This defines the initial global reference count associated with any created
 /// object.
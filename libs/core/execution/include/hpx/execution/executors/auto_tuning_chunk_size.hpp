@@ -0,0 +1,310 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/auto_tuning_chunk_size.hpp
+/// \page hpx::execution::experimental::auto_tuning_chunk_size
+/// \headerfile hpx/execution.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assertion/source_location.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/execution.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::execution::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The process-wide table of tuning results used by all instances of
+    /// \a auto_tuning_chunk_size. Every entry is identified by the key of the
+    /// executor parameters object and the (binary) order of magnitude of the
+    /// number of iterations of the algorithm invocation it was collected for.
+    ///
+    /// The table is populated from the file named by the environment variable
+    /// \a HPX_CHUNK_SIZE_TUNING_TABLE (if set) when it is first accessed.
+    /// Converged entries can be written to a file using \a save, which allows
+    /// for subsequent runs to start with the tuned parameters.
+    ///
+    class chunk_size_tuning_table
+    {
+    public:
+        /// \cond NOINTERNAL
+        struct candidate
+        {
+            std::size_t chunk_size = 0;
+            std::size_t cores = 0;
+            std::uint64_t time_per_iteration = 0;    // ps
+            std::size_t samples = 0;
+        };
+
+        struct entry
+        {
+            std::vector<candidate> candidates;
+            std::size_t samples = 1;    // required samples per candidate
+            std::size_t next = 0;
+            std::size_t best = 0;
+            bool converged = false;
+        };
+
+        // the result of selecting a configuration for an invocation
+        struct selection
+        {
+            std::size_t chunk_size = 0;
+            std::size_t cores = 0;
+            std::size_t candidate = static_cast<std::size_t>(-1);
+        };
+        /// \endcond
+
+        /// Return the process-wide tuning table
+        HPX_CORE_EXPORT static chunk_size_tuning_table& get();
+
+        /// Load tuning results from the given file, replacing existing
+        /// entries with the same keys. Returns whether the file could be read.
+        HPX_CORE_EXPORT bool load(std::string const& filename);
+
+        /// Write all converged tuning results to the given file. Returns
+        /// whether the file could be written.
+        HPX_CORE_EXPORT bool save(std::string const& filename) const;
+
+        /// Remove all entries from the table.
+        HPX_CORE_EXPORT void clear();
+
+        /// Return the number of entries in the table
+        [[nodiscard]] HPX_CORE_EXPORT std::size_t size() const;
+
+        /// Return whether the tuning for the given key and number of
+        /// iterations has converged. If it has, \a chunk_size and \a cores
+        /// will be set to the best parameters found.
+        HPX_CORE_EXPORT bool lookup(std::string const& key,
+            std::size_t count, std::size_t& chunk_size,
+            std::size_t& cores) const;
+
+        /// \cond NOINTERNAL
+        HPX_CORE_EXPORT chunk_size_tuning_table();
+
+        chunk_size_tuning_table(chunk_size_tuning_table const&) = delete;
+        chunk_size_tuning_table(chunk_size_tuning_table&&) = delete;
+        chunk_size_tuning_table& operator=(
+            chunk_size_tuning_table const&) = delete;
+        chunk_size_tuning_table& operator=(chunk_size_tuning_table&&) = delete;
+
+        HPX_CORE_EXPORT ~chunk_size_tuning_table();
+
+        // Select the configuration to use for the next invocation. If
+        // 'measure' is false the best configuration found so far is returned
+        // without scheduling a new measurement.
+        HPX_CORE_EXPORT selection select(std::string const& key,
+            std::size_t count, std::size_t available_cores,
+            std::size_t bytes_per_iteration, std::size_t samples, bool measure);
+
+        // Record the measured execution time of an invocation that was
+        // performed using the given selection.
+        HPX_CORE_EXPORT void record(std::string const& key, std::size_t count,
+            selection const& s, std::uint64_t elapsed_ns);
+
+        // L2 cache size per core and L3 cache size of the machine
+        [[nodiscard]] std::size_t l2_cache_size() const noexcept
+        {
+            return l2_cache_size_;
+        }
+        [[nodiscard]] std::size_t l3_cache_size() const noexcept
+        {
+            return l3_cache_size_;
+        }
+        /// \endcond
+
+    private:
+        struct data;
+        std::unique_ptr<data> data_;
+
+        std::size_t l2_cache_size_;
+        std::size_t l3_cache_size_;
+    };
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        // Per-object measurement state, shared between all copies of an
+        // auto_tuning_chunk_size object (algorithms copy their parameters).
+        // Note: as for persistent_auto_chunk_size, the same parameters object
+        // should not be used by concurrently running algorithms.
+        struct auto_tuning_state
+        {
+            HPX_CORE_EXPORT void begin() noexcept;
+            HPX_CORE_EXPORT std::size_t select(std::string const& key,
+                std::size_t count, std::size_t available_cores,
+                std::size_t bytes_per_iteration, std::size_t samples);
+            HPX_CORE_EXPORT std::size_t chunk_size(
+                std::size_t cores, std::size_t count) const noexcept;
+            HPX_CORE_EXPORT void end(std::string const& key) noexcept;
+
+            std::uint64_t start_ = 0;
+            std::size_t count_ = 0;
+            chunk_size_tuning_table::selection selection_;
+            bool measuring_ = false;
+            bool active_ = false;
+        };
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces and then assigned to threads.
+    /// The number of loop iterations combined and the number of cores used
+    /// are learned across invocations of the algorithms the parameters object
+    /// is used with. For each key (typically identifying a call site, an
+    /// algorithm, and the involved types) and order of magnitude of the number
+    /// of iterations a small set of candidate configurations is derived from
+    /// the L2 cache size per core and the L3 cache size of the machine. Each
+    /// candidate is measured over several invocations after which the fastest
+    /// one is used for all subsequent invocations.
+    ///
+    /// The tuning results are stored in the process-wide
+    /// \a chunk_size_tuning_table which can be saved to and loaded from a
+    /// file, allowing production runs to start with tuned parameters.
+    ///
+    struct auto_tuning_chunk_size
+    {
+    public:
+        /// Construct an \a auto_tuning_chunk_size executor parameters object
+        ///
+        /// \param key          [in] The key identifying the tuning results.
+        ///                     Objects constructed with the same key share
+        ///                     their tuning results.
+        /// \param bytes_per_iteration [in] The (approximate) amount of memory
+        ///                     touched by each loop iteration. This is used to
+        ///                     derive the initial chunk sizes from the cache
+        ///                     sizes. If zero, no cache information is used.
+        /// \param samples      [in] The number of invocations used to measure
+        ///                     each candidate configuration.
+        ///
+        explicit auto_tuning_chunk_size(std::string key,
+            std::size_t bytes_per_iteration = 0, std::size_t samples = 3)
+          : key_(HPX_MOVE(key))
+          , bytes_per_iteration_(bytes_per_iteration)
+          , samples_(samples == 0 ? 1 : samples)
+          , state_(std::make_shared<detail::auto_tuning_state>())
+        {
+        }
+
+        /// Construct an \a auto_tuning_chunk_size executor parameters object
+        ///
+        /// \param loc          [in] The source location identifying the
+        ///                     tuning results (usually created using
+        ///                     \a HPX_CURRENT_SOURCE_LOCATION()).
+        /// \param bytes_per_iteration [in] The (approximate) amount of memory
+        ///                     touched by each loop iteration.
+        /// \param samples      [in] The number of invocations used to measure
+        ///                     each candidate configuration.
+        ///
+        explicit auto_tuning_chunk_size(hpx::source_location const& loc,
+            std::size_t bytes_per_iteration = 0, std::size_t samples = 3)
+          : auto_tuning_chunk_size(std::string(loc.file_name()) + ":" +
+                    std::to_string(loc.line()),
+                bytes_per_iteration, samples)
+        {
+        }
+
+        /// Return the key identifying the tuning results of this object
+        [[nodiscard]] std::string const& key() const noexcept
+        {
+            return key_;
+        }
+
+        /// \cond NOINTERNAL
+        auto_tuning_chunk_size()
+          : auto_tuning_chunk_size(std::string())
+        {
+        }
+
+        template <typename Executor>
+        friend void tag_override_invoke(
+            hpx::parallel::execution::mark_begin_execution_t,
+            auto_tuning_chunk_size const& this_, Executor&&) noexcept
+        {
+            this_.state_->begin();
+        }
+
+        // Select the number of cores to use for the current invocation.
+        template <typename Executor>
+        friend std::size_t tag_override_invoke(
+            hpx::parallel::execution::processing_units_count_t,
+            auto_tuning_chunk_size const& this_, Executor&& exec,
+            hpx::chrono::steady_duration const& duration =
+                hpx::chrono::null_duration,
+            std::size_t num_tasks = 0)
+        {
+            std::size_t const available_pus =
+                hpx::parallel::execution::processing_units_count(
+                    exec, duration, num_tasks);
+            if (num_tasks == 0)
+            {
+                return available_pus;
+            }
+            return this_.state_->select(this_.key_, num_tasks, available_pus,
+                this_.bytes_per_iteration_, this_.samples_);
+        }
+
+        template <typename Executor>
+        friend std::size_t tag_override_invoke(
+            hpx::parallel::execution::get_chunk_size_t,
+            auto_tuning_chunk_size const& this_, Executor&&,
+            hpx::chrono::steady_duration const&, std::size_t cores,
+            std::size_t count) noexcept
+        {
+            return this_.state_->chunk_size(cores, count);
+        }
+
+        template <typename Executor>
+        friend void tag_override_invoke(
+            hpx::parallel::execution::mark_end_execution_t,
+            auto_tuning_chunk_size const& this_, Executor&&) noexcept
+        {
+            this_.state_->end(this_.key_);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const /* version */)
+        {
+            // clang-format off
+            ar & key_ & bytes_per_iteration_ & samples_;
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::string key_;
+        std::size_t bytes_per_iteration_;
+        std::size_t samples_;
+        std::shared_ptr<detail::auto_tuning_state> state_;
+        /// \endcond
+    };
+}    // namespace hpx::execution::experimental
+
+/// \cond NOINTERNAL
+template <>
+struct hpx::parallel::execution::is_executor_parameters<
+    hpx::execution::experimental::auto_tuning_chunk_size> : std::true_type
+{
+};
+/// \endcond
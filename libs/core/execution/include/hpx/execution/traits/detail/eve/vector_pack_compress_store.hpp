@@ -0,0 +1,65 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_EVE)
+#include <cstddef>
+#include <type_traits>
+
+#include <eve/module/core.hpp>
+
+namespace hpx::parallel::traits {
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename Vector, typename Mask, typename T>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::size_t compress(
+        Vector const& value, Mask const& msk, T* out)
+    {
+        return static_cast<std::size_t>(
+            eve::compress_store(value, msk, out) - out);
+    }
+
+    // Contiguous destinations of the same element type are written using
+    // eve::compress_store, all other destinations are written lane by lane.
+    template <typename Vector, typename Mask, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter compress_store(
+        Vector const& value, Mask const& msk, Iter dest)
+    {
+        using element_type = typename Vector::value_type;
+
+        if constexpr (std::is_pointer_v<Iter> &&
+            std::is_same_v<std::remove_pointer_t<Iter>, element_type>)
+        {
+            return eve::compress_store(value, msk, dest);
+        }
+        else
+        {
+            if (eve::all(msk))
+            {
+                for (std::size_t i = 0; i != value.size(); ++i)
+                {
+                    *dest++ = value.get(i);
+                }
+            }
+            else if (eve::any(msk))
+            {
+                for (std::size_t i = 0; i != value.size(); ++i)
+                {
+                    if (msk.get(i))
+                    {
+                        *dest++ = value.get(i);
+                    }
+                }
+            }
+            return dest;
+        }
+    }
+}    // namespace hpx::parallel::traits
+
+#endif
@@ -0,0 +1,68 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_EVE)
+#include <hpx/functional/invoke.hpp>
+
+#include <cstddef>
+
+#include <eve/eve.hpp>
+
+namespace hpx::parallel::traits {
+
+    ///////////////////////////////////////////////////////////////////////
+    // The lanes are combined one by one, the operation is not required to
+    // be one of the callables known to EVE.
+    template <typename T, typename Abi, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE eve::wide<T, Abi> inclusive_scan(
+        Op&& op, eve::wide<T, Abi> const& value)
+    {
+        eve::wide<T, Abi> result = value;
+
+        T acc = value.get(0);
+        for (std::size_t i = 1; i != value.size(); ++i)
+        {
+            acc = HPX_INVOKE(op, acc, value.get(i));
+            result.set(i, acc);
+        }
+        return result;
+    }
+
+    template <typename T, typename Abi, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE eve::wide<T, Abi> exclusive_scan(
+        Op&& op, eve::wide<T, Abi> const& value, T const& init)
+    {
+        eve::wide<T, Abi> result = value;
+
+        T acc = init;
+        for (std::size_t i = 0; i != value.size(); ++i)
+        {
+            result.set(i, acc);
+            acc = HPX_INVOKE(op, acc, value.get(i));
+        }
+        return result;
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE eve::wide<T, Abi> shift_lanes_up(
+        eve::wide<T, Abi> const& value, T const& fill)
+    {
+        eve::wide<T, Abi> result = value;
+
+        result.set(0, fill);
+        for (std::size_t i = 1; i != value.size(); ++i)
+        {
+            result.set(i, value.get(i - 1));
+        }
+        return result;
+    }
+}    // namespace hpx::parallel::traits
+
+#endif
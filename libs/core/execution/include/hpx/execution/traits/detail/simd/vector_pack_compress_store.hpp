@@ -0,0 +1,48 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_EXPERIMENTAL_SIMD)
+#include <algorithm>
+#include <cstddef>
+
+#include <hpx/execution/traits/detail/simd/vector_pack_simd.hpp>
+
+namespace hpx::parallel::traits {
+
+    ///////////////////////////////////////////////////////////////////////
+    // std::experimental::simd does not expose a compress operation. The pack
+    // is spilled to memory and its lanes are permuted using a table indexed
+    // by eight mask bits at a time (see detail::compress_lanes).
+    template <typename T, typename Abi, typename Mask>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::size_t compress(
+        datapar::experimental::simd<T, Abi> const& value, Mask const& msk,
+        T* out)
+    {
+        using vector_type = datapar::experimental::simd<T, Abi>;
+        constexpr std::size_t size = vector_type::size();
+
+        alignas(datapar::experimental::memory_alignment_v<vector_type>)
+            T lanes[size];
+        value.copy_to(lanes, datapar::experimental::vector_aligned);
+
+        return detail::compress_lanes<size>(lanes, msk, out);
+    }
+
+    template <typename T, typename Abi, typename Mask, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter compress_store(
+        datapar::experimental::simd<T, Abi> const& value, Mask const& msk,
+        Iter dest)
+    {
+        T buffer[datapar::experimental::simd<T, Abi>::size()];
+        return std::copy_n(buffer, compress(value, msk, buffer), dest);
+    }
+}    // namespace hpx::parallel::traits
+
+#endif
@@ -0,0 +1,100 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_EXPERIMENTAL_SIMD)
+#include <hpx/functional/invoke.hpp>
+
+#include <cstddef>
+
+#include <hpx/execution/traits/detail/simd/vector_pack_simd.hpp>
+
+namespace hpx::parallel::traits {
+
+    namespace detail {
+
+        // Move lane i - Shift of 'value' to lane i, the lanes below 'Shift'
+        // keep their values. The lanes are selected at compile time, which
+        // allows the compiler to emit a single permutation.
+        template <std::size_t Shift, typename T, typename Abi>
+        HPX_HOST_DEVICE HPX_FORCEINLINE datapar::experimental::simd<T, Abi>
+        shift_lanes_up(datapar::experimental::simd<T, Abi> const& value)
+        {
+            return datapar::experimental::simd<T, Abi>([&](auto lane) {
+                constexpr std::size_t i = lane;
+                if constexpr (i >= Shift)
+                {
+                    return value[i - Shift];
+                }
+                else
+                {
+                    return value[i];
+                }
+            });
+        }
+
+        // Combine each lane with the lane 'Shift' positions below it, doubling
+        // the distance in each step (Hillis/Steele).
+        template <std::size_t Shift, typename T, typename Abi, typename Op>
+        HPX_HOST_DEVICE HPX_FORCEINLINE datapar::experimental::simd<T, Abi>
+        scan_lanes(datapar::experimental::simd<T, Abi> value, Op& op)
+        {
+            using vector_type = datapar::experimental::simd<T, Abi>;
+            if constexpr (Shift < vector_type::size())
+            {
+                vector_type const lanes(
+                    [](auto lane) { return static_cast<T>(lane()); });
+
+                where(lanes >= vector_type(static_cast<T>(Shift)), value) =
+                    vector_type(
+                        HPX_INVOKE(op, shift_lanes_up<Shift>(value), value));
+
+                return scan_lanes<2 * Shift>(value, op);
+            }
+            else
+            {
+                return value;
+            }
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE datapar::experimental::simd<T, Abi>
+    inclusive_scan(
+        Op&& op, datapar::experimental::simd<T, Abi> const& value)
+    {
+        return detail::scan_lanes<1>(value, op);
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE datapar::experimental::simd<T, Abi>
+    shift_lanes_up(
+        datapar::experimental::simd<T, Abi> const& value, T const& fill)
+    {
+        datapar::experimental::simd<T, Abi> result =
+            detail::shift_lanes_up<1>(value);
+        result[0] = fill;
+        return result;
+    }
+
+    template <typename T, typename Abi, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE datapar::experimental::simd<T, Abi>
+    exclusive_scan(Op&& op, datapar::experimental::simd<T, Abi> const& value,
+        T const& init)
+    {
+        using vector_type = datapar::experimental::simd<T, Abi>;
+
+        vector_type const result(HPX_INVOKE(
+            op, vector_type(init), detail::scan_lanes<1>(value, op)));
+        return traits::shift_lanes_up(result, init);
+    }
+}    // namespace hpx::parallel::traits
+
+#endif
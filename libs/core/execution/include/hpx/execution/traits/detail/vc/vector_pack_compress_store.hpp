@@ -0,0 +1,64 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_VC)
+#include <algorithm>
+#include <cstddef>
+
+#include <Vc/Vc>
+#include <Vc/global.h>
+
+namespace hpx::parallel::traits {
+
+    ///////////////////////////////////////////////////////////////////////
+    // The pack is spilled to memory and its lanes are permuted using a table
+    // indexed by eight mask bits at a time (see detail::compress_lanes).
+    template <typename T, typename Abi, typename Mask>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::size_t compress(
+        Vc::Vector<T, Abi> const& value, Mask const& msk, T* out)
+    {
+        constexpr std::size_t size = Vc::Vector<T, Abi>::Size;
+
+        alignas(Vc::Vector<T, Abi>::MemoryAlignment) T lanes[size];
+        value.store(lanes, Vc::Aligned);
+
+        return detail::compress_lanes<size>(lanes, msk, out);
+    }
+
+    template <typename T, std::size_t N, typename V, std::size_t W,
+        typename Mask>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::size_t compress(
+        Vc::SimdArray<T, N, V, W> const& value, Mask const& msk, T* out)
+    {
+        T lanes[N];
+        value.store(lanes, Vc::Unaligned);
+
+        return detail::compress_lanes<N>(lanes, msk, out);
+    }
+
+    template <typename T, typename Abi, typename Mask, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter compress_store(
+        Vc::Vector<T, Abi> const& value, Mask const& msk, Iter dest)
+    {
+        T buffer[Vc::Vector<T, Abi>::Size];
+        return std::copy_n(buffer, compress(value, msk, buffer), dest);
+    }
+
+    template <typename T, std::size_t N, typename V, std::size_t W,
+        typename Mask, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter compress_store(
+        Vc::SimdArray<T, N, V, W> const& value, Mask const& msk, Iter dest)
+    {
+        T buffer[N];
+        return std::copy_n(buffer, compress(value, msk, buffer), dest);
+    }
+}    // namespace hpx::parallel::traits
+
+#endif
@@ -0,0 +1,107 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_VC)
+#include <hpx/functional/invoke.hpp>
+
+#include <cstddef>
+
+#include <Vc/Vc>
+#include <Vc/global.h>
+
+namespace hpx::parallel::traits {
+
+    namespace detail {
+
+        // Combine each lane with the lane 'shift' positions below it, doubling
+        // the distance in each step (Hillis/Steele).
+        template <typename Vector, typename Op>
+        HPX_HOST_DEVICE HPX_FORCEINLINE Vector scan_lanes(
+            Vector value, Op& op)
+        {
+            using element_type = typename Vector::EntryType;
+
+            Vector const lanes = Vector::IndexesFromZero();
+            for (std::size_t shift = 1; shift < Vector::size(); shift *= 2)
+            {
+                where(lanes >= Vector(static_cast<element_type>(shift)),
+                    value) = Vector(HPX_INVOKE(op,
+                    value.shifted(-static_cast<int>(shift)), value));
+            }
+            return value;
+        }
+
+        template <typename Vector>
+        HPX_HOST_DEVICE HPX_FORCEINLINE Vector shift_lanes_up(
+            Vector const& value, typename Vector::EntryType const& fill)
+        {
+            Vector result = value.shifted(-1);
+            result[0] = fill;
+            return result;
+        }
+
+        template <typename Vector, typename Op>
+        HPX_HOST_DEVICE HPX_FORCEINLINE Vector exclusive_scan_lanes(
+            Vector const& value, Op& op,
+            typename Vector::EntryType const& init)
+        {
+            return shift_lanes_up(
+                Vector(HPX_INVOKE(op, Vector(init), scan_lanes(value, op))),
+                init);
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Vc::Vector<T, Abi> inclusive_scan(
+        Op&& op, Vc::Vector<T, Abi> const& value)
+    {
+        return detail::scan_lanes(value, op);
+    }
+
+    template <typename T, std::size_t N, typename V, std::size_t W,
+        typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Vc::SimdArray<T, N, V, W> inclusive_scan(
+        Op&& op, Vc::SimdArray<T, N, V, W> const& value)
+    {
+        return detail::scan_lanes(value, op);
+    }
+
+    template <typename T, typename Abi, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Vc::Vector<T, Abi> exclusive_scan(
+        Op&& op, Vc::Vector<T, Abi> const& value, T const& init)
+    {
+        return detail::exclusive_scan_lanes(value, op, init);
+    }
+
+    template <typename T, std::size_t N, typename V, std::size_t W,
+        typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Vc::SimdArray<T, N, V, W> exclusive_scan(
+        Op&& op, Vc::SimdArray<T, N, V, W> const& value, T const& init)
+    {
+        return detail::exclusive_scan_lanes(value, op, init);
+    }
+
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Vc::Vector<T, Abi> shift_lanes_up(
+        Vc::Vector<T, Abi> const& value, T const& fill)
+    {
+        return detail::shift_lanes_up(value, fill);
+    }
+
+    template <typename T, std::size_t N, typename V, std::size_t W>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Vc::SimdArray<T, N, V, W> shift_lanes_up(
+        Vc::SimdArray<T, N, V, W> const& value, T const& fill)
+    {
+        return detail::shift_lanes_up(value, fill);
+    }
+}    // namespace hpx::parallel::traits
+
+#endif
@@ -0,0 +1,115 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::parallel::traits {
+
+    // Write all elements of 'value' for which the corresponding element of
+    // 'mask' is set to consecutive locations starting at 'dest'. Return the
+    // iterator referring to the element past the last element written.
+    template <typename T, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE constexpr Iter compress_store(
+        T const& value, bool mask, Iter dest)
+    {
+        if (mask)
+        {
+            *dest++ = value;
+        }
+        return dest;
+    }
+
+    // Write all elements of 'value' for which the corresponding element of
+    // 'mask' is set to consecutive locations starting at 'out', followed by
+    // unspecified values. 'out' must have room for all elements of 'value'.
+    // Return the number of selected elements.
+    template <typename T>
+    HPX_HOST_DEVICE HPX_FORCEINLINE constexpr std::size_t compress(
+        T const& value, bool mask, T* out)
+    {
+        *out = value;
+        return mask ? 1 : 0;
+    }
+
+    namespace detail {
+
+        // For each combination of eight mask bits the positions of the set
+        // bits and their number. This allows to compress vector packs eight
+        // lanes at a time without branching on individual lanes.
+        struct compress_table
+        {
+            std::uint8_t indices[256][8];
+            std::uint8_t count[256];
+        };
+
+        constexpr compress_table make_compress_table() noexcept
+        {
+            compress_table table{};
+            for (unsigned bits = 0; bits != 256; ++bits)
+            {
+                unsigned count = 0;
+                for (unsigned lane = 0; lane != 8; ++lane)
+                {
+                    if (bits & (1u << lane))
+                    {
+                        table.indices[bits][count++] =
+                            static_cast<std::uint8_t>(lane);
+                    }
+                }
+                table.count[bits] = static_cast<std::uint8_t>(count);
+            }
+            return table;
+        }
+
+        inline constexpr compress_table compress_table_v =
+            make_compress_table();
+
+        // Compress the given lanes of a vector pack using the table above.
+        // All lanes are written to 'out', the selected ones first.
+        template <std::size_t Size, typename T, typename Mask>
+        HPX_HOST_DEVICE HPX_FORCEINLINE std::size_t compress_lanes(
+            T const* lanes, Mask const& msk, T* out) noexcept
+        {
+            std::size_t count = 0;
+            for (std::size_t base = 0; base < Size; base += 8)
+            {
+                constexpr std::size_t group = Size < 8 ? Size : 8;
+
+                unsigned bits = 0;
+                for (std::size_t lane = 0; lane != group; ++lane)
+                {
+                    bits |= static_cast<unsigned>(
+                                static_cast<bool>(msk[base + lane]))
+                        << lane;
+                }
+
+                std::uint8_t const* indices = compress_table_v.indices[bits];
+                for (std::size_t lane = 0; lane != group; ++lane)
+                {
+                    out[count + lane] = lanes[base + indices[lane]];
+                }
+                count += compress_table_v.count[bits];
+            }
+            return count;
+        }
+    }    // namespace detail
+}    // namespace hpx::parallel::traits
+
+#if defined(HPX_HAVE_DATAPAR)
+
+#if !defined(__CUDACC__)
+#include <hpx/execution/traits/detail/eve/vector_pack_compress_store.hpp>
+#include <hpx/execution/traits/detail/simd/vector_pack_compress_store.hpp>
+#include <hpx/execution/traits/detail/vc/vector_pack_compress_store.hpp>
+#endif
+
+#endif
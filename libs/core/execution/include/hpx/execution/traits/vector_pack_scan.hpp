@@ -0,0 +1,51 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+
+namespace hpx::parallel::traits {
+
+    ///////////////////////////////////////////////////////////////////////
+    // Return the inclusive scan of the lanes of 'value', i.e. lane i of the
+    // result combines lanes 0 to i of 'value' using 'op'.
+    template <typename T, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE constexpr T inclusive_scan(
+        Op&&, T const& value) noexcept
+    {
+        return value;
+    }
+
+    // Return the exclusive scan of the lanes of 'value', i.e. lane i of the
+    // result combines 'init' and lanes 0 to i - 1 of 'value' using 'op'.
+    template <typename T, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE constexpr T exclusive_scan(
+        Op&&, T const&, T const& init) noexcept
+    {
+        return init;
+    }
+
+    // Return 'value' with its lanes moved up by one position, the first lane
+    // of the result is 'fill'. This gives the predecessor of each lane of a
+    // pack, with 'fill' being the element preceding the pack.
+    template <typename T>
+    HPX_HOST_DEVICE HPX_FORCEINLINE constexpr T shift_lanes_up(
+        T const&, T const& fill) noexcept
+    {
+        return fill;
+    }
+}    // namespace hpx::parallel::traits
+
+#if !defined(__CUDACC__)
+#include <hpx/execution/traits/detail/eve/vector_pack_scan.hpp>
+#include <hpx/execution/traits/detail/simd/vector_pack_scan.hpp>
+#include <hpx/execution/traits/detail/vc/vector_pack_scan.hpp>
+#endif
+
+#endif
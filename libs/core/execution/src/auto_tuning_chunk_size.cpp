@@ -0,0 +1,372 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/auto_tuning_chunk_size.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx::execution::experimental {
+
+    namespace {
+
+        // Tuning results are kept per binary order of magnitude of the
+        // number of iterations.
+        std::string make_table_key(std::string const& key, std::size_t count)
+        {
+            std::size_t magnitude = 0;
+            while (count >>= 1)
+            {
+                ++magnitude;
+            }
+            return key + "#" + std::to_string(magnitude);
+        }
+
+        void add_unique(std::vector<std::size_t>& values, std::size_t value)
+        {
+            if (std::find(values.begin(), values.end(), value) == values.end())
+            {
+                values.push_back(value);
+            }
+        }
+
+        std::vector<chunk_size_tuning_table::candidate> make_candidates(
+            std::size_t count, std::size_t available_cores,
+            std::size_t bytes_per_iteration, std::size_t l2_cache_size,
+            std::size_t l3_cache_size)
+        {
+            // if the data does not fit into the L3 cache the loop is likely
+            // memory bound, in which case using fewer cores might be faster
+            std::vector<std::size_t> cores{available_cores};
+            if (bytes_per_iteration != 0 && l3_cache_size != 0 &&
+                count * bytes_per_iteration > l3_cache_size)
+            {
+                if (available_cores >= 4)
+                    add_unique(cores, available_cores / 2);
+                if (available_cores >= 8)
+                    add_unique(cores, available_cores / 4);
+            }
+
+            std::vector<chunk_size_tuning_table::candidate> candidates;
+            for (std::size_t const c : cores)
+            {
+                std::size_t const max_chunk_size = (count + c - 1) / c;
+
+                // start off with chunks that fit into the L2 cache of a core,
+                // or with four chunks per core if nothing is known about the
+                // memory footprint of the iterations
+                std::size_t base = (count + 4 * c - 1) / (4 * c);
+                if (bytes_per_iteration != 0 && l2_cache_size != 0)
+                {
+                    base = l2_cache_size / bytes_per_iteration;
+                }
+                base = (std::clamp)(base, std::size_t(1), max_chunk_size);
+
+                std::vector<std::size_t> chunk_sizes;
+                for (std::size_t const factor :
+                    {std::size_t(1), std::size_t(2), std::size_t(4)})
+                {
+                    add_unique(chunk_sizes,
+                        (std::max)(base / factor, std::size_t(1)));
+                    add_unique(
+                        chunk_sizes, (std::min)(base * factor, max_chunk_size));
+                }
+
+                for (std::size_t const chunk_size : chunk_sizes)
+                {
+                    candidates.push_back({chunk_size, c, 0, 0});
+                }
+            }
+            return candidates;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct chunk_size_tuning_table::data
+    {
+        using mutex_type = hpx::spinlock;
+
+        mutable mutex_type mtx_;
+        std::unordered_map<std::string, entry> entries_;
+    };
+
+    chunk_size_tuning_table::chunk_size_tuning_table()
+      : data_(std::make_unique<data>())
+      , l2_cache_size_(0)
+      , l3_cache_size_(0)
+    {
+        auto const& topo = hpx::threads::create_topology();
+        l2_cache_size_ =
+            topo.get_cache_size(topo.get_core_affinity_mask(0), 2);
+        l3_cache_size_ =
+            topo.get_cache_size(topo.get_machine_affinity_mask(), 3);
+
+        if (char const* filename = std::getenv("HPX_CHUNK_SIZE_TUNING_TABLE"))
+        {
+            load(filename);
+        }
+    }
+
+    chunk_size_tuning_table::~chunk_size_tuning_table() = default;
+
+    chunk_size_tuning_table& chunk_size_tuning_table::get()
+    {
+        static chunk_size_tuning_table table;
+        return table;
+    }
+
+    bool chunk_size_tuning_table::load(std::string const& filename)
+    {
+        std::ifstream in(filename);
+        if (!in.is_open())
+        {
+            return false;
+        }
+
+        // every line holds: <chunk_size> <cores> <time_per_iteration> <key>
+        std::unordered_map<std::string, entry> loaded;
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (line.empty() || line[0] == '#')
+                continue;
+
+            std::istringstream strm(line);
+            candidate c;
+            std::string key;
+            if (!(strm >> c.chunk_size >> c.cores >> c.time_per_iteration) ||
+                !std::getline(strm >> std::ws, key) || key.empty() ||
+                c.chunk_size == 0 || c.cores == 0)
+            {
+                continue;
+            }
+
+            c.samples = 1;
+
+            entry e;
+            e.candidates.push_back(c);
+            e.next = 1;
+            e.converged = true;
+            loaded[HPX_MOVE(key)] = HPX_MOVE(e);
+        }
+
+        std::lock_guard<data::mutex_type> l(data_->mtx_);
+        for (auto& e : loaded)
+        {
+            data_->entries_[e.first] = HPX_MOVE(e.second);
+        }
+        return true;
+    }
+
+    bool chunk_size_tuning_table::save(std::string const& filename) const
+    {
+        std::ostringstream strm;
+        {
+            std::lock_guard<data::mutex_type> l(data_->mtx_);
+            for (auto const& e : data_->entries_)
+            {
+                if (!e.second.converged)
+                    continue;
+
+                candidate const& c = e.second.candidates[e.second.best];
+                strm << c.chunk_size << " " << c.cores << " "
+                     << c.time_per_iteration << " " << e.first << "\n";
+            }
+        }
+
+        std::ofstream out(filename);
+        if (!out.is_open())
+        {
+            return false;
+        }
+        out << "# <chunk_size> <cores> <time_per_iteration [ps]> <key>\n"
+            << strm.str();
+        return out.good();
+    }
+
+    void chunk_size_tuning_table::clear()
+    {
+        std::lock_guard<data::mutex_type> l(data_->mtx_);
+        data_->entries_.clear();
+    }
+
+    std::size_t chunk_size_tuning_table::size() const
+    {
+        std::lock_guard<data::mutex_type> l(data_->mtx_);
+        return data_->entries_.size();
+    }
+
+    bool chunk_size_tuning_table::lookup(std::string const& key,
+        std::size_t count, std::size_t& chunk_size, std::size_t& cores) const
+    {
+        std::lock_guard<data::mutex_type> l(data_->mtx_);
+
+        auto const it = data_->entries_.find(make_table_key(key, count));
+        if (it == data_->entries_.end() || !it->second.converged)
+        {
+            return false;
+        }
+
+        candidate const& c = it->second.candidates[it->second.best];
+        chunk_size = c.chunk_size;
+        cores = c.cores;
+        return true;
+    }
+
+    chunk_size_tuning_table::selection chunk_size_tuning_table::select(
+        std::string const& key, std::size_t count, std::size_t available_cores,
+        std::size_t bytes_per_iteration, std::size_t samples, bool measure)
+    {
+        std::string table_key = make_table_key(key, count);
+
+        std::lock_guard<data::mutex_type> l(data_->mtx_);
+
+        auto it = data_->entries_.find(table_key);
+        if (it == data_->entries_.end())
+        {
+            entry e;
+            e.candidates = make_candidates(count, available_cores,
+                bytes_per_iteration, l2_cache_size_, l3_cache_size_);
+            e.samples = samples;
+            it = data_->entries_.emplace(HPX_MOVE(table_key), HPX_MOVE(e))
+                     .first;
+        }
+
+        entry const& e = it->second;
+        if (e.converged || !measure)
+        {
+            // use the best configuration found so far
+            candidate const& c = e.candidates[e.best];
+            return {c.chunk_size, (std::min)(c.cores, available_cores),
+                static_cast<std::size_t>(-1)};
+        }
+
+        candidate const& c = e.candidates[e.next];
+        return {c.chunk_size, (std::min)(c.cores, available_cores), e.next};
+    }
+
+    void chunk_size_tuning_table::record(std::string const& key,
+        std::size_t count, selection const& s, std::uint64_t elapsed_ns)
+    {
+        if (count == 0)
+            return;
+
+        std::string const table_key = make_table_key(key, count);
+
+        std::lock_guard<data::mutex_type> l(data_->mtx_);
+
+        auto const it = data_->entries_.find(table_key);
+        if (it == data_->entries_.end())
+            return;
+
+        entry& e = it->second;
+        if (e.converged || s.candidate != e.next)
+            return;
+
+        // use the minimal time measured as it is least affected by noise
+        candidate& c = e.candidates[s.candidate];
+        std::uint64_t const time_per_iteration = elapsed_ns * 1000 / count;
+        if (c.samples == 0 || time_per_iteration < c.time_per_iteration)
+        {
+            c.time_per_iteration = time_per_iteration;
+        }
+
+        if (++c.samples < e.samples)
+            return;
+
+        if (++e.next == e.candidates.size())
+        {
+            auto const best = std::min_element(e.candidates.begin(),
+                e.candidates.end(),
+                [](candidate const& lhs, candidate const& rhs) {
+                    return lhs.time_per_iteration < rhs.time_per_iteration;
+                });
+
+            e.best = static_cast<std::size_t>(best - e.candidates.begin());
+            e.converged = true;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        void auto_tuning_state::begin() noexcept
+        {
+            start_ = hpx::chrono::high_resolution_clock::now();
+            count_ = 0;
+            measuring_ = false;
+            active_ = true;
+        }
+
+        std::size_t auto_tuning_state::select(std::string const& key,
+            std::size_t count, std::size_t available_cores,
+            std::size_t bytes_per_iteration, std::size_t samples)
+        {
+            if (active_ && count_ == 0)
+            {
+                // first selection after the algorithm has started, this
+                // invocation can be used for measuring a candidate
+                selection_ = chunk_size_tuning_table::get().select(key, count,
+                    available_cores, bytes_per_iteration, samples, true);
+                count_ = count;
+                measuring_ =
+                    selection_.candidate != static_cast<std::size_t>(-1);
+            }
+            else if (count_ != count)
+            {
+                selection_ = chunk_size_tuning_table::get().select(key, count,
+                    available_cores, bytes_per_iteration, samples, false);
+            }
+            return (std::min)(selection_.cores, available_cores);
+        }
+
+        std::size_t auto_tuning_state::chunk_size(
+            std::size_t cores, std::size_t count) const noexcept
+        {
+            if (selection_.chunk_size != 0)
+            {
+                return (std::min)(selection_.chunk_size, count);
+            }
+            return (count + cores - 1) / cores;
+        }
+
+        void auto_tuning_state::end(std::string const& key) noexcept
+        {
+            if (active_ && measuring_)
+            {
+                std::uint64_t const elapsed =
+                    hpx::chrono::high_resolution_clock::now() - start_;
+                try
+                {
+                    chunk_size_tuning_table::get().record(
+                        key, count_, selection_, elapsed);
+                }
+                // NOLINTNEXTLINE(bugprone-empty-catch)
+                catch (...)
+                {
+                    // ignore failures to record the measurement
+                }
+            }
+            count_ = 0;
+            measuring_ = false;
+            active_ = false;
+        }
+    }    // namespace detail
+}    // namespace hpx::execution::experimental
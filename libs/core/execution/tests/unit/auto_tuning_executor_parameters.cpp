@@ -0,0 +1,165 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "foreach_tests.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+void test_auto_tuning_executor_parameters()
+{
+    using iterator_tag = std::random_access_iterator_tag;
+
+    {
+        hpx::execution::experimental::auto_tuning_chunk_size p(
+            "test_for_each");
+        test_for_each(hpx::execution::par.with(p), iterator_tag());
+    }
+
+    {
+        hpx::execution::experimental::auto_tuning_chunk_size p(
+            "test_for_each_async");
+        test_for_each_async(
+            hpx::execution::par(hpx::execution::task).with(p), iterator_tag());
+    }
+
+    hpx::execution::parallel_executor par_exec;
+
+    {
+        hpx::execution::experimental::auto_tuning_chunk_size p(
+            HPX_CURRENT_SOURCE_LOCATION());
+        test_for_each(
+            hpx::execution::par.on(par_exec).with(std::ref(p)), iterator_tag());
+    }
+
+    {
+        hpx::execution::experimental::auto_tuning_chunk_size p(
+            HPX_CURRENT_SOURCE_LOCATION());
+        test_for_each_async(hpx::execution::par(hpx::execution::task)
+                                .on(par_exec)
+                                .with(std::ref(p)),
+            iterator_tag());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_auto_tuning_convergence()
+{
+    using hpx::execution::experimental::chunk_size_tuning_table;
+
+    std::string const key = "test_auto_tuning_convergence";
+    std::size_t const count = 10007;
+
+    hpx::execution::experimental::auto_tuning_chunk_size p(
+        key, sizeof(int), 1);
+
+    std::vector<int> c(count);
+    std::size_t chunk_size = 0;
+    std::size_t cores = 0;
+
+    // each candidate configuration is measured once, the number of candidates
+    // is bounded by 3 (core counts) times 5 (chunk sizes)
+    for (int i = 0; i != 15; ++i)
+    {
+        hpx::for_each(hpx::execution::par.with(p), c.begin(), c.end(),
+            [](int& v) { ++v; });
+
+        if (chunk_size_tuning_table::get().lookup(
+                key, count, chunk_size, cores))
+        {
+            break;
+        }
+    }
+
+    HPX_TEST(
+        chunk_size_tuning_table::get().lookup(key, count, chunk_size, cores));
+    HPX_TEST_NEQ(chunk_size, std::size_t(0));
+    HPX_TEST_NEQ(cores, std::size_t(0));
+    HPX_TEST_LTE(cores, hpx::get_num_worker_threads());
+
+    // the results for a different order of magnitude are tuned separately
+    std::size_t dummy = 0;
+    HPX_TEST(!chunk_size_tuning_table::get().lookup(
+        key, 10 * count, dummy, dummy));
+
+    // all elements have to be visited exactly once per invocation
+    for (int const v : c)
+    {
+        HPX_TEST_EQ(v, c[0]);
+    }
+
+    // save the table, clear it, and load it back
+    std::string const filename =
+        "auto_tuning_executor_parameters." + std::to_string(std::time(nullptr));
+
+    HPX_TEST(chunk_size_tuning_table::get().save(filename));
+    chunk_size_tuning_table::get().clear();
+    HPX_TEST_EQ(chunk_size_tuning_table::get().size(), std::size_t(0));
+
+    HPX_TEST(chunk_size_tuning_table::get().load(filename));
+    std::remove(filename.c_str());
+
+    std::size_t loaded_chunk_size = 0;
+    std::size_t loaded_cores = 0;
+    HPX_TEST(chunk_size_tuning_table::get().lookup(
+        key, count, loaded_chunk_size, loaded_cores));
+    HPX_TEST_EQ(loaded_chunk_size, chunk_size);
+    HPX_TEST_EQ(loaded_cores, cores);
+
+    HPX_TEST(!chunk_size_tuning_table::get().load(filename));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = static_cast<unsigned int>(std::time(nullptr));
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_auto_tuning_executor_parameters();
+    test_auto_tuning_convergence();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,214 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the rate of timer expirations and of small message
+// round trips over a loopback TCP connection handled by an io_service_pool.
+// Running it for builds configured with and without HPX_WITH_ASIO_IO_URING
+// compares the io_uring backend of Asio with the epoll based reactor.
+
+#include <hpx/config.hpp>
+#include <hpx/io_service/io_service_pool.hpp>
+#include <hpx/threading_base/callback_notifier.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <asio/buffer.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/post.hpp>
+#include <asio/read.hpp>
+#include <asio/steady_timer.hpp>
+#include <asio/write.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <iostream>
+#include <system_error>
+
+///////////////////////////////////////////////////////////////////////////////
+char const* backend_name() noexcept
+{
+#if defined(HPX_HAVE_ASIO_IO_URING)
+    return "io_uring";
+#else
+    return "reactor (epoll)";
+#endif
+}
+
+void report(char const* name, std::size_t iterations,
+    std::chrono::steady_clock::duration elapsed)
+{
+    double const seconds = std::chrono::duration<double>(elapsed).count();
+
+    std::cout << name << ": backend = " << backend_name()
+              << ", iterations = " << iterations
+              << ", time = " << seconds << " s, rate = "
+              << static_cast<double>(iterations) / seconds << " ops/s"
+              << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// re-arm a single timer with an immediate expiry from its completion handler
+struct timer_loop
+{
+    void operator()(std::error_code const& ec)
+    {
+        if (ec || ++count == iterations)
+        {
+            done.set_value();
+            return;
+        }
+        timer.expires_after(std::chrono::steady_clock::duration::zero());
+        timer.async_wait(*this);
+    }
+
+    asio::steady_timer& timer;
+    std::size_t iterations;
+    std::size_t& count;
+    std::promise<void>& done;
+};
+
+void measure_timers(hpx::util::io_service_pool& pool, std::size_t iterations)
+{
+    asio::steady_timer timer(pool.get_io_service(0));
+    std::size_t count = 0;
+    std::promise<void> done;
+
+    auto const start = std::chrono::steady_clock::now();
+
+    timer.expires_after(std::chrono::steady_clock::duration::zero());
+    timer.async_wait(timer_loop{timer, iterations, count, done});
+    done.get_future().get();
+
+    report("timer", count, std::chrono::steady_clock::now() - start);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// send a small message back and forth between two connected sockets
+constexpr std::size_t message_size = 64;
+
+struct pingpong_loop
+{
+    using buffer_type = std::array<char, message_size>;
+
+    void ping()
+    {
+        asio::async_write(client, asio::buffer(client_buffer),
+            [this](std::error_code const& ec, std::size_t) {
+                if (!ec)
+                    asio::async_read(server, asio::buffer(server_buffer),
+                        [this](std::error_code const& ec, std::size_t) {
+                            if (!ec)
+                                pong();
+                            else
+                                finish(ec);
+                        });
+                else
+                    finish(ec);
+            });
+    }
+
+    void pong()
+    {
+        asio::async_write(server, asio::buffer(server_buffer),
+            [this](std::error_code const& ec, std::size_t) {
+                if (!ec)
+                    asio::async_read(client, asio::buffer(client_buffer),
+                        [this](std::error_code const& ec, std::size_t) {
+                            if (!ec && ++count != iterations)
+                                ping();
+                            else
+                                finish(ec);
+                        });
+                else
+                    finish(ec);
+            });
+    }
+
+    void finish(std::error_code const& ec)
+    {
+        if (ec)
+            done.set_exception(std::make_exception_ptr(std::system_error(ec)));
+        else
+            done.set_value();
+    }
+
+    asio::ip::tcp::socket& client;
+    asio::ip::tcp::socket& server;
+    std::size_t iterations;
+    std::size_t count = 0;
+    std::promise<void> done;
+    buffer_type client_buffer{};
+    buffer_type server_buffer{};
+};
+
+void measure_pingpong(
+    hpx::util::io_service_pool& pool, std::size_t iterations)
+{
+    asio::io_context& io_service = pool.get_io_service(0);
+
+    asio::ip::tcp::acceptor acceptor(io_service,
+        asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+    asio::ip::tcp::socket client(io_service);
+    asio::ip::tcp::socket server(io_service);
+
+    client.connect(acceptor.local_endpoint());
+    acceptor.accept(server);
+
+    client.set_option(asio::ip::tcp::no_delay(true));
+    server.set_option(asio::ip::tcp::no_delay(true));
+
+    pingpong_loop loop{client, server, iterations};
+
+    auto const start = std::chrono::steady_clock::now();
+
+    asio::post(io_service, [&loop]() { loop.ping(); });
+    loop.done.get_future().get();
+
+    report("pingpong", loop.count, std::chrono::steady_clock::now() - start);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cout << "usage: " << argv[0] << " N";
+        std::cout << std::endl << std::endl;
+        std::cout << "arguments: " << std::endl;
+        std::cout << " N  -- number of iterations" << std::endl << std::endl;
+        return 0;
+    }
+
+    std::size_t iterations;
+    try
+    {
+        iterations = hpx::util::from_string<std::size_t>(argv[1]);
+    }
+    catch (std::exception& exc)
+    {
+        std::cerr << "Error: " << exc.what() << std::endl;
+        std::cerr << "First positional argument must be an integer."
+                  << std::endl;
+        return -1;
+    }
+
+    if (iterations == 0)
+        return 0;
+
+    hpx::threads::policies::callback_notifier const notifier;
+    hpx::util::io_service_pool pool(1, notifier, "io_service_performance");
+    pool.run(false);
+
+    measure_timers(pool, iterations);
+    measure_pingpong(pool, iterations);
+
+    pool.stop();
+    pool.join();
+
+    return 0;
+}
@@ -90,6 +90,7 @@ namespace hpx::util {
         bool get_agas_range_caching_mode() const;
 
         std::size_t get_agas_max_pending_refcnt_requests() const;
+        std::int64_t get_agas_refcnt_flush_interval() const;
 
         // Load application specific configuration and merge it with the
         // default configuration loaded from hpx.ini
@@ -304,6 +304,9 @@ namespace hpx::util {
             "${HPX_AGAS_MAX_PENDING_REFCNT_REQUESTS:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(
                     HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)) "}",
+            "refcnt_flush_interval = "
+            "${HPX_AGAS_REFCNT_FLUSH_INTERVAL:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL)) "}",
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
@@ -920,6 +923,17 @@ namespace hpx::util {
         return HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS;
     }
 
+    std::int64_t runtime_configuration::get_agas_refcnt_flush_interval() const
+    {
+        if (util::section const* sec = get_section("hpx.agas"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::int64_t>(*sec,
+                "refcnt_flush_interval",
+                HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL);
+        }
+        return HPX_INITIAL_AGAS_REFCNT_FLUSH_INTERVAL;
+    }
+
     bool runtime_configuration::get_itt_notify_mode() const
     {
 #if HPX_HAVE_ITTNOTIFY != 0
@@ -39,7 +39,8 @@ namespace hpx::serialization {
         disable_receive_data_chunking = 0x00040000,
         archive_is_saving = 0x00080000,
         archive_is_preprocessing = 0x00100000,
-        all_archive_flags = 0x001fe000    // all of the above
+        compact_parcel_header = 0x00200000,
+        all_archive_flags = 0x003fe000    // all of the above
     };
 
     constexpr archive_flags operator|(
@@ -145,6 +146,14 @@ namespace hpx::serialization {
                     flags_ & archive_flags::disable_receive_data_chunking);
         }
 
+        // Parcels stored in this archive use the compact (variable length)
+        // encoding of their headers.
+        [[nodiscard]] constexpr bool compact_parcel_header() const noexcept
+        {
+            return static_cast<bool>(
+                flags_ & archive_flags::compact_parcel_header);
+        }
+
         [[nodiscard]] constexpr std::uint32_t flags() const noexcept
         {
             return flags_;
@@ -10,6 +10,7 @@
 #include <hpx/config.hpp>
 
 #include <hpx/serialization/brace_initializable_fwd.hpp>
+#include <hpx/serialization/detail/serialize_fused_members.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/std_tuple.hpp>
 #include <hpx/serialization/traits/brace_initializable_traits.hpp>
@@ -33,7 +34,7 @@ namespace hpx::serialization {
     {
         auto& [p1] = t;
         auto&& data = std::forward_as_tuple(p1);
-        serialize(archive, data, version);
+        detail::serialize_fused_members(archive, data, version);
     }
 
     template <typename Archive, typename T>
@@ -42,7 +43,7 @@ namespace hpx::serialization {
     {
         auto& [p1, p2] = t;
         auto&& data = std::forward_as_tuple(p1, p2);
-        serialize(archive, data, version);
+        detail::serialize_fused_members(archive, data, version);
     }
 
     template <typename Archive, typename T>
@@ -51,7 +52,7 @@ namespace hpx::serialization {
     {
         auto& [p1, p2, p3] = t;
         auto&& data = std::forward_as_tuple(p1, p2, p3);
-        serialize(archive, data, version);
+        detail::serialize_fused_members(archive, data, version);
     }
 
     template <typename Archive, typename T>
@@ -60,7 +61,7 @@ namespace hpx::serialization {
     {
         auto& [p1, p2, p3, p4] = t;
         auto&& data = std::forward_as_tuple(p1, p2, p3, p4);
-        serialize(archive, data, version);
+        detail::serialize_fused_members(archive, data, version);
     }
 
     template <typename Archive, typename T>
@@ -69,7 +70,7 @@ namespace hpx::serialization {
     {
         auto& [p1, p2, p3, p4, p5] = t;
         auto&& data = std::forward_as_tuple(p1, p2, p3, p4, p5);
-        serialize(archive, data, version);
+        detail::serialize_fused_members(archive, data, version);
     }
 
     template <typename Archive, typename T>
@@ -78,7 +79,7 @@ namespace hpx::serialization {
     {
         auto& [p1, p2, p3, p4, p5, p6] = t;
         auto&& data = std::forward_as_tuple(p1, p2, p3, p4, p5, p6);
-        serialize(archive, data, version);
+        detail::serialize_fused_members(archive, data, version);
     }
 
     template <typename Archive, typename T>
@@ -87,7 +88,7 @@ namespace hpx::serialization {
     {
         auto& [p1, p2, p3, p4, p5, p6, p7] = t;
         auto&& data = std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7);
-        serialize(archive, data, version);
+        detail::serialize_fused_members(archive, data, version);
     }
 
     template <typename Archive, typename T>
@@ -96,7 +97,7 @@ namespace hpx::serialization {
     {
         auto& [p1, p2, p3, p4, p5, p6, p7, p8] = t;
         auto&& data = std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7, p8);
-        serialize(archive, data, version);
+        detail::serialize_fused_members(archive, data, version);
     }
 
     template <typename Archive, typename T>
@@ -105,7 +106,7 @@ namespace hpx::serialization {
     {
         auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9] = t;
         auto&& data = std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7, p8, p9);
-        serialize(archive, data, version);
+        detail::serialize_fused_members(archive, data, version);
     }
 
     template <typename Archive, typename T>
@@ -115,7 +116,7 @@ namespace hpx::serialization {
         auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10] = t;
         auto&& data =
             std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10);
-        serialize(archive, data, version);
+        detail::serialize_fused_members(archive, data, version);
     }
 
     template <typename Archive, typename T>
@@ -125,7 +126,7 @@ namespace hpx::serialization {
         auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11] = t;
         auto&& data =
             std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11);
-        serialize(archive, data, version);
+        detail::serialize_fused_members(archive, data, version);
     }
 
     template <typename Archive, typename T>
@@ -135,7 +136,7 @@ namespace hpx::serialization {
         auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12] = t;
         auto&& data = std::forward_as_tuple(
             p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12);
-        serialize(archive, data, version);
+        detail::serialize_fused_members(archive, data, version);
     }
 
     template <typename Archive, typename T>
@@ -145,7 +146,7 @@ namespace hpx::serialization {
         auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13] = t;
         auto&& data = std::forward_as_tuple(
             p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13);
-        serialize(archive, data, version);
+        detail::serialize_fused_members(archive, data, version);
     }
 
     template <typename Archive, typename T>
@@ -155,7 +156,7 @@ namespace hpx::serialization {
         auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14] = t;
         auto&& data = std::forward_as_tuple(
             p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14);
-        serialize(archive, data, version);
+        detail::serialize_fused_members(archive, data, version);
     }
 
     template <typename Archive, typename T>
@@ -166,7 +167,7 @@ namespace hpx::serialization {
             p15] = t;
         auto&& data = std::forward_as_tuple(
             p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15);
-        serialize(archive, data, version);
+        detail::serialize_fused_members(archive, data, version);
     }
 
     template <typename Archive, typename T>
@@ -20,14 +20,18 @@
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/traits/needs_automatic_registration.hpp>
 #include <hpx/serialization/traits/polymorphic_traits.hpp>
+#include <hpx/type_support/extra_data.hpp>
 #include <hpx/type_support/static.hpp>
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -100,6 +104,14 @@ namespace hpx::serialization::detail {
         }
     };
 
+    /// Archives tagged with this type transmit the integer ids assigned to the
+    /// registered classes instead of their names (if an id was assigned).
+    /// The ids are agreed upon by all localities during bootstrap, thus this
+    /// is used for the archives of the parcel layer only.
+    struct use_polymorphic_type_ids
+    {
+    };
+
     class polymorphic_nonintrusive_factory
     {
     public:
@@ -110,6 +122,15 @@ namespace hpx::serialization::detail {
             function_bunch_type, std::hash<std::string>>;
         using serializer_typeinfo_map_type = std::unordered_map<std::string,
             std::string, std::hash<std::string>>;
+        using typename_to_id_type =
+            std::unordered_map<std::string, std::uint32_t>;
+        using typename_to_typeinfo_type =
+            std::unordered_map<std::string, std::type_index>;
+        using typeinfo_to_id_type =
+            std::unordered_map<std::type_index, std::uint32_t>;
+        using cache_type = std::vector<function_bunch_type>;
+
+        static constexpr std::uint32_t invalid_id = ~0u;
 
         HPX_CORE_EXPORT static polymorphic_nonintrusive_factory& instance();
 
@@ -135,8 +156,36 @@ namespace hpx::serialization::detail {
                 map_[class_name] = bunch;
             if (jt == typeinfo_map_.end())
                 typeinfo_map_[typeinfo.name()] = class_name;
+            typename_to_typeinfo_.emplace(class_name, typeinfo);
+
+            // populate cache
+            if (auto const kt = typename_to_id_.find(class_name);
+                kt != typename_to_id_.end())
+            {
+                cache_id(kt->second, class_name);
+            }
+        }
+
+        // The following functions are used during bootstrap to assign the
+        // same integer id to each of the registered classes on all
+        // localities. Classes without an assigned id are transmitted by name.
+        HPX_CORE_EXPORT void register_typename(
+            std::string const& class_name, std::uint32_t id);
+
+        HPX_CORE_EXPORT void fill_missing_typenames();
+
+        [[nodiscard]] HPX_CORE_EXPORT std::uint32_t try_get_id(
+            std::string const& class_name) const;
+
+        [[nodiscard]] std::uint32_t get_max_registered_id() const noexcept
+        {
+            return max_id_;
         }
 
+        // returns the (sorted) names of all classes without an assigned id
+        [[nodiscard]] HPX_CORE_EXPORT std::vector<std::string>
+        get_unassigned_typenames() const;
+
         // the following templates are defined in *.ipp file
         template <typename T>
         void save(output_archive& ar, T const& t);
@@ -154,8 +203,29 @@ namespace hpx::serialization::detail {
 
         friend struct hpx::util::static_<polymorphic_nonintrusive_factory>;
 
+        HPX_CORE_EXPORT void cache_id(
+            std::uint32_t id, std::string const& class_name);
+
+        [[nodiscard]] std::uint32_t get_id(
+            std::type_info const& typeinfo) const noexcept
+        {
+            auto const it = typeinfo_to_id_.find(std::type_index(typeinfo));
+            return it != typeinfo_to_id_.end() ? it->second : invalid_id;
+        }
+
+        [[nodiscard]] HPX_CORE_EXPORT function_bunch_type const& get_bunch(
+            std::uint32_t id) const;
+
         serializer_map_type map_;
         serializer_typeinfo_map_type typeinfo_map_;
+
+        // the ids assigned during bootstrap and the flat id to functions
+        // mapping used for dispatching the de-serialization
+        typename_to_id_type typename_to_id_;
+        typename_to_typeinfo_type typename_to_typeinfo_;
+        typeinfo_to_id_type typeinfo_to_id_;
+        cache_type cache_;
+        std::uint32_t max_id_ = 0;
     };
 
     template <typename Derived>
@@ -198,6 +268,19 @@ namespace hpx::serialization::detail {
 
 }    // namespace hpx::serialization::detail
 
+// This is explicitly instantiated to ensure that the id is stable across shared
+// libraries.
+template <>
+struct hpx::util::extra_data_helper<
+    hpx::serialization::detail::use_polymorphic_type_ids>
+{
+    HPX_CORE_EXPORT static extra_data_id_type id() noexcept;
+    static constexpr void reset(
+        serialization::detail::use_polymorphic_type_ids*) noexcept
+    {
+    }
+};
+
 #include <hpx/config/warnings_suffix.hpp>
 
 #define HPX_SERIALIZATION_REGISTER_CLASS_DECLARATION(Class)                    \
@@ -14,6 +14,7 @@
 #include <hpx/serialization/output_archive.hpp>
 #include <hpx/serialization/string.hpp>
 
+#include <cstdint>
 #include <string>
 
 namespace hpx::serialization::detail {
@@ -21,6 +22,19 @@ namespace hpx::serialization::detail {
     template <typename T>
     void polymorphic_nonintrusive_factory::save(output_archive& ar, T const& t)
     {
+        // transmit the id assigned to the class if the receiving end is
+        // known to use the same ids, fall back to sending the name otherwise
+        if (ar.try_get_extra_data<use_polymorphic_type_ids>() != nullptr)
+        {
+            std::uint32_t const id = get_id(typeid(t));
+            ar << id;
+            if (id != invalid_id)
+            {
+                cache_[id].save_function(ar, &t);
+                return;
+            }
+        }
+
         // It's safe to call typeid here. The typeid(t) return value is
         // only used for local lookup to the portable string that goes over the
         // wire
@@ -33,6 +47,17 @@ namespace hpx::serialization::detail {
     template <typename T>
     void polymorphic_nonintrusive_factory::load(input_archive& ar, T& t)
     {
+        if (ar.try_get_extra_data<use_polymorphic_type_ids>() != nullptr)
+        {
+            std::uint32_t id = invalid_id;
+            ar >> id;
+            if (id != invalid_id)
+            {
+                get_bunch(id).load_function(ar, &t);
+                return;
+            }
+        }
+
         std::string class_name;
         ar >> class_name;
 
@@ -42,6 +67,16 @@ namespace hpx::serialization::detail {
     template <typename T>
     T* polymorphic_nonintrusive_factory::load(input_archive& ar)
     {
+        if (ar.try_get_extra_data<use_polymorphic_type_ids>() != nullptr)
+        {
+            std::uint32_t id = invalid_id;
+            ar >> id;
+            if (id != invalid_id)
+            {
+                return static_cast<T*>(get_bunch(id).create_function(ar));
+            }
+        }
+
         std::string class_name;
         ar >> class_name;
 
@@ -0,0 +1,175 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/access.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/serialization/std_tuple.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_serializable.hpp>
+#include <hpx/serialization/traits/polymorphic_traits.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::serialization::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A member of an aggregate can be fused with its neighbors if the archive
+    // would serialize it by copying its bytes anyway. Note that fused integral
+    // and enumeration members are copied using their native size, while they
+    // are widened to 64 bit if serialized one by one.
+    template <typename T>
+    constexpr bool is_fusable_member() noexcept
+    {
+        if constexpr (std::is_volatile_v<T> || std::is_pointer_v<T> ||
+            std::is_member_pointer_v<T> || std::is_array_v<T> ||
+            std::is_empty_v<T> || !std::is_trivially_copyable_v<T>)
+        {
+            return false;
+        }
+        else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+        {
+            return true;
+        }
+        else
+        {
+            return !hpx::traits::is_nonintrusive_polymorphic_v<T> &&
+                !hpx::traits::is_intrusive_polymorphic_v<T> &&
+                !access::has_serialize_v<T> &&
+                !hpx::traits::has_serialize_adl_v<T> &&
+                (hpx::traits::is_bitwise_serializable_v<T> ||
+                    !hpx::traits::is_not_bitwise_serializable_v<T>);
+        }
+    }
+
+    template <typename T>
+    inline constexpr bool is_fusable_member_v =
+        is_fusable_member<std::remove_const_t<T>>();
+
+    // Collects runs of fusable members and hands each run to the archive as
+    // a single block of bytes. While preprocessing (i.e. while only the size
+    // of the serialized data is being calculated), all adjacent fusable
+    // members form a single run regardless of their placement in memory, the
+    // size of such a run is a compile time constant.
+    template <typename Archive, bool Preprocessing>
+    class fused_members
+    {
+    public:
+        explicit constexpr fused_members(Archive& ar) noexcept
+          : ar_(ar)
+        {
+        }
+
+        fused_members(fused_members const&) = delete;
+        fused_members(fused_members&&) = delete;
+        fused_members& operator=(fused_members const&) = delete;
+        fused_members& operator=(fused_members&&) = delete;
+
+        ~fused_members() = default;
+
+        template <typename T>
+        HPX_FORCEINLINE void operator()(T& t)
+        {
+            if constexpr (is_fusable_member_v<T>)
+            {
+                // members are const while saving
+                char* p = const_cast<char*>(
+                    reinterpret_cast<char const*>(std::addressof(t)));
+                if constexpr (Preprocessing)
+                {
+                    if (size_ == 0)
+                        begin_ = p;
+                }
+                else if (begin_ + size_ != p)
+                {
+                    // the member does not immediately follow the current run
+                    flush();
+                    begin_ = p;
+                }
+                size_ += sizeof(T);
+            }
+            else
+            {
+                flush();
+#if !defined(HPX_SERIALIZATION_HAVE_ALLOW_CONST_TUPLE_MEMBERS)
+                serialize_one(ar_, t);
+#else
+                serialize_one(ar_, const_cast<std::remove_const_t<T>&>(t));
+#endif
+            }
+        }
+
+        HPX_FORCEINLINE void flush()
+        {
+            if (size_ != 0)
+            {
+                if constexpr (std::is_same_v<Archive, input_archive>)
+                {
+                    ar_.load_binary(begin_, size_);
+                }
+                else
+                {
+                    ar_.save_binary(begin_, size_);
+                }
+                size_ = 0;
+            }
+        }
+
+    private:
+        Archive& ar_;
+        char* begin_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    template <typename Archive, typename... Ts, std::size_t... Is>
+    void serialize_fused_members(Archive& ar, std::tuple<Ts&...>& t,
+        std::index_sequence<Is...>, unsigned int version)
+    {
+        if constexpr ((is_fusable_member_v<Ts> || ...))
+        {
+            // the members are serialized one by one whenever a bitwise copy
+            // of the whole type would not be allowed either
+            if (ar.disable_array_optimization() || ar.endianess_differs())
+            {
+                hpx::serialization::serialize(ar, t, version);
+            }
+            else if (ar.is_preprocessing())
+            {
+                fused_members<Archive, true> members(ar);
+                (members(std::get<Is>(t)), ...);
+                members.flush();
+            }
+            else
+            {
+                fused_members<Archive, false> members(ar);
+                (members(std::get<Is>(t)), ...);
+                members.flush();
+            }
+        }
+        else
+        {
+            hpx::serialization::serialize(ar, t, version);
+        }
+    }
+
+    // Serialize the members of an aggregate (as exposed by a structured
+    // binding), merging runs of members that are copied bitwise and that are
+    // contiguous in memory into a single copy operation.
+    template <typename Archive, typename... Ts>
+    void serialize_fused_members(
+        Archive& ar, std::tuple<Ts&...>& t, unsigned int version)
+    {
+        serialize_fused_members(
+            ar, t, std::index_sequence_for<Ts...>{}, version);
+    }
+}    // namespace hpx::serialization::detail
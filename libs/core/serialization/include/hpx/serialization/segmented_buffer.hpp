@@ -0,0 +1,292 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/binary_filter.hpp>
+#include <hpx/serialization/traits/serialization_access_data.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::serialization {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A segmented_output_buffer can be used as the container of an
+    /// \a output_archive. Instead of collecting all of the serialized data in
+    /// one contiguous buffer, the data is collected in a fixed size segment
+    /// which is handed to the \a sink whenever it is full. This bounds the
+    /// memory required for serializing arbitrarily large objects by the
+    /// segment size.
+    ///
+    /// The last (partially filled) segment is handed to the sink by calling
+    /// \a flush after the archive has been flushed (or destroyed). Data
+    /// referred to by zero-copy chunks (if the archive was given a chunk
+    /// vector) is not copied into the segments.
+    class segmented_output_buffer
+    {
+    public:
+        using sink_type = std::function<void(char const*, std::size_t)>;
+
+        static constexpr std::size_t default_segment_size = 1024 * 1024;
+
+        explicit segmented_output_buffer(
+            sink_type sink, std::size_t segment_size = default_segment_size)
+          : sink_(HPX_MOVE(sink))
+          , segment_size_(segment_size != 0 ? segment_size : 1)
+          , size_(0)
+        {
+            segment_.reserve(segment_size_);
+        }
+
+        /// Hand the remaining data to the sink.
+        void flush()
+        {
+            if (!segment_.empty())
+            {
+                emit();
+            }
+        }
+
+        /// Return the overall number of bytes written so far
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] constexpr std::size_t segment_size() const noexcept
+        {
+            return segment_size_;
+        }
+
+        /// \cond NOINTERNAL
+        void write(void const* address, std::size_t count)
+        {
+            size_ += count;
+
+            auto const* data = static_cast<char const*>(address);
+            while (count != 0)
+            {
+                std::size_t const n =
+                    (std::min) (count, segment_size_ - segment_.size());
+                segment_.insert(segment_.end(), data, data + n);
+                data += n;
+                count -= n;
+
+                if (segment_.size() == segment_size_)
+                {
+                    emit();
+                }
+            }
+        }
+
+        bool flush(binary_filter* filter, std::size_t& written)
+        {
+            // let the filter write directly into the free part of the
+            // current segment
+            std::size_t const used = segment_.size();
+            segment_.resize(segment_size_);
+
+            bool const flushed =
+                filter->flush(segment_.data() + used, segment_size_ - used,
+                    written);
+
+            HPX_ASSERT(used + written <= segment_size_);
+            segment_.resize(used + written);
+            size_ += written;
+
+            if (segment_.size() == segment_size_)
+            {
+                emit();
+            }
+            return flushed;
+        }
+
+        void reset()
+        {
+            segment_.clear();
+            size_ = 0;
+        }
+        /// \endcond
+
+    private:
+        void emit()
+        {
+            sink_(segment_.data(), segment_.size());
+            segment_.clear();
+        }
+
+        sink_type sink_;
+        std::vector<char> segment_;
+        std::size_t segment_size_;
+        std::size_t size_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A segmented_input_buffer can be used as the container of an
+    /// \a input_archive. The serialized data is requested from the \a source
+    /// in fixed size segments whenever the archive needs more data. This
+    /// bounds the memory required for de-serializing arbitrarily large
+    /// objects by the segment size. The source is expected to copy up to the
+    /// given number of bytes into the supplied buffer and to return the
+    /// number of bytes copied (zero if there is no more data).
+    ///
+    /// Compressed archives are not supported as the compression filters
+    /// require all of the data to be available at once.
+    class segmented_input_buffer
+    {
+    public:
+        using source_type = std::function<std::size_t(char*, std::size_t)>;
+
+        static constexpr std::size_t default_segment_size = 1024 * 1024;
+
+        explicit segmented_input_buffer(
+            source_type source, std::size_t segment_size = default_segment_size)
+          : source_(HPX_MOVE(source))
+          , segment_size_(segment_size != 0 ? segment_size : 1)
+          , current_(0)
+          , size_(0)
+        {
+        }
+
+        /// Return the overall number of bytes read so far
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] constexpr std::size_t segment_size() const noexcept
+        {
+            return segment_size_;
+        }
+
+        /// \cond NOINTERNAL
+        // The archive accesses its container through a const reference, thus
+        // the read position is stored in mutable members.
+        void read(void* address, std::size_t count) const
+        {
+            auto* data = static_cast<char*>(address);
+            while (count != 0)
+            {
+                if (current_ == segment_.size() && !fill())
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                        "segmented_input_buffer::read",
+                        "archive data bstream is too short");
+                }
+
+                std::size_t const n =
+                    (std::min) (count, segment_.size() - current_);
+                std::memcpy(data, segment_.data() + current_, n);
+                current_ += n;
+                size_ += n;
+                data += n;
+                count -= n;
+            }
+        }
+        /// \endcond
+
+    private:
+        bool fill() const
+        {
+            segment_.resize(segment_size_);
+            std::size_t const read = source_(segment_.data(), segment_size_);
+            HPX_ASSERT(read <= segment_size_);
+
+            segment_.resize(read);
+            current_ = 0;
+            return read != 0;
+        }
+
+        source_type source_;
+        std::size_t segment_size_;
+
+        mutable std::vector<char> segment_;
+        mutable std::size_t current_;
+        mutable std::size_t size_;
+    };
+}    // namespace hpx::serialization
+
+namespace hpx::traits {
+
+    template <>
+    struct serialization_access_data<serialization::segmented_output_buffer>
+      : default_serialization_access_data<
+            serialization::segmented_output_buffer>
+    {
+        using container_type = serialization::segmented_output_buffer;
+
+        // the data is handed to the sink in segments, there is no need to
+        // ever resize the container
+        [[nodiscard]] static constexpr std::size_t size(
+            container_type const&) noexcept
+        {
+            return (std::numeric_limits<std::size_t>::max)();
+        }
+
+        static constexpr void resize(container_type&, std::size_t) noexcept {}
+
+        static void write(container_type& cont, std::size_t count,
+            [[maybe_unused]] std::size_t current, void const* address)
+        {
+            HPX_ASSERT(current == cont.size());
+            cont.write(address, count);
+        }
+
+        static bool flush(serialization::binary_filter* filter,
+            container_type& cont, [[maybe_unused]] std::size_t current,
+            std::size_t, std::size_t& written)
+        {
+            HPX_ASSERT(current == cont.size());
+            return cont.flush(filter, written);
+        }
+
+        static void reset(container_type& cont)
+        {
+            cont.reset();
+        }
+    };
+
+    template <>
+    struct serialization_access_data<serialization::segmented_input_buffer>
+      : default_serialization_access_data<serialization::segmented_input_buffer>
+    {
+        using container_type = serialization::segmented_input_buffer;
+
+        // the overall size of the data is not known in advance, reading past
+        // the end of the data supplied by the source raises an error
+        [[nodiscard]] static constexpr std::size_t size(
+            container_type const&) noexcept
+        {
+            return (std::numeric_limits<std::size_t>::max)();
+        }
+
+        static void read(container_type const& cont, std::size_t count,
+            [[maybe_unused]] std::size_t current, void* address)
+        {
+            HPX_ASSERT(current == cont.size());
+            cont.read(address, count);
+        }
+
+        [[noreturn]] static std::size_t init_data(container_type const&,
+            serialization::binary_filter*, std::size_t, std::size_t)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "segmented_input_buffer::init_data",
+                "compressed archives can't be read from a "
+                "segmented_input_buffer");
+        }
+    };
+}    // namespace hpx::traits
@@ -15,6 +15,7 @@
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/serialize_buffer_fwd.hpp>
+#include <hpx/serialization/zero_copy_receive_allocator.hpp>
 
 #if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
 #include <boost/shared_array.hpp>
@@ -22,6 +23,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <type_traits>
 
 namespace hpx::serialization {
 
@@ -390,11 +392,14 @@ namespace hpx::serialization {
         {
             ar >> size_ >> alloc_;    // -V128
 
-            data_ = buffer_type(
-                detail::array_allocator<allocator_type>()(alloc_, size_),
-                [alloc = this->alloc_, size = this->size_](T* p) noexcept {
-                    detail::array_deleter<allocator_type>()(p, alloc, size);
-                });
+            if (!allocate_receive_buffer(ar))
+            {
+                data_ = buffer_type(
+                    detail::array_allocator<allocator_type>()(alloc_, size_),
+                    [alloc = this->alloc_, size = this->size_](T* p) noexcept {
+                        detail::array_deleter<allocator_type>()(p, alloc, size);
+                    });
+            }
 
             if (size_ != 0)
             {
@@ -402,6 +407,42 @@ namespace hpx::serialization {
             }
         }
 
+        // Allocate the memory the data is received into using the
+        // zero_copy_receive_allocator attached to the archive (if any).
+        template <typename Archive>
+        bool allocate_receive_buffer([[maybe_unused]] Archive& ar)
+        {
+            if constexpr (std::is_trivial_v<T>)
+            {
+                auto const* receive_alloc = ar.template try_get_extra_data<
+                    zero_copy_receive_allocator>();
+
+                std::size_t const size = size_ * sizeof(T);
+                if (receive_alloc == nullptr || !*receive_alloc || size == 0 ||
+                    size < receive_alloc->min_size)
+                {
+                    return false;
+                }
+
+                void* buffer = receive_alloc->allocate(
+                    size, alignof(T), receive_alloc->data);
+                if (buffer == nullptr)
+                {
+                    return false;    // fall back to the default allocation
+                }
+
+                data_.reset(static_cast<T*>(buffer),
+                    [alloc = *receive_alloc, size](T* p) noexcept {
+                        alloc.deallocate(p, size, alignof(T), alloc.data);
+                    });
+                return true;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
         HPX_SERIALIZATION_SPLIT_MEMBER()
 
         // this is needed for util::any
@@ -0,0 +1,71 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/type_support/extra_data.hpp>
+
+#include <cstddef>
+
+namespace hpx::serialization {
+
+    /// A zero_copy_receive_allocator supplies the memory large arrays of
+    /// bitwise serializable elements (as held by a \a serialize_buffer) are
+    /// received into. If the parcelport supports zero-copy receive
+    /// operations, the received data is placed directly into this memory
+    /// (e.g. memory that was registered with the network), otherwise the data
+    /// is copied there from the receive buffers.
+    ///
+    /// The \a allocate function may return nullptr to decline an allocation,
+    /// in which case the memory is allocated as usual. The memory returned by
+    /// \a allocate is released by calling \a deallocate once the received
+    /// buffer is not referenced anymore, both functions are passed the
+    /// user-supplied \a data.
+    struct zero_copy_receive_allocator
+    {
+        using allocate_function = void* (*) (std::size_t size,
+            std::size_t alignment, void* data);
+        using deallocate_function = void (*)(void* p, std::size_t size,
+            std::size_t alignment, void* data) noexcept;
+
+        allocate_function allocate = nullptr;
+        deallocate_function deallocate = nullptr;
+        void* data = nullptr;
+
+        // arrays smaller than this (in bytes) are allocated as usual
+        std::size_t min_size = 0;
+
+        [[nodiscard]] explicit constexpr operator bool() const noexcept
+        {
+            return allocate != nullptr && deallocate != nullptr;
+        }
+    };
+
+    /// Register the allocator to use for all subsequently received arrays.
+    /// Passing a default constructed allocator disables the use of any
+    /// previously registered allocator.
+    HPX_CORE_EXPORT void set_zero_copy_receive_allocator(
+        zero_copy_receive_allocator const& alloc);
+
+    /// Return the currently registered allocator (if any).
+    [[nodiscard]] HPX_CORE_EXPORT zero_copy_receive_allocator
+    get_zero_copy_receive_allocator();
+}    // namespace hpx::serialization
+
+// This is explicitly instantiated to ensure that the id is stable across shared
+// libraries.
+template <>
+struct hpx::util::extra_data_helper<
+    hpx::serialization::zero_copy_receive_allocator>
+{
+    HPX_CORE_EXPORT static extra_data_id_type id() noexcept;
+    static constexpr void reset(
+        serialization::zero_copy_receive_allocator* alloc) noexcept
+    {
+        *alloc = serialization::zero_copy_receive_allocator();
+    }
+};
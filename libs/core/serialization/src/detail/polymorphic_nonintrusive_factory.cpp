@@ -7,7 +7,18 @@
 //  See accompanying file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
+#include <hpx/type_support/extra_data.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <typeindex>
+#include <vector>
 
 namespace hpx::serialization::detail {
 
@@ -17,4 +28,106 @@ namespace hpx::serialization::detail {
         hpx::util::static_<polymorphic_nonintrusive_factory> factory;
         return factory.get();
     }
+
+    void polymorphic_nonintrusive_factory::cache_id(
+        std::uint32_t id, std::string const& class_name)
+    {
+        auto const it = map_.find(class_name);
+        if (it == map_.end())
+            return;
+
+        if (id >= cache_.size())    //-V104
+        {
+            cache_.resize(static_cast<std::size_t>(id) + 1,
+                function_bunch_type{nullptr, nullptr, nullptr});
+        }
+        cache_[id] = it->second;    //-V108
+
+        if (auto const jt = typename_to_typeinfo_.find(class_name);
+            jt != typename_to_typeinfo_.end())
+        {
+            typeinfo_to_id_.emplace(jt->second, id);
+        }
+    }
+
+    void polymorphic_nonintrusive_factory::register_typename(
+        std::string const& class_name, std::uint32_t id)
+    {
+        HPX_ASSERT(id != invalid_id);
+
+        if (auto const [it, inserted] = typename_to_id_.emplace(class_name, id);
+            !inserted && it->second != id)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "polymorphic_nonintrusive_factory::register_typename",
+                "failed to insert {} into typename to id registry",
+                class_name);
+        }
+
+        // populate cache
+        cache_id(id, class_name);
+
+        if (id > max_id_)
+            max_id_ = id;
+    }
+
+    // This assigns ids to all classes that don't have one yet.
+    void polymorphic_nonintrusive_factory::fill_missing_typenames()
+    {
+        for (std::string const& str : get_unassigned_typenames())
+            register_typename(str, ++max_id_);
+    }
+
+    std::uint32_t polymorphic_nonintrusive_factory::try_get_id(
+        std::string const& class_name) const
+    {
+        auto const it = typename_to_id_.find(class_name);
+        if (it == typename_to_id_.end())
+            return invalid_id;
+
+        return it->second;
+    }
+
+    std::vector<std::string>
+    polymorphic_nonintrusive_factory::get_unassigned_typenames() const
+    {
+        std::vector<std::string> result;
+        for (auto const& [name, _] : map_)
+        {
+            if (!typename_to_id_.count(name))
+            {
+                result.push_back(name);
+            }
+        }
+
+        // the ids are assigned in this order, make it independent of the
+        // order of registration
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    function_bunch_type const& polymorphic_nonintrusive_factory::get_bunch(
+        std::uint32_t id) const
+    {
+        if (id >= cache_.size() ||
+            cache_[id].create_function == nullptr)    //-V108
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "polymorphic_nonintrusive_factory::get_bunch",
+                "Unknown type descriptor (unknown id): {}", id);
+        }
+        return cache_[id];    //-V108
+    }
 }    // namespace hpx::serialization::detail
+
+namespace hpx::util {
+
+    // This is explicitly instantiated to ensure that the id is stable across
+    // shared libraries.
+    extra_data_id_type extra_data_helper<
+        serialization::detail::use_polymorphic_type_ids>::id() noexcept
+    {
+        static std::uint8_t id = 0;
+        return &id;
+    }
+}    // namespace hpx::util
@@ -0,0 +1,66 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/zero_copy_receive_allocator.hpp>
+#include <hpx/type_support/extra_data.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace hpx::serialization {
+
+    namespace {
+
+        std::atomic<bool> has_receive_allocator(false);
+
+        std::mutex& receive_allocator_mtx()
+        {
+            static std::mutex mtx;
+            return mtx;
+        }
+
+        zero_copy_receive_allocator& receive_allocator()
+        {
+            static zero_copy_receive_allocator alloc;
+            return alloc;
+        }
+    }    // namespace
+
+    void set_zero_copy_receive_allocator(
+        zero_copy_receive_allocator const& alloc)
+    {
+        std::lock_guard l(receive_allocator_mtx());
+        receive_allocator() = alloc;
+        has_receive_allocator.store(
+            static_cast<bool>(alloc), std::memory_order_release);
+    }
+
+    zero_copy_receive_allocator get_zero_copy_receive_allocator()
+    {
+        // avoid acquiring the lock if no allocator is registered
+        if (!has_receive_allocator.load(std::memory_order_acquire))
+        {
+            return {};
+        }
+
+        std::lock_guard l(receive_allocator_mtx());
+        return receive_allocator();
+    }
+}    // namespace hpx::serialization
+
+namespace hpx::util {
+
+    // This is explicitly instantiated to ensure that the id is stable across
+    // shared libraries.
+    extra_data_id_type extra_data_helper<
+        serialization::zero_copy_receive_allocator>::id() noexcept
+    {
+        static std::uint8_t id = 0;
+        return &id;
+    }
+}    // namespace hpx::util
@@ -0,0 +1,203 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the size of the serialized data and the time needed
+// to deserialize objects of non-intrusively registered polymorphic types. The
+// archives either identify the types by their (possibly long) names or by the
+// integer ids assigned to the registered types during bootstrap, as done by
+// the parcel layer.
+
+#include <hpx/serialization/base_object.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/shared_ptr.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace hpx_test {
+
+    struct base
+    {
+        base() = default;
+        explicit base(int value)
+          : value(value)
+        {
+        }
+        virtual ~base() = default;
+
+        int value = 0;
+    };
+
+    template <typename Archive>
+    void serialize(Archive& ar, base& b, unsigned)
+    {
+        ar& b.value;
+    }
+
+    template <int N>
+    struct derived : base
+    {
+        derived() = default;
+        explicit derived(int value)
+          : base(value)
+        {
+        }
+    };
+
+    template <typename Archive, int N>
+    void serialize(Archive& ar, derived<N>& d, unsigned)
+    {
+        ar& hpx::serialization::base_object<base>(d);
+    }
+
+    using object_list = std::vector<std::shared_ptr<base>>;
+
+    void to_vector(object_list const& objects, std::vector<char>& data,
+        bool use_ids)
+    {
+        hpx::serialization::output_archive archiver(data);
+        if (use_ids)
+        {
+            archiver.get_extra_data<
+                hpx::serialization::detail::use_polymorphic_type_ids>();
+        }
+        archiver << objects;
+    }
+
+    void from_vector(
+        object_list& objects, std::vector<char> const& data, bool use_ids)
+    {
+        hpx::serialization::input_archive archiver(data);
+        if (use_ids)
+        {
+            archiver.get_extra_data<
+                hpx::serialization::detail::use_polymorphic_type_ids>();
+        }
+        archiver >> objects;
+    }
+}    // namespace hpx_test
+
+HPX_TRAITS_NONINTRUSIVE_POLYMORPHIC(hpx_test::base)
+
+// use names similar to the ones generated for actions
+HPX_SERIALIZATION_REGISTER_CLASS_NAME(hpx_test::derived<0>,
+    "hpx::actions::transfer_continuation_action<hpx_test::derived<0>>")
+HPX_SERIALIZATION_REGISTER_CLASS_NAME(hpx_test::derived<1>,
+    "hpx::actions::transfer_continuation_action<hpx_test::derived<1>>")
+HPX_SERIALIZATION_REGISTER_CLASS_NAME(hpx_test::derived<2>,
+    "hpx::actions::transfer_continuation_action<hpx_test::derived<2>>")
+HPX_SERIALIZATION_REGISTER_CLASS_NAME(hpx_test::derived<3>,
+    "hpx::actions::transfer_continuation_action<hpx_test::derived<3>>")
+
+void hpx_serialization_test(
+    hpx_test::object_list const& objects, std::size_t iterations, bool use_ids)
+{
+    using namespace hpx_test;
+
+    object_list received;
+    std::vector<char> serialized;
+    to_vector(objects, serialized, use_ids);
+    from_vector(received, serialized, use_ids);
+
+    if (received.size() != objects.size())
+    {
+        throw std::logic_error("hpx's case: deserialization failed");
+    }
+
+    std::chrono::high_resolution_clock::duration decode_time{};
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        serialized.clear();
+        to_vector(objects, serialized, use_ids);
+
+        auto const decode_start = std::chrono::high_resolution_clock::now();
+        from_vector(received, serialized, use_ids);
+        decode_time += std::chrono::high_resolution_clock::now() - decode_start;
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    auto duration =
+        std::chrono::duration_cast<std::chrono::microseconds>(finish - start)
+            .count();
+    auto decode_duration =
+        std::chrono::duration_cast<std::chrono::microseconds>(decode_time)
+            .count();
+
+    std::cout << "hpx: " << (use_ids ? "type ids" : "type names") << std::endl
+              << "hpx: size    = " << serialized.size() << " bytes"
+              << std::endl
+              << "hpx: time    = " << duration << " microseconds" << std::endl
+              << "hpx: decode  = " << decode_duration << " microseconds"
+              << std::endl
+              << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cout << "usage: " << argv[0] << " N";
+        std::cout << std::endl << std::endl;
+        std::cout << "arguments: " << std::endl;
+        std::cout << " N  -- number of iterations" << std::endl << std::endl;
+        return 0;
+    }
+
+    std::size_t iterations;
+    try
+    {
+        iterations = hpx::util::from_string<std::size_t>(argv[1]);
+    }
+    catch (std::exception& exc)
+    {
+        std::cerr << "Error: " << exc.what() << std::endl;
+        std::cerr << "First positional argument must be an integer."
+                  << std::endl;
+        return -1;
+    }
+
+    hpx_test::object_list objects;
+    for (int i = 0; i != 100; ++i)
+    {
+        switch (i % 4)
+        {
+        case 0:
+            objects.push_back(std::make_shared<hpx_test::derived<0>>(i));
+            break;
+        case 1:
+            objects.push_back(std::make_shared<hpx_test::derived<1>>(i));
+            break;
+        case 2:
+            objects.push_back(std::make_shared<hpx_test::derived<2>>(i));
+            break;
+        default:
+            objects.push_back(std::make_shared<hpx_test::derived<3>>(i));
+            break;
+        }
+    }
+
+    // measure using the type names first, then assign the type ids (this is
+    // normally done while bootstrapping the runtime)
+    hpx_serialization_test(objects, iterations, false);
+
+    hpx::serialization::detail::polymorphic_nonintrusive_factory::instance()
+        .fill_missing_typenames();
+
+    hpx_serialization_test(objects, iterations, true);
+
+    return 0;
+}
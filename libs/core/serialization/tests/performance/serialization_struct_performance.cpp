@@ -0,0 +1,188 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the time needed to serialize and deserialize
+// aggregates mixing bitwise serializable members with strings and vectors,
+// which are serialized member by member through their structured bindings.
+// The archives are run once with the default flags (runs of contiguous
+// bitwise serializable members are copied at once) and once with disabled
+// array optimizations (all members are serialized separately).
+
+#include <hpx/serialization/brace_initializable.hpp>
+#include <hpx/serialization/detail/preprocess_container.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace hpx_test {
+
+    enum class message_kind : std::uint8_t
+    {
+        request,
+        response,
+        notification
+    };
+
+    // small message as sent for a remote invocation
+    struct small_message
+    {
+        std::uint64_t source;
+        std::uint64_t destination;
+        std::uint32_t action_id;
+        message_kind kind;
+        std::uint16_t priority;
+        std::string name;
+        std::vector<double> arguments;
+    };
+
+    bool operator==(small_message const& lhs, small_message const& rhs)
+    {
+        return lhs.source == rhs.source && lhs.destination == rhs.destination &&
+            lhs.action_id == rhs.action_id && lhs.kind == rhs.kind &&
+            lhs.priority == rhs.priority && lhs.name == rhs.name &&
+            lhs.arguments == rhs.arguments;
+    }
+
+    // message dominated by fixed size members
+    struct status_message
+    {
+        std::uint64_t id;
+        std::int64_t timestamp;
+        double load;
+        double memory;
+        std::uint32_t threads;
+        std::uint32_t pending;
+        std::uint32_t suspended;
+        bool idle;
+        std::string host;
+        double average_idle_rate;
+        double average_task_duration;
+        std::int64_t tasks_executed;
+        std::vector<std::uint32_t> queue_lengths;
+    };
+
+    bool operator==(status_message const& lhs, status_message const& rhs)
+    {
+        return lhs.id == rhs.id && lhs.timestamp == rhs.timestamp &&
+            lhs.load == rhs.load && lhs.memory == rhs.memory &&
+            lhs.threads == rhs.threads && lhs.pending == rhs.pending &&
+            lhs.suspended == rhs.suspended && lhs.idle == rhs.idle &&
+            lhs.host == rhs.host &&
+            lhs.average_idle_rate == rhs.average_idle_rate &&
+            lhs.average_task_duration == rhs.average_task_duration &&
+            lhs.tasks_executed == rhs.tasks_executed &&
+            lhs.queue_lengths == rhs.queue_lengths;
+    }
+
+    template <typename T>
+    void to_vector(T const& msg, std::vector<char>& data, std::uint32_t flags)
+    {
+        {
+            hpx::serialization::detail::preprocess_container p;
+            hpx::serialization::output_archive archiver(p, flags);
+            archiver << msg;
+            data.reserve(p.size());
+        }
+        hpx::serialization::output_archive archiver(data, flags);
+        archiver << msg;
+    }
+
+    template <typename T>
+    void from_vector(T& msg, std::vector<char> const& data)
+    {
+        hpx::serialization::input_archive archiver(data);
+        archiver >> msg;
+    }
+}    // namespace hpx_test
+
+template <typename T>
+void hpx_serialization_test(char const* name, T const& msg,
+    std::size_t iterations, std::uint32_t flags)
+{
+    using namespace hpx_test;
+
+    T received{};
+    std::vector<char> serialized;
+    to_vector(msg, serialized, flags);
+    from_vector(received, serialized);
+
+    if (!(msg == received))
+    {
+        throw std::logic_error("hpx's case: deserialization failed");
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        serialized.clear();
+        to_vector(msg, serialized, flags);
+        from_vector(received, serialized);
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    auto duration =
+        std::chrono::duration_cast<std::chrono::microseconds>(finish - start)
+            .count();
+
+    std::cout << "hpx: " << name
+              << (flags == 0 ? " (fused)" : " (member-wise)") << std::endl
+              << "hpx: size    = " << serialized.size() << " bytes"
+              << std::endl
+              << "hpx: time    = " << duration << " microseconds" << std::endl
+              << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cout << "usage: " << argv[0] << " N";
+        std::cout << std::endl << std::endl;
+        std::cout << "arguments: " << std::endl;
+        std::cout << " N  -- number of iterations" << std::endl << std::endl;
+        return 0;
+    }
+
+    std::size_t iterations;
+    try
+    {
+        iterations = hpx::util::from_string<std::size_t>(argv[1]);
+    }
+    catch (std::exception& exc)
+    {
+        std::cerr << "Error: " << exc.what() << std::endl;
+        std::cerr << "First positional argument must be an integer."
+                  << std::endl;
+        return -1;
+    }
+
+    hpx_test::small_message const small{1, 2, 42,
+        hpx_test::message_kind::request, 3, "small_message_action",
+        {1.0, 2.0, 3.0, 4.0}};
+
+    hpx_test::status_message const status{17, 1234567890, 0.75, 0.5, 32, 128,
+        4, false, "node017", 0.125, 17.5, 987654321, {1, 2, 3, 4, 5, 6, 7, 8}};
+
+    auto const member_wise = static_cast<std::uint32_t>(
+        hpx::serialization::archive_flags::disable_array_optimization);
+
+    hpx_serialization_test("small_message", small, iterations, 0);
+    hpx_serialization_test("small_message", small, iterations, member_wise);
+    hpx_serialization_test("status_message", status, iterations, 0);
+    hpx_serialization_test("status_message", status, iterations, member_wise);
+
+    return 0;
+}
@@ -0,0 +1,210 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/serialization/base_object.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/shared_ptr.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct A
+{
+    explicit A(int a = 8)
+      : a(a)
+    {
+    }
+    virtual ~A() = default;
+
+    virtual int f() const = 0;
+
+    int a;
+};
+
+template <typename Archive>
+void serialize(Archive& ar, A& a, unsigned)
+{
+    ar& a.a;
+}
+
+HPX_TRAITS_NONINTRUSIVE_POLYMORPHIC(A)
+
+struct B : A
+{
+    explicit B(int b = 6)
+      : b(b)
+    {
+    }
+
+    int f() const override
+    {
+        return b;
+    }
+
+    int b;
+};
+
+template <typename Archive>
+void serialize(Archive& ar, B& b, unsigned)
+{
+    ar& hpx::serialization::base_object<A>(b);
+    ar& b.b;
+}
+
+HPX_SERIALIZATION_REGISTER_CLASS(B)
+
+struct C : A
+{
+    explicit C(int c = 7)
+      : c(c)
+    {
+    }
+
+    int f() const override
+    {
+        return 2 * c;
+    }
+
+    int c;
+};
+
+template <typename Archive>
+void serialize(Archive& ar, C& c, unsigned)
+{
+    ar& hpx::serialization::base_object<A>(c);
+    ar& c.c;
+}
+
+HPX_SERIALIZATION_REGISTER_CLASS(C)
+
+using factory_type =
+    hpx::serialization::detail::polymorphic_nonintrusive_factory;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::shared_ptr<A>> make_objects()
+{
+    std::vector<std::shared_ptr<A>> objects;
+    for (int i = 0; i != 10; ++i)
+    {
+        if (i % 2)
+            objects.push_back(std::make_shared<B>(i));
+        else
+            objects.push_back(std::make_shared<C>(i));
+    }
+    return objects;
+}
+
+std::size_t round_trip(bool use_ids)
+{
+    std::vector<std::shared_ptr<A>> const os = make_objects();
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer);
+        if (use_ids)
+        {
+            oarchive.get_extra_data<
+                hpx::serialization::detail::use_polymorphic_type_ids>();
+        }
+        oarchive << os;
+    }
+
+    std::vector<std::shared_ptr<A>> is;
+    {
+        hpx::serialization::input_archive iarchive(buffer);
+        if (use_ids)
+        {
+            iarchive.get_extra_data<
+                hpx::serialization::detail::use_polymorphic_type_ids>();
+        }
+        iarchive >> is;
+    }
+
+    HPX_TEST_EQ(os.size(), is.size());
+    for (std::size_t i = 0; i != os.size(); ++i)
+    {
+        HPX_TEST_EQ(os[i]->f(), is[i]->f());
+        HPX_TEST_EQ(os[i]->a, is[i]->a);
+    }
+
+    return buffer.size();
+}
+
+void test_type_ids()
+{
+    factory_type& factory = factory_type::instance();
+
+    // no ids are assigned yet, the names are transmitted
+    std::vector<std::string> const unassigned =
+        factory.get_unassigned_typenames();
+    HPX_TEST(std::is_sorted(unassigned.begin(), unassigned.end()));
+    HPX_TEST_EQ(factory.try_get_id("B"), factory_type::invalid_id);
+
+    std::size_t const size_names = round_trip(false);
+    std::size_t const size_names_fallback = round_trip(true);
+    HPX_TEST_LT(size_names, size_names_fallback);
+
+    // assign ids, only those are transmitted afterwards
+    factory.fill_missing_typenames();
+    HPX_TEST(factory.get_unassigned_typenames().empty());
+    HPX_TEST_NEQ(factory.try_get_id("B"), factory_type::invalid_id);
+    HPX_TEST_NEQ(factory.try_get_id("C"), factory_type::invalid_id);
+    HPX_TEST_NEQ(factory.try_get_id("B"), factory.try_get_id("C"));
+
+    std::size_t const size_ids = round_trip(true);
+    HPX_TEST_LT(size_ids, size_names);
+
+    // archives not using ids are not affected
+    HPX_TEST_EQ(round_trip(false), size_names);
+
+    // assigning the same id again is harmless
+    factory.register_typename("B", factory.try_get_id("B"));
+}
+
+void test_unknown_id()
+{
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer);
+        oarchive << factory_type::instance().get_max_registered_id() + 1;
+    }
+
+    hpx::serialization::input_archive iarchive(buffer);
+    iarchive
+        .get_extra_data<hpx::serialization::detail::use_polymorphic_type_ids>();
+
+    bool caught_exception = false;
+    try
+    {
+        B b;
+        A& a = b;
+        iarchive >> a;
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::serialization_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int main()
+{
+    test_type_ids();
+    test_unknown_id();
+
+    return hpx::util::report_errors();
+}
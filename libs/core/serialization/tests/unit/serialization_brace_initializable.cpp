@@ -8,7 +8,10 @@
 
 #include <hpx/modules/serialization.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/serialization/detail/preprocess_container.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -77,6 +80,78 @@ bool operator==(const B& b1, const B& b2)
     return std::tie(b1.a, b1.sign) == std::tie(b2.a, b2.sign);
 }
 
+enum class kind : std::uint8_t
+{
+    request,
+    response
+};
+
+// mixes runs of bitwise serializable members with members requiring their
+// own serialization
+struct C
+{
+    std::uint32_t id;
+    kind k;
+    std::uint16_t flags;
+    double value;
+    std::string name;
+    std::int64_t count;
+    double x;
+    double y;
+    bool valid;
+    std::vector<int> data;
+    char tag;
+};
+
+static_assert(hpx::traits::detail::arity<C>().value == 11,
+    "hpx::traits::detail::arity<C>() == size<11>{}");
+static_assert(hpx::serialization::detail::is_fusable_member_v<kind>,
+    "is_fusable_member_v<kind>");
+static_assert(hpx::serialization::detail::is_fusable_member_v<double const>,
+    "is_fusable_member_v<double const>");
+static_assert(!hpx::serialization::detail::is_fusable_member_v<std::string>,
+    "!is_fusable_member_v<std::string>");
+static_assert(!hpx::serialization::detail::is_fusable_member_v<A>,
+    "!is_fusable_member_v<A>");
+
+bool operator==(const C& c1, const C& c2)
+{
+    return std::tie(c1.id, c1.k, c1.flags, c1.value, c1.name, c1.count, c1.x,
+               c1.y, c1.valid, c1.data, c1.tag) ==
+        std::tie(c2.id, c2.k, c2.flags, c2.value, c2.name, c2.count, c2.x,
+            c2.y, c2.valid, c2.data, c2.tag);
+}
+
+void test_fused_members(std::uint32_t flags)
+{
+    C c{42, kind::response, 0x8001, 3.1415, "fused", -17, 1.5, -2.5, true,
+        {1, 2, 3, 4, 5}, 'z'};
+
+    std::size_t size = 0;
+    {
+        hpx::serialization::detail::preprocess_container p;
+        hpx::serialization::output_archive oar(p, flags);
+        oar << c;
+        size = p.size();
+    }
+
+    std::vector<char> buf;
+    {
+        hpx::serialization::output_archive oar(buf, flags);
+        oar << c;
+        HPX_TEST_EQ(oar.bytes_written(), size);
+    }
+
+    C deserialized_c{};
+    {
+        hpx::serialization::input_archive iar(buf);
+        iar >> deserialized_c;
+        HPX_TEST_EQ(iar.bytes_read(), size);
+    }
+
+    HPX_TEST(c == deserialized_c);
+}
+
 int main()
 {
     std::vector<char> buf;
@@ -102,5 +177,9 @@ int main()
         HPX_TEST(b == deserialized_b);
     }
 
+    test_fused_members(0);
+    test_fused_members(static_cast<std::uint32_t>(
+        hpx::serialization::archive_flags::disable_array_optimization));
+
     return hpx::util::report_errors();
 }
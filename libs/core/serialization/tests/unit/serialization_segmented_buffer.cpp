@@ -0,0 +1,184 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// collects the segments handed to the sink
+struct segment_sink
+{
+    void operator()(char const* data, std::size_t size) const
+    {
+        segments->emplace_back(data, data + size);
+    }
+
+    std::vector<std::vector<char>>* segments;
+};
+
+// hands out the collected segments, possibly split into smaller pieces
+struct segment_source
+{
+    std::size_t operator()(char* data, std::size_t size)
+    {
+        std::size_t const n = (std::min) (size, stream->size() - pos);
+        std::memcpy(data, stream->data() + pos, n);
+        pos += n;
+        return n;
+    }
+
+    std::vector<char> const* stream;
+    std::size_t pos = 0;
+};
+
+std::vector<double> make_data(std::size_t size)
+{
+    std::vector<double> data(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        data[i] = static_cast<double>(i);
+    }
+    return data;
+}
+
+std::vector<char> join(std::vector<std::vector<char>> const& segments)
+{
+    std::vector<char> result;
+    for (auto const& segment : segments)
+    {
+        result.insert(result.end(), segment.begin(), segment.end());
+    }
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_segmented_output(std::size_t segment_size)
+{
+    std::vector<double> const os_data = make_data(100000);
+    std::string const os_str = "a string following the array";
+
+    // serialize into a contiguous buffer for comparison
+    std::vector<char> expected;
+    {
+        hpx::serialization::output_archive oarchive(expected);
+        oarchive << os_data << os_str;
+    }
+
+    std::vector<std::vector<char>> segments;
+    hpx::serialization::segmented_output_buffer buffer(
+        segment_sink{&segments}, segment_size);
+    {
+        hpx::serialization::output_archive oarchive(buffer);
+        oarchive << os_data << os_str;
+        oarchive.flush();
+    }
+
+    // only full segments have been handed to the sink so far
+    for (auto const& segment : segments)
+    {
+        HPX_TEST_EQ(segment.size(), segment_size);
+    }
+
+    buffer.flush();
+    HPX_TEST_EQ(buffer.size(), expected.size());
+    HPX_TEST_EQ(segments.size(),
+        (expected.size() + segment_size - 1) / segment_size);
+    for (auto const& segment : segments)
+    {
+        HPX_TEST(segment.size() <= segment_size);
+    }
+
+    // the concatenated segments are identical to the contiguous archive
+    std::vector<char> const stream = join(segments);
+    HPX_TEST(stream == expected);
+
+    // read the data back from a contiguous buffer
+    {
+        std::vector<double> is_data;
+        std::string is_str;
+
+        hpx::serialization::input_archive iarchive(stream, stream.size());
+        iarchive >> is_data >> is_str;
+
+        HPX_TEST(os_data == is_data);
+        HPX_TEST_EQ(os_str, is_str);
+    }
+}
+
+void test_segmented_input(std::size_t segment_size)
+{
+    std::vector<double> const os_data = make_data(100000);
+    std::string const os_str = "a string following the array";
+
+    std::vector<char> stream;
+    {
+        hpx::serialization::output_archive oarchive(stream);
+        oarchive << os_data << os_str;
+    }
+
+    std::vector<double> is_data;
+    std::string is_str;
+
+    hpx::serialization::segmented_input_buffer buffer(
+        segment_source{&stream}, segment_size);
+    {
+        hpx::serialization::input_archive iarchive(buffer);
+        iarchive >> is_data >> is_str;
+    }
+
+    HPX_TEST_EQ(buffer.size(), stream.size());
+    HPX_TEST(os_data == is_data);
+    HPX_TEST_EQ(os_str, is_str);
+}
+
+void test_segmented_input_too_short()
+{
+    std::vector<char> stream;
+    {
+        hpx::serialization::output_archive oarchive(stream);
+        oarchive << make_data(1000);
+    }
+    stream.resize(stream.size() / 2);
+
+    hpx::serialization::segmented_input_buffer buffer(
+        segment_source{&stream}, 256);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::serialization::input_archive iarchive(buffer);
+
+        std::vector<double> is_data;
+        iarchive >> is_data;
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::serialization_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int main()
+{
+    std::size_t const segment_sizes[] = {1, 7, 4096, 1024 * 1024};
+    for (std::size_t const segment_size : segment_sizes)
+    {
+        test_segmented_output(segment_size);
+        test_segmented_input(segment_size);
+    }
+    test_segmented_input_too_short();
+
+    return hpx::util::report_errors();
+}
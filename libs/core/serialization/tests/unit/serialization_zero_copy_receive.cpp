@@ -0,0 +1,211 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// simple allocator keeping track of the memory it handed out
+struct counting_pool
+{
+    std::size_t allocations = 0;
+    std::size_t deallocations = 0;
+    void* last = nullptr;
+};
+
+void* pool_allocate(std::size_t size, std::size_t alignment, void* data)
+{
+    auto* pool = static_cast<counting_pool*>(data);
+    ++pool->allocations;
+    pool->last = ::operator new(size, std::align_val_t(alignment));
+    return pool->last;
+}
+
+void pool_deallocate(
+    void* p, std::size_t, std::size_t alignment, void* data) noexcept
+{
+    auto* pool = static_cast<counting_pool*>(data);
+    ++pool->deallocations;
+    ::operator delete(p, std::align_val_t(alignment));
+}
+
+hpx::serialization::zero_copy_receive_allocator make_allocator(
+    counting_pool& pool, std::size_t min_size = 0)
+{
+    hpx::serialization::zero_copy_receive_allocator alloc;
+    alloc.allocate = &pool_allocate;
+    alloc.deallocate = &pool_deallocate;
+    alloc.data = &pool;
+    alloc.min_size = min_size;
+    return alloc;
+}
+
+using buffer_type = hpx::serialization::serialize_buffer<double>;
+
+buffer_type make_buffer(std::size_t size)
+{
+    buffer_type buffer(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        buffer[i] = static_cast<double>(i);
+    }
+    return buffer;
+}
+
+bool equal(buffer_type const& lhs, buffer_type const& rhs)
+{
+    return lhs.size() == rhs.size() &&
+        std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(double)) == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the received data is copied into the memory supplied by the allocator
+void test_receive_into_allocator()
+{
+    constexpr std::size_t size = 1024 * 1024;
+    buffer_type const os = make_buffer(size);
+
+    std::vector<char> buffer;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    {
+        hpx::serialization::output_archive oarchive(buffer, 0, &chunks);
+        oarchive << os;
+    }
+
+    counting_pool pool;
+    {
+        hpx::serialization::input_archive iarchive(
+            buffer, buffer.size(), &chunks);
+        iarchive.get_extra_data<
+            hpx::serialization::zero_copy_receive_allocator>() =
+            make_allocator(pool);
+
+        buffer_type is;
+        iarchive >> is;
+
+        HPX_TEST_EQ(pool.allocations, static_cast<std::size_t>(1));
+        HPX_TEST_EQ(static_cast<void*>(is.data()), pool.last);
+        HPX_TEST(equal(os, is));
+    }
+    HPX_TEST_EQ(pool.deallocations, static_cast<std::size_t>(1));
+}
+
+// the networking layer places the data directly into the memory supplied by
+// the allocator
+void test_zero_copy_receive_into_allocator()
+{
+    constexpr std::size_t size = 1024 * 1024;
+    buffer_type const os = make_buffer(size);
+
+    std::vector<char> buffer;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    {
+        hpx::serialization::output_archive oarchive(buffer, 0, &chunks);
+        oarchive << os;
+    }
+
+    // simulate the receiving end: the zero-copy chunks are not available
+    // before the de-serialization has supplied their addresses
+    std::vector<hpx::serialization::serialization_chunk> received_chunks =
+        chunks;
+    std::size_t zero_copy_chunk = chunks.size();
+    for (std::size_t i = 0; i != chunks.size(); ++i)
+    {
+        auto& c = received_chunks[i];
+        if (c.type_ == hpx::serialization::chunk_type::chunk_type_pointer)
+        {
+            HPX_TEST_EQ(zero_copy_chunk, chunks.size());
+            zero_copy_chunk = i;
+            c = hpx::serialization::create_pointer_chunk(nullptr, c.size());
+        }
+    }
+    HPX_TEST_NEQ(zero_copy_chunk, chunks.size());
+
+    counting_pool pool;
+    {
+        hpx::serialization::input_archive iarchive(
+            buffer, buffer.size(), &received_chunks);
+        iarchive.get_extra_data<
+            hpx::serialization::detail::allow_zero_copy_receive>();
+        iarchive.get_extra_data<
+            hpx::serialization::zero_copy_receive_allocator>() =
+            make_allocator(pool);
+
+        buffer_type is;
+        iarchive >> is;
+
+        HPX_TEST_EQ(pool.allocations, static_cast<std::size_t>(1));
+        HPX_TEST_EQ(static_cast<void*>(is.data()), pool.last);
+
+        // the de-serialization has stored the target address in the chunk
+        auto& c = received_chunks[zero_copy_chunk];
+        HPX_TEST_EQ(c.data(), static_cast<void*>(is.data()));
+
+        std::memcpy(c.data(), chunks[zero_copy_chunk].data(), c.size());
+        HPX_TEST(equal(os, is));
+    }
+    HPX_TEST_EQ(pool.deallocations, static_cast<std::size_t>(1));
+}
+
+// small arrays are not allocated using the allocator
+void test_min_size()
+{
+    buffer_type const os = make_buffer(16);
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer);
+        oarchive << os;
+    }
+
+    counting_pool pool;
+    {
+        hpx::serialization::input_archive iarchive(buffer);
+        iarchive.get_extra_data<
+            hpx::serialization::zero_copy_receive_allocator>() =
+            make_allocator(pool, 1024);
+
+        buffer_type is;
+        iarchive >> is;
+
+        HPX_TEST(equal(os, is));
+    }
+    HPX_TEST_EQ(pool.allocations, static_cast<std::size_t>(0));
+    HPX_TEST_EQ(pool.deallocations, static_cast<std::size_t>(0));
+}
+
+void test_registration()
+{
+    HPX_TEST(!hpx::serialization::get_zero_copy_receive_allocator());
+
+    counting_pool pool;
+    hpx::serialization::set_zero_copy_receive_allocator(
+        make_allocator(pool, 4096));
+
+    auto const alloc = hpx::serialization::get_zero_copy_receive_allocator();
+    HPX_TEST(alloc);
+    HPX_TEST_EQ(alloc.data, static_cast<void*>(&pool));
+    HPX_TEST_EQ(alloc.min_size, static_cast<std::size_t>(4096));
+
+    hpx::serialization::set_zero_copy_receive_allocator({});
+    HPX_TEST(!hpx::serialization::get_zero_copy_receive_allocator());
+}
+
+int main()
+{
+    test_receive_into_allocator();
+    test_zero_copy_receive_into_allocator();
+    test_min_size();
+    test_registration();
+
+    return hpx::util::report_errors();
+}
@@ -16,6 +16,7 @@
 #include <hpx/actions/register_action.hpp>
 #include <hpx/actions/transfer_base_action.hpp>
 #include <hpx/actions_base/actions_base_support.hpp>
+#include <hpx/actions_base/detail/direct_execution_statistics.hpp>
 
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/async_base/launch_policy.hpp>
@@ -169,6 +170,21 @@ namespace hpx::actions {
                 target_gid, hpx::id_type::management_type::managed);
         }
 
+        // execute cheap, non-suspending actions directly instead of
+        // scheduling a new thread
+        if (this->select_direct_execution())
+        {
+            {
+                actions::detail::direct_execution_timer timer(
+                    base_type::derived_type::get_direct_execution_statistics());
+                hpx::detail::call_sync<typename base_type::derived_type>(
+                    lva, comptype, HPX_MOVE(hpx::get<Is>(this->arguments_))...);
+            }
+            base_type::derived_type::get_direct_execution_statistics()
+                .increment_direct_invocation_count();
+            return;
+        }
+
         threads::thread_init_data data;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
 #if defined(HPX_HAVE_ITTNOTIFY) && HPX_HAVE_ITTNOTIFY != 0 &&                  \
@@ -231,12 +247,17 @@ namespace hpx::actions {
 
         if (deferred_schedule)
         {
-            // If this is a direct action and deferred schedule was requested,
-            // i.e. if we are not the last parcel, return immediately
+            // If this is a direct action (or an action that will be executed
+            // directly) and deferred schedule was requested, i.e. if we are not
+            // the last parcel, return immediately
             if constexpr (base_type::direct_execution::value)
             {
                 return;
             }
+            else if (this->select_direct_execution())
+            {
+                return;
+            }
 
             // If this is not a direct action, we can safely set
             // deferred_schedule to false
@@ -16,6 +16,7 @@
 #include <hpx/actions/base_action.hpp>
 #include <hpx/actions/register_action.hpp>
 #include <hpx/actions_base/actions_base_support.hpp>
+#include <hpx/actions_base/detail/direct_execution_statistics.hpp>
 #include <hpx/actions_base/detail/invocation_count_registry.hpp>
 #include <hpx/actions_base/traits/action_continuation.hpp>
 #include <hpx/actions_base/traits/action_does_termination_detection.hpp>
@@ -34,6 +35,7 @@
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/serialization.hpp>
 #include <hpx/modules/util.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
 #if defined(HPX_HAVE_ITTNOTIFY) && HPX_HAVE_ITTNOTIFY != 0 &&                  \
     !defined(HPX_HAVE_APEX)
 #include <hpx/modules/itt_notify.hpp>
@@ -227,6 +229,15 @@ namespace hpx::actions {
             return detail::get_action_id<derived_type>();
         }
 
+        /// Return the thread priority this action has to be executed with, a
+        /// dynamically specified default priority results in the priority
+        /// the action has been instantiated with.
+        threads::thread_priority get_thread_priority() const override
+        {
+            return detail::thread_priority<priority_value>::call(
+                this->priority_);
+        }
+
 #if defined(HPX_HAVE_ITTNOTIFY) && HPX_HAVE_ITTNOTIFY != 0 &&                  \
     !defined(HPX_HAVE_APEX)
         /// The function \a get_action_name_itt returns the name of this action
@@ -295,6 +306,22 @@ namespace hpx::actions {
             return util::get_and_reset_value(invocation_count_, reset);
         }
 
+        /// Extract the current count of remote invocations of this action
+        /// that were executed directly
+        static std::int64_t get_direct_invocation_count(bool reset)
+        {
+            if constexpr (detail::is_direct_execution_candidate_v<
+                              derived_type>)
+            {
+                return derived_type::get_direct_execution_statistics()
+                    .get_direct_invocation_count(reset);
+            }
+            else
+            {
+                return 0;
+            }
+        }
+
         // serialization support
         // loading ...
         void load_base(hpx::serialization::input_archive& ar)
@@ -311,6 +338,29 @@ namespace hpx::actions {
         }
 
     protected:
+        // Decide whether this invocation should be executed directly on the
+        // thread that has received the parcel. This is the case for actions
+        // that were measured to run quickly without ever suspending, provided
+        // that the current (HPX) thread has sufficient stack space left.
+        bool select_direct_execution() const
+        {
+            if constexpr (detail::is_direct_execution_candidate_v<
+                              derived_type>)
+            {
+                return this->priority_ == threads::thread_priority::default_ &&
+                    (this->stacksize_ == threads::thread_stacksize::default_ ||
+                        this->stacksize_ ==
+                            threads::thread_stacksize::small_) &&
+                    derived_type::get_direct_execution_statistics()
+                        .execute_directly() &&
+                    this_thread::has_sufficient_stack_space();
+            }
+            else
+            {
+                return false;
+            }
+        }
+
         arguments_type arguments_;
 
     private:
@@ -337,6 +387,15 @@ namespace hpx::actions {
                 hpx::actions::detail::get_action_name<Action>(),
                 &transfer_base_action<Action>::get_invocation_count);
         }
+
+        template <typename Action>
+        void register_direct_action_invocation_count(
+            invocation_count_registry& registry)
+        {
+            registry.register_class(
+                hpx::actions::detail::get_action_name<Action>(),
+                &transfer_base_action<Action>::get_direct_invocation_count);
+        }
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
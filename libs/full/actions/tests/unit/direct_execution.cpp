@@ -0,0 +1,217 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the heuristics executing cheap remote actions directly on the thread
+// that has received the parcel (see hpx.parcel.direct_execution_threshold).
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using hpx::actions::detail::direct_execution_statistics;
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_threshold()
+{
+    return hpx::util::from_string<std::int64_t>(hpx::get_config_entry(
+        "hpx.parcel.direct_execution_threshold",
+        HPX_PARCEL_DIRECT_EXECUTION_THRESHOLD));
+}
+
+// Threads created for an action are described by the name of the action,
+// an action executed directly runs on a thread described differently.
+std::atomic<std::int64_t> num_direct_invocations(0);
+
+void count_direct_invocation([[maybe_unused]] char const* action_name)
+{
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    hpx::threads::thread_description const desc =
+        hpx::threads::get_thread_description(hpx::threads::get_self_id());
+    if (desc.kind() !=
+            hpx::threads::thread_description::data_type_description ||
+        std::strcmp(desc.get_description(), action_name) != 0)
+    {
+        ++num_direct_invocations;
+    }
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void cheap()
+{
+    count_direct_invocation("cheap_action");
+}
+HPX_PLAIN_ACTION(cheap, cheap_action)
+
+// suspends and runs longer than the threshold
+void suspending()
+{
+    hpx::this_thread::sleep_for(
+        std::chrono::nanoseconds(2 * get_threshold() + 1000));
+}
+HPX_PLAIN_ACTION(suspending, suspending_action)
+
+void opted_out() {}
+HPX_DECLARE_ACTION(opted_out, opted_out_action)
+
+namespace hpx::traits {
+
+    template <>
+    struct action_allow_direct_execution<opted_out_action>
+    {
+        static constexpr bool value = false;
+    };
+}    // namespace hpx::traits
+
+HPX_PLAIN_ACTION(opted_out, opted_out_action)
+
+///////////////////////////////////////////////////////////////////////////////
+// query the statistics on the locality executing the actions
+bool executes_directly(std::string const& action)
+{
+    if (action == "cheap_action")
+    {
+        return cheap_action::get_direct_execution_statistics()
+            .execute_directly();
+    }
+    if (action == "suspending_action")
+    {
+        return suspending_action::get_direct_execution_statistics()
+            .execute_directly();
+    }
+    return opted_out_action::get_direct_execution_statistics()
+        .execute_directly();
+}
+HPX_PLAIN_ACTION(executes_directly, executes_directly_action)
+
+std::int64_t get_num_direct_invocations()
+{
+    return num_direct_invocations.load();
+}
+HPX_PLAIN_ACTION(get_num_direct_invocations, get_num_direct_invocations_action)
+
+std::int64_t get_direct_invocation_count(
+    hpx::id_type const& id, std::string const& action)
+{
+    hpx::performance_counters::performance_counter c("/runtime{locality#" +
+        std::to_string(hpx::naming::get_locality_id_from_id(id)) +
+        "/total}/count/direct-action-invocation@" + action);
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Once min_samples invocations were measured to be cheap, the action is
+// executed directly. The direct invocations are counted.
+void test_cheap_action(hpx::id_type const& id, bool enabled)
+{
+    constexpr std::int64_t min_samples =
+        direct_execution_statistics::min_samples;
+
+    for (std::int64_t i = 0; i != min_samples; ++i)
+    {
+        HPX_TEST(!executes_directly_action()(id, "cheap_action"));
+        cheap_action()(id);
+    }
+    HPX_TEST_EQ(executes_directly_action()(id, "cheap_action"), enabled);
+
+    std::int64_t const count = get_direct_invocation_count(id, "cheap_action");
+    [[maybe_unused]] std::int64_t const num_direct =
+        get_num_direct_invocations_action()(id);
+
+    std::int64_t const num_invocations = 1000;
+    std::vector<hpx::future<void>> results;
+    results.reserve(num_invocations);
+    for (std::int64_t i = 0; i != num_invocations; ++i)
+    {
+        results.push_back(hpx::async(cheap_action(), id));
+    }
+    hpx::wait_all(results);
+
+    std::int64_t const direct =
+        get_direct_invocation_count(id, "cheap_action") - count;
+    HPX_TEST_LTE(direct, num_invocations);
+    if (!enabled)
+    {
+        HPX_TEST_EQ(direct, std::int64_t(0));
+    }
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    HPX_TEST_EQ(
+        direct, get_num_direct_invocations_action()(id) - num_direct);
+#endif
+}
+
+// actions which suspend are never executed directly
+void test_suspending_action(hpx::id_type const& id)
+{
+    constexpr std::int64_t min_samples =
+        direct_execution_statistics::min_samples;
+
+    for (std::int64_t i = 0; i != 2 * min_samples; ++i)
+    {
+        suspending_action()(id);
+    }
+
+    HPX_TEST(!executes_directly_action()(id, "suspending_action"));
+    HPX_TEST_EQ(get_direct_invocation_count(id, "suspending_action"),
+        std::int64_t(0));
+}
+
+// actions which have opted out are never executed directly
+void test_opted_out_action(hpx::id_type const& id)
+{
+    static_assert(!hpx::actions::detail::is_direct_execution_candidate_v<
+        opted_out_action>);
+
+    constexpr std::int64_t min_samples =
+        direct_execution_statistics::min_samples;
+
+    for (std::int64_t i = 0; i != 2 * min_samples; ++i)
+    {
+        opted_out_action()(id);
+    }
+
+    HPX_TEST(!executes_directly_action()(id, "opted_out_action"));
+    HPX_TEST_EQ(get_direct_invocation_count(id, "opted_out_action"),
+        std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    bool const enabled = get_threshold() != 0;
+
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_cheap_action(id, enabled);
+        test_suspending_action(id);
+        test_opted_out_action(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -17,6 +17,7 @@
 #include <hpx/actions_base/actions_base_support.hpp>
 #include <hpx/actions_base/basic_action_fwd.hpp>
 #include <hpx/actions_base/detail/action_factory.hpp>
+#include <hpx/actions_base/detail/direct_execution_statistics.hpp>
 #include <hpx/actions_base/detail/invocation_count_registry.hpp>
 #include <hpx/actions_base/detail/per_action_data_counter_registry.hpp>
 #include <hpx/actions_base/preassigned_action_id.hpp>
@@ -78,7 +79,21 @@ namespace hpx::actions {
             HPX_FORCEINLINE typename Action::internal_result_type operator()(
                 Ts&&... vs) const
             {
-                return Action::invoke(lva, comptype, HPX_FORWARD(Ts, vs)...);
+                if constexpr (is_direct_execution_candidate_v<Action>)
+                {
+                    // measure the execution time of actions that may be
+                    // executed directly later on (the statistics decide
+                    // which invocations are measured)
+                    direct_execution_timer timer(
+                        Action::get_direct_execution_statistics());
+                    return Action::invoke(
+                        lva, comptype, HPX_FORWARD(Ts, vs)...);
+                }
+                else
+                {
+                    return Action::invoke(
+                        lva, comptype, HPX_FORWARD(Ts, vs)...);
+                }
             }
         };
 
@@ -430,8 +445,17 @@ namespace hpx::actions {
             return util::get_and_reset_value(invocation_count_, reset);
         }
 
+        /// Access the execution time statistics used to decide whether
+        /// remote invocations of this action are executed directly
+        static detail::direct_execution_statistics&
+        get_direct_execution_statistics() noexcept
+        {
+            return direct_execution_statistics_;
+        }
+
     private:
         static std::atomic<std::int64_t> invocation_count_;
+        static detail::direct_execution_statistics direct_execution_statistics_;
 
     protected:
         static void increment_invocation_count()
@@ -445,6 +469,11 @@ namespace hpx::actions {
     std::atomic<std::int64_t>
         basic_action<Component, R(Args...), Derived>::invocation_count_(0);
 
+    template <typename Component, typename R, typename... Args,
+        typename Derived>
+    detail::direct_execution_statistics basic_action<Component, R(Args...),
+        Derived>::direct_execution_statistics_;
+
     namespace detail {
 
         template <typename Action>
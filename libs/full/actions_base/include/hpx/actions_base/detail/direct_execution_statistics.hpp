@@ -0,0 +1,214 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/traits/action_allow_direct_execution.hpp>
+#include <hpx/actions_base/traits/action_priority.hpp>
+#include <hpx/actions_base/traits/action_stacksize.hpp>
+#include <hpx/components_base/traits/action_decorate_function.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/naming_base/address.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::actions::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Components may take over the scheduling of the threads executing their
+    // actions, see traits::action_schedule_thread.
+    template <typename Action, typename Enable = void>
+    struct has_component_schedule_thread : std::false_type
+    {
+    };
+
+    template <typename Action>
+    struct has_component_schedule_thread<Action,
+        std::void_t<decltype(Action::component_type::schedule_thread(
+            std::declval<naming::address_type>(),
+            std::declval<naming::component_type>(),
+            std::declval<threads::thread_init_data&>()))>> : std::true_type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Remote invocations of an action are considered for being executed
+    // directly on the thread that has received the parcel only if the action
+    // is not a direct action already, if it was not opted out, and if it does
+    // not require a special priority, a larger stack, or decoration or custom
+    // scheduling by its component.
+    template <typename Action>
+    inline constexpr bool is_direct_execution_candidate_v =
+        !Action::direct_execution::value &&
+        traits::action_allow_direct_execution_v<Action> &&
+        !traits::has_decorates_action_v<Action> &&
+        !has_component_schedule_thread<Action>::value &&
+        traits::action_priority_v<Action> ==
+            threads::thread_priority::default_ &&
+        (traits::action_stacksize_v<Action> ==
+                threads::thread_stacksize::default_ ||
+            traits::action_stacksize_v<Action> ==
+                threads::thread_stacksize::small_);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Keeps track of the execution times of the invocations of an action and
+    // decides whether remote invocations of this action should be executed
+    // directly on the thread that has received the parcel instead of on a new
+    // HPX thread. An action is executed directly once the moving average of
+    // its execution times is below the configured threshold and none of its
+    // invocations was ever observed to suspend.
+    //
+    // All invocations are measured until min_samples have been collected.
+    // Afterwards only one out of sampling_interval invocations executed by a
+    // worker thread is measured to keep the decision up to date, the other
+    // invocations only read the decision.
+    class HPX_EXPORT direct_execution_statistics
+    {
+    public:
+        // number of measured invocations required before an action may be
+        // executed directly
+        static constexpr std::int64_t min_samples = 16;
+
+        // once min_samples have been collected, one out of this many
+        // invocations is measured
+        static constexpr std::uint32_t sampling_interval = 256;
+
+        direct_execution_statistics() = default;
+
+        // Return whether the execution time of the current invocation should
+        // be measured.
+        [[nodiscard]] bool measure() const noexcept
+        {
+            if (!enabled())
+            {
+                return false;
+            }
+
+            switch (state_.load(std::memory_order_relaxed))
+            {
+            case state::measuring:
+                return true;
+
+            case state::measured:
+                return sample();
+
+            default:
+                return false;
+            }
+        }
+
+        // Record the execution time (in nanoseconds) of an invocation and
+        // whether the invocation has suspended.
+        void record(std::int64_t time, bool suspended) noexcept;
+
+        // Return whether the next invocation should be executed directly.
+        [[nodiscard]] bool execute_directly() const noexcept
+        {
+            std::int64_t const threshold =
+                threshold_.load(std::memory_order_relaxed);
+
+            return threshold != 0 &&
+                state_.load(std::memory_order_relaxed) == state::measured &&
+                average_time_.load(std::memory_order_relaxed) <= threshold;
+        }
+
+        void increment_direct_invocation_count() noexcept
+        {
+            direct_invocations_.data_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] std::int64_t get_direct_invocation_count(
+            bool reset) noexcept;
+
+        // The threshold (in nanoseconds) for the average execution time of
+        // an action to be executed directly, zero disables the heuristics.
+        static void set_threshold(std::int64_t threshold) noexcept;
+
+        [[nodiscard]] static bool enabled() noexcept
+        {
+            return threshold_.load(std::memory_order_relaxed) != 0;
+        }
+
+    private:
+        enum class state : std::uint8_t
+        {
+            measuring,    // collecting the first samples
+            measured,     // enough samples have been collected
+            suspended     // an invocation has suspended, stop measuring
+        };
+
+        // Return true for one out of sampling_interval calls on the current
+        // worker thread.
+        [[nodiscard]] static bool sample() noexcept;
+
+        static std::atomic<std::int64_t> threshold_;
+
+        // written while measuring and for sampled invocations only
+        std::atomic<state> state_ = state::measuring;
+        std::atomic<std::int64_t> samples_ = 0;
+        std::atomic<std::int64_t> average_time_ = 0;
+
+        // written for every direct invocation, keep it apart from the data
+        // read by every invocation
+        util::cache_aligned_data<std::atomic<std::int64_t>>
+            direct_invocations_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Measures the execution time of an invocation and whether the executing
+    // HPX thread has suspended in between, if the statistics request the
+    // invocation to be measured.
+    class HPX_EXPORT direct_execution_timer
+    {
+    public:
+        explicit direct_execution_timer(
+            direct_execution_statistics& statistics) noexcept
+          : statistics_(statistics)
+          , start_(0)
+          , phase_(0)
+          , measure_(statistics.measure())
+        {
+            if (measure_)
+            {
+                start();
+            }
+        }
+
+        direct_execution_timer(direct_execution_timer const&) = delete;
+        direct_execution_timer(direct_execution_timer&&) = delete;
+        direct_execution_timer& operator=(
+            direct_execution_timer const&) = delete;
+        direct_execution_timer& operator=(direct_execution_timer&&) = delete;
+
+        ~direct_execution_timer()
+        {
+            if (measure_)
+            {
+                stop();
+            }
+        }
+
+    private:
+        void start() noexcept;
+        void stop() noexcept;
+
+        direct_execution_statistics& statistics_;
+        std::uint64_t start_;
+        std::size_t phase_;
+        bool measure_;
+    };
+}    // namespace hpx::actions::detail
+
+#include <hpx/config/warnings_suffix.hpp>
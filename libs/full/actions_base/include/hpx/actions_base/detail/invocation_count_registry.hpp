@@ -39,6 +39,7 @@ namespace hpx::actions::detail {
         static invocation_count_registry& local_instance();
 #if defined(HPX_HAVE_NETWORKING)
         static invocation_count_registry& remote_instance();
+        static invocation_count_registry& direct_instance();
 #endif
 
         void register_class(
@@ -59,6 +60,9 @@ namespace hpx::actions::detail {
 #if defined(HPX_HAVE_NETWORKING)
         struct remote_tag;
         friend struct hpx::util::static_<invocation_count_registry, remote_tag>;
+
+        struct direct_tag;
+        friend struct hpx::util::static_<invocation_count_registry, direct_tag>;
 #endif
         map_type map_;
     };
@@ -71,6 +75,10 @@ namespace hpx::actions::detail {
     template <typename Action>
     void register_remote_action_invocation_count(
         invocation_count_registry& registry);
+
+    template <typename Action>
+    void register_direct_action_invocation_count(
+        invocation_count_registry& registry);
 #endif
 
     template <typename Action>
@@ -84,6 +92,8 @@ namespace hpx::actions::detail {
 #if defined(HPX_HAVE_NETWORKING)
             register_remote_action_invocation_count<Action>(
                 invocation_count_registry::remote_instance());
+            register_direct_action_invocation_count<Action>(
+                invocation_count_registry::direct_instance());
 #endif
         }
 
@@ -0,0 +1,24 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+namespace hpx::traits {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Customization point allowing to opt out of the runtime heuristics that
+    // execute remote invocations of cheap, non-blocking actions directly on
+    // the thread which has received the parcel.
+    template <typename Action, typename Enable = void>
+    struct action_allow_direct_execution
+    {
+        static constexpr bool value = true;
+    };
+
+    template <typename Action>
+    inline constexpr bool action_allow_direct_execution_v =
+        action_allow_direct_execution<Action>::value;
+}    // namespace hpx::traits
@@ -0,0 +1,109 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/detail/direct_execution_statistics.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::actions::detail {
+
+    std::atomic<std::int64_t> direct_execution_statistics::threshold_(
+        HPX_PARCEL_DIRECT_EXECUTION_THRESHOLD);
+
+    void direct_execution_statistics::record(
+        std::int64_t time, bool suspended) noexcept
+    {
+        if (suspended)
+        {
+            // actions that may suspend are never executed directly
+            state_.store(state::suspended, std::memory_order_relaxed);
+            return;
+        }
+
+        // exponential moving average, the first sample initializes it
+        std::int64_t average = average_time_.load(std::memory_order_relaxed);
+        if (state_.load(std::memory_order_relaxed) != state::measuring)
+        {
+            // sampled invocation, update the average only
+            average_time_.store(
+                average + (time - average) / 8, std::memory_order_relaxed);
+            return;
+        }
+
+        std::int64_t const samples =
+            samples_.fetch_add(1, std::memory_order_relaxed);
+        average = samples == 0 ? time : average + (time - average) / 8;
+        average_time_.store(average, std::memory_order_relaxed);
+
+        if (samples + 1 == min_samples)
+        {
+            // stop measuring every invocation, unless it has suspended in
+            // the meantime
+            state expected = state::measuring;
+            state_.compare_exchange_strong(
+                expected, state::measured, std::memory_order_relaxed);
+        }
+    }
+
+    bool direct_execution_statistics::sample() noexcept
+    {
+        // shared by all actions executed on the current worker thread
+        thread_local std::uint32_t countdown = sampling_interval;
+        if (--countdown != 0)
+        {
+            return false;
+        }
+
+        countdown = sampling_interval;
+        return true;
+    }
+
+    std::int64_t direct_execution_statistics::get_direct_invocation_count(
+        bool reset) noexcept
+    {
+        return util::get_and_reset_value(direct_invocations_.data_, reset);
+    }
+
+    void direct_execution_statistics::set_threshold(
+        std::int64_t threshold) noexcept
+    {
+        threshold_.store(
+            threshold < 0 ? 0 : threshold, std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        // Without HPX_HAVE_THREAD_PHASE_INFORMATION the phase is always zero,
+        // suspending actions are then recognized by their execution time only.
+        std::size_t get_current_thread_phase() noexcept
+        {
+            threads::thread_data const* self = threads::get_self_id_data();
+            return self != nullptr ? self->get_thread_phase() : 0;
+        }
+    }    // namespace
+
+    void direct_execution_timer::start() noexcept
+    {
+        start_ = hpx::chrono::high_resolution_clock::now();
+        phase_ = get_current_thread_phase();
+    }
+
+    void direct_execution_timer::stop() noexcept
+    {
+        statistics_.record(static_cast<std::int64_t>(
+                               hpx::chrono::high_resolution_clock::now() -
+                               start_),
+            get_current_thread_phase() != phase_);
+    }
+}    // namespace hpx::actions::detail
@@ -27,6 +27,12 @@ namespace hpx::actions::detail {
         hpx::util::static_<invocation_count_registry, remote_tag> registry;
         return registry.get();
     }
+
+    invocation_count_registry& invocation_count_registry::direct_instance()
+    {
+        hpx::util::static_<invocation_count_registry, direct_tag> registry;
+        return registry.get();
+    }
 #endif
 
     void invocation_count_registry::register_class(
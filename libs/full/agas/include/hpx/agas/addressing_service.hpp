@@ -11,7 +11,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/agas/agas_fwd.hpp>
-#include <hpx/cache/lru_cache.hpp>
+#include <hpx/cache/concurrent_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
 #include <hpx/datastructures/detail/dynamic_bitset.hpp>
@@ -23,6 +23,7 @@
 #include <hpx/naming_base/address.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/parcelset/parcelset_fwd.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
 #include <hpx/synchronization/shared_mutex.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
@@ -64,14 +65,17 @@ namespace hpx { namespace agas {
 
         // gva cache
         struct gva_cache_key;
+        struct gva_cache_shards;
 
-        using gva_cache_type = hpx::util::cache::lru_cache<gva_cache_key, gva,
-            hpx::util::cache::statistics::local_full_statistics>;
+        using gva_cache_type =
+            hpx::util::cache::concurrent_cache<gva_cache_key, gva,
+                hpx::spinlock,
+                hpx::util::cache::statistics::local_full_statistics,
+                gva_cache_shards>;
 
         using migrated_objects_table_type = std::set<naming::gid_type>;
         using refcnt_requests_type = std::map<naming::gid_type, std::int64_t>;
 
-        mutable hpx::shared_mutex gva_cache_mtx_;
         std::shared_ptr<gva_cache_type> gva_cache_;
 
         mutable mutex_type migrated_objects_mtx_;
@@ -81,13 +85,35 @@ namespace hpx { namespace agas {
         std::uint32_t console_cache_;
 
         std::size_t const max_refcnt_requests_;
+        std::int64_t const refcnt_flush_interval_;    // [us]
 
         mutex_type refcnt_requests_mtx_;
-        std::size_t refcnt_requests_count_;
         bool enable_refcnt_caching_;
 
         std::shared_ptr<refcnt_requests_type> refcnt_requests_;
 
+        // The buffered decrement requests are sent to each destination
+        // locality separately, either once a destination has accumulated
+        // max_refcnt_requests_ requests or once its oldest request is older
+        // than refcnt_flush_interval_.
+        struct refcnt_destination
+        {
+            std::size_t count_ = 0;
+            std::uint64_t first_request_ = 0;    // [ns]
+        };
+        using refcnt_destinations_type =
+            std::map<std::uint32_t, refcnt_destination>;
+
+        refcnt_destinations_type refcnt_destinations_;
+        util::interval_timer refcnt_flush_timer_;
+        std::atomic<bool> refcnt_flush_timer_started_;
+
+        // statistics for the credit updates: the number of messages sent to
+        // AGAS and the number of messages avoided by merging requests for the
+        // same gid and by batching requests for the same destination
+        std::atomic<std::int64_t> refcnt_messages_sent_;
+        std::atomic<std::int64_t> refcnt_messages_saved_;
+
         service_mode const service_type;
         runtime_mode const runtime_type;
 
@@ -232,13 +258,21 @@ namespace hpx { namespace agas {
 
     private:
         /// Assumes that \a refcnt_requests_mtx_ is locked.
-        void send_refcnt_requests(
-            std::unique_lock<mutex_type>& l, error_code& ec = throws);
+        void send_refcnt_requests(std::unique_lock<mutex_type>& l,
+            naming::gid_type const& raw, error_code& ec = throws);
 
         /// Assumes that \a refcnt_requests_mtx_ is locked.
         void send_refcnt_requests_non_blocking(
             std::unique_lock<mutex_type>& l, error_code& ec);
 
+        /// Send the buffered requests for the given destination localities
+        /// only. Assumes that \a refcnt_requests_mtx_ is locked.
+        void send_refcnt_requests_non_blocking(std::unique_lock<mutex_type>& l,
+            std::vector<std::uint32_t> const& destinations, error_code& ec);
+
+        // invoked periodically by refcnt_flush_timer_
+        bool flush_expired_refcnt_requests();
+
         /// Assumes that \a refcnt_requests_mtx_ is locked.
         std::vector<hpx::future<std::vector<std::int64_t>>>
         send_refcnt_requests_async(std::unique_lock<mutex_type>& l);
@@ -265,6 +299,10 @@ namespace hpx { namespace agas {
         std::uint64_t get_cache_update_entry_time(bool reset) const;
         std::uint64_t get_cache_erase_entry_time(bool reset) const;
 
+        // Helper functions to access the statistics of the credit updates
+        std::int64_t get_refcnt_messages_sent(bool reset);
+        std::int64_t get_refcnt_messages_saved(bool reset);
+
     public:
         /// \brief Add a locality to the runtime.
         bool register_locality(parcelset::endpoints_type const& endpoints,
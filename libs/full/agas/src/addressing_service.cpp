@@ -34,7 +34,9 @@
 #include <hpx/serialization/vector.hpp>
 #include <hpx/synchronization/shared_mutex.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/type_support/assert_owns_lock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/util/insert_checked.hpp>
 
@@ -115,14 +117,65 @@ namespace hpx::agas {
         }
     };
 
+    // The ids are assigned to the shards of the cache in blocks of consecutive
+    // ids. Entries for ranges of ids are stored in the shards of all blocks
+    // they cover.
+    struct addressing_service::gva_cache_shards
+    {
+        static constexpr int block_bits = 8;
+
+        [[nodiscard]] static std::uint64_t shard_of(std::uint64_t msb,
+            std::uint64_t block, std::size_t num_shards) noexcept
+        {
+            std::uint64_t hash = block ^ (msb * 0x9e3779b97f4a7c15ULL);
+            hash ^= hash >> 29;
+            return static_cast<std::uint64_t>(1) << (hash % num_shards);
+        }
+
+        [[nodiscard]] std::uint64_t operator()(
+            gva_cache_key const& key, std::size_t num_shards) const
+        {
+            naming::gid_type const gid = key.get_gid();
+            std::uint64_t const first = gid.get_lsb();
+            std::uint64_t const last = first + key.get_count();
+
+            std::uint64_t const first_block = first >> block_bits;
+            std::uint64_t const last_block = last >> block_bits;
+
+            // Ranges wrapping around or covering more blocks than there are
+            // shards are stored in all shards.
+            if (last < first || last_block - first_block >= num_shards)
+            {
+                return num_shards == 64 ?
+                    ~static_cast<std::uint64_t>(0) :
+                    (static_cast<std::uint64_t>(1) << num_shards) - 1;
+            }
+
+            std::uint64_t result = 0;
+            for (std::uint64_t b = first_block; b <= last_block; ++b)
+            {
+                result |= shard_of(gid.get_msb(), b, num_shards);
+            }
+            return result;
+        }
+    };
+
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_)
       : gva_cache_(new gva_cache_type)
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
-      , refcnt_requests_count_(0)
+      , refcnt_flush_interval_(ini_.get_agas_refcnt_flush_interval())
       , enable_refcnt_caching_(true)
       , refcnt_requests_(new refcnt_requests_type)
+      , refcnt_flush_timer_(
+            hpx::bind_front(
+                &addressing_service::flush_expired_refcnt_requests, this),
+            refcnt_flush_interval_,
+            "addressing_service::flush_expired_refcnt_requests", true)
+      , refcnt_flush_timer_started_(false)
+      , refcnt_messages_sent_(0)
+      , refcnt_messages_saved_(0)
       , service_type(ini_.get_agas_service_mode())
       , runtime_type(ini_.mode_)
       , caching_(ini_.get_agas_caching_mode())
@@ -1414,16 +1467,23 @@ namespace hpx::agas {
                     has_pending_incref = true;
 
                     refcnt_requests_->erase(matches);
+
+                    // the pending decref will not be sent
+                    ++refcnt_messages_saved_;
                 }
                 else if (matches->second == 0)
                 {
                     // credit == decref (case no. 3): if the incref offsets any
                     // pending decref, just remove the pending decref request.
                     refcnt_requests_->erase(matches);
+
+                    // neither the incref nor the pending decref will be sent
+                    refcnt_messages_saved_ += 2;
                 }
                 else
                 {
                     // credit < decref (case no. 2): do nothing
+                    ++refcnt_messages_saved_;
                 }
             }
             else
@@ -1440,6 +1500,8 @@ namespace hpx::agas {
             return pending_decrefs;
         }
 
+        ++refcnt_messages_sent_;
+
         naming::gid_type const e_lower = pending_incref.first;
         auto result = primary_ns_.increment_credit(
             pending_incref.second, e_lower, e_lower);
@@ -1497,6 +1559,9 @@ namespace hpx::agas {
                 matches != refcnt_requests_->end())
             {
                 matches->second -= credit;
+
+                // merged with a pending request for the same gid
+                ++refcnt_messages_saved_;
             }
             else
             {
@@ -1518,11 +1583,21 @@ namespace hpx::agas {
                 }
             }
 
-            send_refcnt_requests(l, ec);
+            send_refcnt_requests(l, raw, ec);
         }
         catch (hpx::exception const& e)
         {
             HPX_RETHROWS_IF(ec, e, "addressing_service::decref");
+            return;
+        }
+
+        // make sure buffered requests are eventually sent even if no further
+        // requests are made
+        if (refcnt_flush_interval_ > 0 &&
+            !refcnt_flush_timer_started_.load(std::memory_order_relaxed) &&
+            !refcnt_flush_timer_started_.exchange(true))
+        {
+            refcnt_flush_timer_.start(false);
         }
     }
 
@@ -1749,34 +1824,22 @@ namespace hpx::agas {
 
             gva_cache_key const key(gid, count);
 
+            if (!gva_cache_->update_if(key, g, check_for_collisions) &&
+                LAGAS_ENABLED(warning))
             {
-                std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-                if (!gva_cache_->update_if(key, g, check_for_collisions))
-                {
-                    if (LAGAS_ENABLED(warning))
-                    {
-                        // Figure out who we collided with.
-                        addressing_service::gva_cache_key idbase;
-                        addressing_service::gva_cache_type::entry_type e;
+                // Figure out who we collided with. The entry may have been
+                // evicted concurrently, in which case nothing is reported.
+                addressing_service::gva_cache_key idbase;
+                addressing_service::gva_cache_type::entry_type e;
 
-                        if (!gva_cache_->get_entry(key, idbase, e))
-                        {
-                            // This is impossible under sane conditions.
-                            lock.unlock();
-                            HPX_THROWS_IF(ec, hpx::error::invalid_data,
-                                "addressing_service::update_cache_entry",
-                                "data corruption or lock error occurred in "
-                                "cache");
-                            return;
-                        }
-
-                        LAGAS_(warning).format(
-                            "addressing_service::update_cache_entry, aborting "
-                            "update due to key collision in cache, "
-                            "new_gid({1}), new_count({2}), old_gid({3}), "
-                            "old_count({4})",
-                            gid, count, idbase.get_gid(), idbase.get_count());
-                    }
+                if (gva_cache_->get_entry(key, idbase, e))
+                {
+                    LAGAS_(warning).format(
+                        "addressing_service::update_cache_entry, aborting "
+                        "update due to key collision in cache, "
+                        "new_gid({1}), new_count({2}), old_gid({3}), "
+                        "old_count({4})",
+                        gid, count, idbase.get_gid(), idbase.get_count());
                 }
             }
 
@@ -1803,7 +1866,6 @@ namespace hpx::agas {
 
         gva_cache_key const k(gid);
 
-        std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         if (gva_cache_key idbase_key; gva_cache_->get_entry(k, idbase_key, gva))
         {
             std::uint64_t const id_msb =
@@ -1811,7 +1873,6 @@ namespace hpx::agas {
 
             if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
             {
-                lock.unlock();
                 HPX_THROWS_IF(ec, hpx::error::internal_server_error,
                     "addressing_service::get_cache_entry",
                     "bad entry in cache, MSBs of GID base and GID do not "
@@ -1836,18 +1897,11 @@ namespace hpx::agas {
             return;
         }
 
-        // 26115: Failing to release lock 'this->gva_cache_mtx_'
-#if defined(HPX_MSVC)
-#pragma warning(push)
-#pragma warning(disable : 26115)
-#endif
         try
         {
             LAGAS_(warning).format(
                 "addressing_service::clear_cache, clearing cache");
 
-            std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-
             gva_cache_->clear();
 
             if (&ec != &throws)
@@ -1858,9 +1912,6 @@ namespace hpx::agas {
             HPX_RETHROWS_IF(ec, e, "addressing_service::clear_cache");
         }
     }
-#if defined(HPX_MSVC)
-#pragma warning(pop)
-#endif
 
     void addressing_service::remove_cache_entry(
         naming::gid_type const& id, error_code& ec) const
@@ -1895,8 +1946,6 @@ namespace hpx::agas {
         {
             LAGAS_(warning).format("addressing_service::remove_cache_entry");
 
-            std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-
             gva_cache_->erase([&gid](std::pair<gva_cache_key, gva> const& p) {
                 return gid == p.first.get_gid();
             });
@@ -1926,31 +1975,26 @@ namespace hpx::agas {
     // Helper functions to access the current cache statistics
     std::uint64_t addressing_service::get_cache_entries(bool /* reset */) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->size();
     }
 
     std::uint64_t addressing_service::get_cache_hits(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().hits(reset);
     }
 
     std::uint64_t addressing_service::get_cache_misses(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().misses(reset);
     }
 
     std::uint64_t addressing_service::get_cache_evictions(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().evictions(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertions(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().insertions(reset);
     }
 
@@ -1958,58 +2002,62 @@ namespace hpx::agas {
     std::uint64_t addressing_service::get_cache_get_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().get_get_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().get_insert_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().get_update_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().get_erase_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_get_entry_time(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().get_get_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_time(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().get_insert_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_time(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().get_update_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_time(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().get_erase_entry_time(reset);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Helper functions to access the statistics of the credit updates
+    std::int64_t addressing_service::get_refcnt_messages_sent(bool reset)
+    {
+        return util::get_and_reset_value(refcnt_messages_sent_, reset);
+    }
+
+    std::int64_t addressing_service::get_refcnt_messages_saved(bool reset)
+    {
+        return util::get_and_reset_value(refcnt_messages_saved_, reset);
+    }
+
     void addressing_service::register_server_instances()
     {
         // register root server
@@ -2040,7 +2088,8 @@ namespace hpx::agas {
     }
 
     void addressing_service::send_refcnt_requests(
-        std::unique_lock<addressing_service::mutex_type>& l, error_code& ec)
+        std::unique_lock<addressing_service::mutex_type>& l,
+        naming::gid_type const& raw, error_code& ec)
     {
         if (!l.owns_lock())
         {
@@ -2050,12 +2099,63 @@ namespace hpx::agas {
             return;
         }
 
-        if (!enable_refcnt_caching_ ||
-            max_refcnt_requests_ == ++refcnt_requests_count_)
+        if (!enable_refcnt_caching_)
+        {
             send_refcnt_requests_non_blocking(l, ec);
+            return;
+        }
+
+        // requests are buffered separately for each destination
+        std::uint32_t const locality_id = naming::get_locality_id_from_gid(raw);
+        refcnt_destination& dest = refcnt_destinations_[locality_id];
+        if (dest.count_++ == 0)
+        {
+            dest.first_request_ = hpx::chrono::high_resolution_clock::now();
+        }
 
+        if (dest.count_ >= max_refcnt_requests_)
+        {
+            send_refcnt_requests_non_blocking(
+                l, std::vector<std::uint32_t>{locality_id}, ec);
+        }
         else if (&ec != &throws)
+        {
             ec = make_success_code();
+        }
+    }
+
+    bool addressing_service::flush_expired_refcnt_requests()
+    {
+        std::unique_lock<mutex_type> l(refcnt_requests_mtx_, std::try_to_lock);
+        if (!l.owns_lock())
+            return true;    // try again after the next interval
+
+        std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+        std::uint64_t const interval =
+            static_cast<std::uint64_t>(refcnt_flush_interval_) * 1000;
+
+        std::vector<std::uint32_t> expired;
+        for (auto const& dest : refcnt_destinations_)
+        {
+            if (now - dest.second.first_request_ >= interval)
+            {
+                expired.push_back(dest.first);
+            }
+        }
+
+        if (!expired.empty())
+        {
+            error_code ec(throwmode::lightweight);
+            send_refcnt_requests_non_blocking(l, expired, ec);
+            if (ec)
+            {
+                LAGAS_(error).format("addressing_service::flush_expired_"
+                                     "refcnt_requests, failed to send "
+                                     "requests: {}",
+                    ec.get_message());
+            }
+        }
+        return true;
     }
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
@@ -2109,7 +2209,7 @@ namespace hpx::agas {
             auto p = std::make_shared<refcnt_requests_type>();
 
             p.swap(refcnt_requests_);
-            refcnt_requests_count_ = 0;
+            refcnt_destinations_.clear();
 
             l.unlock();
 
@@ -2150,6 +2250,10 @@ namespace hpx::agas {
                 hpx::post(action, it->first, HPX_MOVE(it->second));
             }
 
+            refcnt_messages_sent_ += static_cast<std::int64_t>(requests.size());
+            refcnt_messages_saved_ +=
+                static_cast<std::int64_t>(p->size() - requests.size());
+
             if (&ec != &throws)
                 ec = make_success_code();
         }
@@ -2164,6 +2268,82 @@ namespace hpx::agas {
 #endif
     }
 
+    void addressing_service::send_refcnt_requests_non_blocking(
+        [[maybe_unused]] std::unique_lock<addressing_service::mutex_type>& l,
+        [[maybe_unused]] std::vector<std::uint32_t> const& destinations,
+        [[maybe_unused]] error_code& ec)
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT_OWNS_LOCK(l);
+
+        using request_type =
+            hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>;
+
+        std::vector<std::pair<std::uint32_t, std::vector<request_type>>>
+            requests;
+        requests.reserve(destinations.size());
+
+        for (std::uint32_t const locality_id : destinations)
+        {
+            refcnt_destinations_.erase(locality_id);
+
+            // the gids created by the same locality are stored consecutively
+            auto const first = refcnt_requests_->lower_bound(
+                naming::get_gid_from_locality_id(locality_id));
+            auto const last = locality_id + 1 == naming::invalid_locality_id ?
+                refcnt_requests_->end() :
+                refcnt_requests_->lower_bound(
+                    naming::get_gid_from_locality_id(locality_id + 1));
+
+            if (first == last)
+                continue;
+
+            std::vector<request_type> batch;
+            for (auto it = first; it != last; ++it)
+            {
+                HPX_ASSERT(it->second < 0);
+                batch.emplace_back(it->second, it->first, it->first);
+            }
+            refcnt_requests_->erase(first, last);
+
+            requests.emplace_back(locality_id, HPX_MOVE(batch));
+        }
+
+        l.unlock();
+
+        LAGAS_(info).format("addressing_service::send_refcnt_requests_non_"
+                            "blocking, destinations({1})",
+            requests.size());
+
+        try
+        {
+            for (auto& r : requests)
+            {
+                hpx::id_type const target(
+                    primary_namespace::get_service_instance(r.first),
+                    hpx::id_type::management_type::unmanaged);
+
+                refcnt_messages_saved_ +=
+                    static_cast<std::int64_t>(r.second.size() - 1);
+                ++refcnt_messages_sent_;
+
+                server::primary_namespace::decrement_credit_action action;
+                hpx::post(action, target, HPX_MOVE(r.second));
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_RETHROWS_IF(
+                ec, e, "addressing_service::send_refcnt_requests_non_blocking");
+        }
+#else
+        HPX_ASSERT(false);
+#endif
+    }
+
     std::vector<hpx::future<std::vector<std::int64_t>>>
     addressing_service::send_refcnt_requests_async(
         [[maybe_unused]] std::unique_lock<addressing_service::mutex_type>& l)
@@ -2180,7 +2360,7 @@ namespace hpx::agas {
         auto p = std::make_shared<refcnt_requests_type>();
 
         p.swap(refcnt_requests_);
-        refcnt_requests_count_ = 0;
+        refcnt_destinations_.clear();
 
         l.unlock();
 
@@ -2222,6 +2402,10 @@ namespace hpx::agas {
                 hpx::async(action, it->first, HPX_MOVE(it->second)));
         }
 
+        refcnt_messages_sent_ += static_cast<std::int64_t>(requests.size());
+        refcnt_messages_saved_ +=
+            static_cast<std::int64_t>(p->size() - requests.size());
+
         return lazy_results;
 #else
         HPX_ASSERT(false);
@@ -19,11 +19,13 @@
 #include <hpx/async_distributed/base_lco_with_value.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/server/fixed_component_base.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/parcelset_base/traits/action_get_embedded_parcel.hpp>
 #include <hpx/synchronization/condition_variable.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -32,6 +34,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -121,32 +124,60 @@ namespace hpx::agas::server {
 
         using gva_table_data_type = std::pair<gva, naming::gid_type>;
         using gva_table_type = std::map<naming::gid_type, gva_table_data_type>;
-        using refcnt_table_type = std::map<naming::gid_type, std::int64_t>;
+        using gva_hash_table_type =
+            std::unordered_map<naming::gid_type, gva_table_data_type>;
+        using refcnt_table_type =
+            std::unordered_map<naming::gid_type, std::int64_t>;
 
         using resolved_type =
             hpx::tuple<naming::gid_type, gva, naming::gid_type>;
 
-        mutex_type& mutex()
-        {
-            return mutex_;
-        }
-
-    private:
-        // REVIEW: Separate mutexes might reduce contention here. This has to be
-        // investigated carefully.
-        mutex_type mutex_;
+        // number of stripes the tables are split into
+        static constexpr std::size_t num_stripes = 64;
 
-        gva_table_type gvas_;
-        refcnt_table_type refcnts_;
+        // Acquire the lock protecting the table entries of the given id. The
+        // returned lock has to be passed to wait_for_migration_locked and
+        // resolve_gid_locked.
+        std::unique_lock<mutex_type> lock(naming::gid_type const& id);
 
-        using migration_table_type = std::map<naming::gid_type,
+    private:
+        using migration_table_type = std::unordered_map<naming::gid_type,
             hpx::tuple<bool, std::size_t,
                 lcos::local::detail::condition_variable>>;
 
+        // The bindings of single objects, the credit counts, and the objects
+        // being migrated are split into stripes based on the hash of their
+        // gid. Each stripe is protected by its own lock.
+        struct stripe
+        {
+            mutex_type mtx_;
+            gva_hash_table_type gvas_;
+            refcnt_table_type refcnts_;
+            migration_table_type migrating_objects_;
+        };
+
+        [[nodiscard]] static std::size_t stripe_index(
+            naming::gid_type const& id) noexcept;
+
+        [[nodiscard]] stripe& get_stripe(naming::gid_type const& id) noexcept
+        {
+            return stripes_[stripe_index(id)];
+        }
+
+        std::array<util::cache_aligned_data_derived<stripe>, num_stripes>
+            stripes_;
+
+        // Bindings of blocks of objects (count > 1) are kept ordered to be
+        // able to resolve gids referring to an object inside of a block. The
+        // lock protecting the ranges is always acquired after the lock of a
+        // stripe.
+        mutex_type ranges_mtx_;
+        gva_table_type ranges_;
+        std::atomic<std::size_t> num_ranges_;
+
         std::string instance_name_;
         naming::gid_type next_id_;     // next available gid
         naming::gid_type locality_;    // our locality id
-        migration_table_type migrating_objects_;
 
     public:
         // data structure holding all counters for the component_namespace
@@ -184,6 +215,7 @@ namespace hpx::agas::server {
             std::int64_t get_begin_migration_count(bool);
             std::int64_t get_end_migration_count(bool);
             std::int64_t get_overall_count(bool);
+            std::int64_t get_lock_wait_count(bool);
 
             std::int64_t get_bind_gid_time(bool);
             std::int64_t get_resolve_gid_time(bool);
@@ -194,6 +226,7 @@ namespace hpx::agas::server {
             std::int64_t get_begin_migration_time(bool);
             std::int64_t get_end_migration_time(bool);
             std::int64_t get_overall_time(bool);
+            std::int64_t get_lock_wait_time(bool);
 
             // increment counter values
             void increment_bind_gid_count();
@@ -204,6 +237,7 @@ namespace hpx::agas::server {
             void increment_allocate_count();
             void increment_begin_migration_count();
             void increment_end_migration_count();
+            void increment_lock_wait_count();
 
             void enable_all();
 
@@ -230,20 +264,34 @@ namespace hpx::agas::server {
             api_counter_data begin_migration_;
             // primary_ns_end_migration
             api_counter_data end_migration_;
+            // primary_ns_lock_wait
+            api_counter_data lock_wait_;
         };
 
         counter_data counter_data_;
 
     private:
+        // a single credit update for one gid
+        struct credit_update
+        {
+            naming::gid_type gid_;
+            std::int64_t credits_;
+        };
+
+        using credit_update_iterator =
+            std::vector<credit_update>::const_iterator;
+
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        /// Dump the credit counts of all matching ranges. Expects that \p l
-        /// is locked.
-        void dump_refcnt_matches(refcnt_table_type::iterator lower_it,
-            refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
-            naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
-            char const* func_name);
+        /// Dump the credit counts of all gids about to be updated. Expects
+        /// that \p l is locked.
+        void dump_refcnt_matches(refcnt_table_type const& refcnts,
+            credit_update_iterator begin, credit_update_iterator end,
+            std::unique_lock<mutex_type>& l, char const* func_name);
 #endif
 
+        // acquire the given lock, accounting for the time spent waiting
+        std::unique_lock<mutex_type> lock_table(mutex_type& mtx);
+
     public:
         // helper function
         void wait_for_migration_locked(std::unique_lock<mutex_type>& l,
@@ -252,6 +300,7 @@ namespace hpx::agas::server {
     public:
         primary_namespace()
           : base_type(agas::primary_ns_msb, agas::primary_ns_lsb)
+          , num_ranges_(0)
           , next_id_(naming::invalid_gid)
           , locality_(naming::invalid_gid)
         {
@@ -307,9 +356,9 @@ namespace hpx::agas::server {
             std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
             error_code& ec);
 
-        void increment(naming::gid_type const& lower,
-            naming::gid_type const& upper, std::int64_t const& credits,
-            error_code& ec);
+        bool rebind_gid_locked(std::unique_lock<mutex_type>& l,
+            gva_table_data_type& data, gva const& g,
+            naming::gid_type const& gid, naming::gid_type const& locality);
 
         ///////////////////////////////////////////////////////////////////////////
         struct free_entry
@@ -331,19 +380,18 @@ namespace hpx::agas::server {
         using free_entry_list_type =
             std::list<free_entry, free_entry_allocator_type>;
 
-        void resolve_free_list(std::unique_lock<mutex_type>& l,
-            std::list<refcnt_table_type::iterator> const& free_list,
-            free_entry_list_type& free_entry_list,
-            naming::gid_type const& lower, naming::gid_type const& upper,
-            error_code& ec);
+        // Apply all given credit updates, acquiring the lock of each of the
+        // affected stripes only once. The objects whose credit dropped to
+        // zero are added to the free list.
+        void update_credits(std::vector<credit_update>& updates,
+            free_entry_list_type& free_entry_list, error_code& ec);
 
-        void decrement_sweep(free_entry_list_type& free_list,
-            naming::gid_type const& lower, naming::gid_type const& upper,
-            std::int64_t credits, error_code& ec);
+        void resolve_free_entry(std::unique_lock<mutex_type>& l,
+            naming::gid_type const& gid, free_entry_list_type& free_entry_list,
+            error_code& ec);
 
-        void free_components_sync(free_entry_list_type const& free_list,
-            naming::gid_type const& lower, naming::gid_type const& upper,
-            error_code& ec) const;
+        void free_components_sync(
+            free_entry_list_type const& free_list, error_code& ec) const;
 
     public:
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, allocate)
@@ -15,15 +15,21 @@
 #include <hpx/async_distributed/base_lco_with_value.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/server/fixed_component_base.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <array>
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include <hpx/config/warnings_prefix.hpp>
@@ -48,16 +54,43 @@ namespace hpx::agas::server {
         using iterate_names_return_type =
             std::map<std::string, naming::gid_type>;
 
-        using gid_table_type =
-            std::map<std::string, std::shared_ptr<naming::gid_type>>;
+        using gid_table_type = std::unordered_map<std::string,
+            std::shared_ptr<naming::gid_type>>;
 
-        using on_event_data_map_type = std::multimap<std::string, hpx::id_type>;
+        using on_event_data_map_type =
+            std::unordered_multimap<std::string, hpx::id_type>;
+
+        using name_index_type = std::set<std::string>;
+
+        // number of stripes the tables are split into
+        static constexpr std::size_t num_stripes = 64;
 
     private:
-        mutex_type mutex_;
-        gid_table_type gids_;
+        // The names and the registered event handlers are split into stripes
+        // based on the hash of the name. Each stripe is protected by its own
+        // lock.
+        struct stripe
+        {
+            mutex_type mtx_;
+            gid_table_type gids_;
+            on_event_data_map_type on_event_data_;
+        };
+
+        [[nodiscard]] stripe& get_stripe(std::string const& key) noexcept
+        {
+            return stripes_[std::hash<std::string>()(key) % num_stripes];
+        }
+
+        std::array<util::cache_aligned_data_derived<stripe>, num_stripes>
+            stripes_;
+
+        // All bound names are additionally kept ordered to be able to find the
+        // names matching a pattern without visiting all entries. The lock
+        // protecting the index is always acquired after the lock of a stripe.
+        mutex_type names_mtx_;
+        name_index_type names_;
+
         std::string instance_name_;
-        on_event_data_map_type on_event_data_;
 
     public:
         // data structure holding all counters for the component_namespace component
@@ -21,11 +21,14 @@
 #include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/insert_checked.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -82,6 +85,40 @@ namespace hpx::agas::server {
         }
     }
 
+    std::size_t primary_namespace::stripe_index(
+        naming::gid_type const& id) noexcept
+    {
+        // the internal bits of the gid (credits, lock bit, etc.) must not
+        // influence the selected stripe
+        std::uint64_t hash = id.get_lsb() ^
+            (naming::detail::strip_internal_bits_from_gid(id.get_msb()) *
+                0x9e3779b97f4a7c15ULL);
+        hash ^= hash >> 29;
+        return static_cast<std::size_t>(hash % num_stripes);
+    }
+
+    std::unique_lock<primary_namespace::mutex_type> primary_namespace::lock(
+        naming::gid_type const& id)
+    {
+        return lock_table(get_stripe(id).mtx_);
+    }
+
+    std::unique_lock<primary_namespace::mutex_type>
+    primary_namespace::lock_table(mutex_type& mtx)
+    {
+        std::unique_lock<mutex_type> l(mtx, std::try_to_lock);
+        if (!l.owns_lock())
+        {
+            util::scoped_timer<std::atomic<std::int64_t>> update(
+                counter_data_.lock_wait_.time_,
+                counter_data_.lock_wait_.enabled_);
+            counter_data_.increment_lock_wait_count();
+
+            l.lock();
+        }
+        return l;
+    }
+
     // start migration of the given object
     std::pair<hpx::id_type, naming::address> primary_namespace::begin_migration(
         naming::gid_type id)
@@ -92,7 +129,8 @@ namespace hpx::agas::server {
         counter_data_.increment_begin_migration_count();
         using hpx::get;
 
-        std::unique_lock<mutex_type> l(mutex_);
+        stripe& s = get_stripe(id);
+        std::unique_lock<mutex_type> l = lock_table(s.mtx_);
 
         wait_for_migration_locked(l, id, hpx::throws);
         resolved_type r = resolve_gid_locked_non_local(l, id, hpx::throws);
@@ -107,11 +145,11 @@ namespace hpx::agas::server {
             return std::make_pair(hpx::invalid_id, naming::address());
         }
 
-        auto it = migrating_objects_.find(id);
-        if (it == migrating_objects_.end())
+        auto it = s.migrating_objects_.find(id);
+        if (it == s.migrating_objects_.end())
         {
             std::pair<migration_table_type::iterator, bool> const p =
-                migrating_objects_.emplace(std::piecewise_construct,
+                s.migrating_objects_.emplace(std::piecewise_construct,
                     std::forward_as_tuple(id), std::forward_as_tuple());
             HPX_ASSERT(p.second);
             it = p.first;
@@ -144,12 +182,13 @@ namespace hpx::agas::server {
             counter_data_.end_migration_.enabled_);
         counter_data_.increment_end_migration_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        stripe& s = get_stripe(id);
+        std::unique_lock<mutex_type> l = lock_table(s.mtx_);
 
         using hpx::get;
 
-        if (auto const it = migrating_objects_.find(id);
-            it != migrating_objects_.end())
+        if (auto const it = s.migrating_objects_.find(id);
+            it != s.migrating_objects_.end())
         {
             // flag this id as not being migrated anymore
             get<0>(it->second) = false;
@@ -159,7 +198,7 @@ namespace hpx::agas::server {
             }
             else
             {
-                migrating_objects_.erase(it);
+                s.migrating_objects_.erase(it);
             }
         }
 
@@ -178,8 +217,11 @@ namespace hpx::agas::server {
 
         using hpx::get;
 
-        if (auto const it = migrating_objects_.find(id);
-            it != migrating_objects_.end())
+        stripe& s = get_stripe(id);
+        HPX_ASSERT(l.mutex() == &s.mtx_);
+
+        if (auto const it = s.migrating_objects_.find(id);
+            it != s.migrating_objects_.end())
         {
             if (get<0>(it->second))
             {
@@ -189,112 +231,135 @@ namespace hpx::agas::server {
 
                 if (--get<1>(it->second) == 0)    //-V516
                 {
-                    migrating_objects_.erase(it);
+                    s.migrating_objects_.erase(it);
                 }
             }
             else
             {
                 if (get<1>(it->second) == 0)
                 {
-                    migrating_objects_.erase(it);
+                    s.migrating_objects_.erase(it);
                 }
             }
         }
     }
 
-    bool primary_namespace::bind_gid(
-        gva const& g, naming::gid_type id, naming::gid_type const& locality)
-    {    // {{{ bind_gid implementation
-        util::scoped_timer<std::atomic<std::int64_t>> update(
-            counter_data_.bind_gid_.time_, counter_data_.bind_gid_.enabled_);
-        counter_data_.increment_bind_gid_count();
-        using hpx::get;
+    // Update an existing binding (e.g. move semantics), expects that \a l is
+    // locked and protects the given binding.
+    bool primary_namespace::rebind_gid_locked(std::unique_lock<mutex_type>& l,
+        gva_table_data_type& data, gva const& g, naming::gid_type const& gid,
+        naming::gid_type const& locality)
+    {
+        HPX_ASSERT_OWNS_LOCK(l);
 
-        naming::gid_type const gid = id;
-        naming::detail::strip_internal_bits_from_gid(id);
+        // non-migratable gids can't be rebound
+        if (naming::refers_to_local_lva(gid) &&
+            !naming::refers_to_virtual_memory(gid))
+        {
+            l.unlock();
 
-        std::unique_lock<mutex_type> l(mutex_);
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "primary_namespace::bind_gid",
+                "cannot rebind gids for non-migratable objects");
+        }
 
-        auto const begin = gvas_.begin();
-        auto const end = gvas_.end();
+        gva& gaddr = data.first;
+        naming::gid_type& loc = data.second;
 
-        if (auto it = gvas_.lower_bound(id); it != end)
+        // Check for count mismatch (we can't change block sizes of existing
+        // bindings).
+        if (HPX_UNLIKELY(gaddr.count != g.count))
         {
-            // If we got an exact match, this is a request to update an existing
-            // binding (e.g. move semantics).
-            if (it->first == id)
-            {
-                // non-migratable gids can't be rebound
-                if (naming::refers_to_local_lva(gid) &&
-                    !naming::refers_to_virtual_memory(gid))
-                {
-                    l.unlock();
+            // REVIEW: Is this the right error code to use?
+            l.unlock();
 
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "cannot rebind gids for non-migratable objects");
-                }
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "primary_namespace::bind_gid",
+                "cannot change block size of existing binding");
+        }
 
-                gva& gaddr = it->second.first;
-                naming::gid_type& loc = it->second.second;
+        if (HPX_UNLIKELY(
+                to_int(hpx::components::component_enum_type::invalid) ==
+                g.type))
+        {
+            l.unlock();
 
-                // Check for count mismatch (we can't change block sizes of
-                // existing bindings).
-                if (HPX_UNLIKELY(gaddr.count != g.count))
-                {
-                    // REVIEW: Is this the right error code to use?
-                    l.unlock();
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "primary_namespace::bind_gid",
+                "attempt to update a GVA with an invalid type, "
+                "gid({1}), gva({2}), locality({3})",
+                gid, g, locality);
+        }
 
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "cannot change block size of existing binding");
-                }
+        if (HPX_UNLIKELY(!locality))
+        {
+            l.unlock();
 
-                if (HPX_UNLIKELY(
-                        to_int(hpx::components::component_enum_type::invalid) ==
-                        g.type))
-                {
-                    l.unlock();
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "primary_namespace::bind_gid",
+                "attempt to update a GVA with an invalid "
+                "locality id, "
+                "gid({1}), gva({2}), locality({3})",
+                gid, g, locality);
+        }
 
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "attempt to update a GVA with an invalid type, "
-                        "gid({1}), gva({2}), locality({3})",
-                        id, g, locality);
-                }
+        // Store the new endpoint and offset
+        gaddr.prefix = g.prefix;
+        gaddr.type = g.type;
+        gaddr.lva(g.lva());
+        gaddr.offset = g.offset;
+        loc = locality;
 
-                if (HPX_UNLIKELY(!locality))
-                {
-                    l.unlock();
+        l.unlock();
 
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "attempt to update a GVA with an invalid "
-                        "locality id, "
-                        "gid({1}), gva({2}), locality({3})",
-                        id, g, locality);
-                }
+        LAGAS_(info).format("primary_namespace::bind_gid, gid({1}), gva({2}), "
+                            "locality({3}), response(repeated_request)",
+            gid, g, locality);
 
-                // Store the new endpoint and offset
-                gaddr.prefix = g.prefix;
-                gaddr.type = g.type;
-                gaddr.lva(g.lva());
-                gaddr.offset = g.offset;
-                loc = locality;
+        return false;
+    }
 
-                l.unlock();
+    bool primary_namespace::bind_gid(
+        gva const& g, naming::gid_type id, naming::gid_type const& locality)
+    {    // {{{ bind_gid implementation
+        util::scoped_timer<std::atomic<std::int64_t>> update(
+            counter_data_.bind_gid_.time_, counter_data_.bind_gid_.enabled_);
+        counter_data_.increment_bind_gid_count();
+        using hpx::get;
 
-                LAGAS_(info).format(
-                    "primary_namespace::bind_gid, gid({1}), gva({2}), "
-                    "locality({3}), response(repeated_request)",
-                    id, g, locality);
+        naming::gid_type const gid = id;
+        naming::detail::strip_internal_bits_from_gid(id);
+
+        stripe& s = get_stripe(id);
+        std::unique_lock<mutex_type> l = lock_table(s.mtx_);
+
+        // If we got an exact match, this is a request to update an existing
+        // binding (e.g. move semantics).
+        if (auto const it = s.gvas_.find(id); it != s.gvas_.end())
+        {
+            return rebind_gid_locked(l, it->second, g, id, locality);
+        }
 
-                return false;
+        // Check the bindings of blocks of objects, the lock for the ranges is
+        // required only if there are any or if a new one is inserted.
+        std::unique_lock<mutex_type> rl;
+        if (g.count > 1 || num_ranges_.load(std::memory_order_acquire) != 0)
+        {
+            rl = lock_table(ranges_mtx_);
+        }
+
+        if (rl.owns_lock() && !ranges_.empty())
+        {
+            auto it = ranges_.lower_bound(id);
+            if (it != ranges_.end() && it->first == id)
+            {
+                l.unlock();
+                return rebind_gid_locked(rl, it->second, g, id, locality);
             }
 
-            // We're about to decrement the iterator it - first, we
-            // check that it's safe to do this.
-            else if (it != begin)
+            // We're about to decrement the iterator it - first, we check that
+            // it's safe to do this.
+            if (it != ranges_.begin())
             {
                 --it;
 
@@ -302,6 +367,7 @@ namespace hpx::agas::server {
                 if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
                 {
                     // REVIEW: Is this the right error code to use?
+                    rl.unlock();
                     l.unlock();
 
                     HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
@@ -311,26 +377,16 @@ namespace hpx::agas::server {
             }
         }
 
-        else if (HPX_LIKELY(!gvas_.empty()))
-        {
-            --it;
-
-            // Check that a previous range doesn't cover the new id.
-            if ((it->first + it->second.first.count) > id)
-            {
-                // REVIEW: Is this the right error code to use?
-                l.unlock();
-
-                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                    "primary_namespace::bind_gid",
-                    "the new GID is contained in an existing range");
-            }
-        }
-
         // non-migratable gids don't need to be bound
         if (naming::refers_to_local_lva(gid) &&
             !naming::refers_to_virtual_memory(gid))
         {
+            if (rl.owns_lock())
+            {
+                rl.unlock();
+            }
+            l.unlock();
+
             LAGAS_(info).format(
                 "primary_namespace::bind_gid, gid({1}), gva({2}), "
                 "locality({3})",
@@ -343,6 +399,10 @@ namespace hpx::agas::server {
 
         if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
         {
+            if (rl.owns_lock())
+            {
+                rl.unlock();
+            }
             l.unlock();
 
             HPX_THROW_EXCEPTION(hpx::error::internal_server_error,
@@ -354,6 +414,10 @@ namespace hpx::agas::server {
                 to_int(hpx::components::component_enum_type::invalid) ==
                 g.type))
         {
+            if (rl.owns_lock())
+            {
+                rl.unlock();
+            }
             l.unlock();
 
             HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
@@ -364,11 +428,30 @@ namespace hpx::agas::server {
         }
 
         // Insert a GID -> GVA entry into the GVA table.
-        if (HPX_UNLIKELY(!util::insert_checked(
-                gvas_.emplace(id, std::make_pair(g, locality)))))
+        bool inserted = false;
+        if (g.count > 1)
         {
-            l.unlock();
+            inserted = util::insert_checked(
+                ranges_.emplace(id, std::make_pair(g, locality)));
+            if (inserted)
+            {
+                num_ranges_.fetch_add(1, std::memory_order_release);
+            }
+        }
+        else
+        {
+            inserted = util::insert_checked(
+                s.gvas_.emplace(id, std::make_pair(g, locality)));
+        }
+
+        if (rl.owns_lock())
+        {
+            rl.unlock();
+        }
+        l.unlock();
 
+        if (HPX_UNLIKELY(!inserted))
+        {
             HPX_THROW_EXCEPTION(hpx::error::lock_error,
                 "primary_namespace::bind_gid",
                 "GVA table insertion failed due to a locking error or "
@@ -376,8 +459,6 @@ namespace hpx::agas::server {
                 id, g, locality);
         }
 
-        l.unlock();
-
         LAGAS_(info).format(
             "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
             id, g, locality);
@@ -415,7 +496,7 @@ namespace hpx::agas::server {
         }
         else
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            std::unique_lock<mutex_type> l = lock(id);
 
             // wait for any migration to be completed
             if (naming::detail::is_migratable(id))
@@ -461,10 +542,11 @@ namespace hpx::agas::server {
 
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        stripe& s = get_stripe(id);
+        std::unique_lock<mutex_type> l = lock_table(s.mtx_);
 
-        auto const it = gvas_.find(id);
-        if (auto const end = gvas_.end(); it != end)
+        std::optional<gva_table_data_type> data;
+        if (auto const it = s.gvas_.find(id); it != s.gvas_.end())
         {
             if (HPX_UNLIKELY(it->second.first.count != count))
             {
@@ -474,17 +556,41 @@ namespace hpx::agas::server {
                     "primary_namespace::unbind_gid", "block sizes must match");
             }
 
-            gva_table_data_type const data = it->second;
+            data = it->second;
+            s.gvas_.erase(it);
+        }
+        else if (num_ranges_.load(std::memory_order_acquire) != 0)
+        {
+            std::unique_lock<mutex_type> rl = lock_table(ranges_mtx_);
 
-            gvas_.erase(it);
+            if (auto const rit = ranges_.find(id); rit != ranges_.end())
+            {
+                if (HPX_UNLIKELY(rit->second.first.count != count))
+                {
+                    rl.unlock();
+                    l.unlock();
 
-            l.unlock();
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "primary_namespace::unbind_gid",
+                        "block sizes must match");
+                }
+
+                data = rit->second;
+                ranges_.erase(rit);
+                num_ranges_.fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        l.unlock();
+
+        if (data)
+        {
             LAGAS_(info).format(
                 "primary_namespace::unbind_gid, gid({1}), count({2}), "
                 "gva({3}), locality_id({4})",
-                id, count, data.first, data.second);
+                id, count, data->first, data->second);
 
-            gva g = data.first;
+            gva const& g = data->first;
             return {g.prefix, g.type, g.lva()};
         }
 
@@ -506,8 +612,6 @@ namespace hpx::agas::server {
             return {g.prefix, g.type, g.lva()};
         }
 
-        l.unlock();
-
         LAGAS_(info).format(
             "primary_namespace::unbind_gid, gid({1}), count({2}), "
             "response(no_success)",
@@ -533,7 +637,16 @@ namespace hpx::agas::server {
         // Increment.
         if (credits > 0)
         {
-            increment(lower, upper, credits, hpx::throws);
+            std::vector<credit_update> updates;
+            for (naming::gid_type raw = lower; raw != upper; ++raw)
+            {
+                updates.push_back(credit_update{raw, credits});
+            }
+
+            free_entry_list_type free_list;
+            update_credits(updates, free_list, hpx::throws);
+            HPX_ASSERT(free_list.empty());
+
             return credits;
         }
 
@@ -554,6 +667,11 @@ namespace hpx::agas::server {
         std::vector<int64_t> res_credits;
         res_credits.reserve(requests.size());
 
+        // All requests of the batch are applied together, the lock of each
+        // affected stripe is acquired only once.
+        std::vector<credit_update> updates;
+        updates.reserve(requests.size());
+
         for (auto& req : requests)
         {
             std::int64_t credits = hpx::get<0>(req);
@@ -567,22 +685,25 @@ namespace hpx::agas::server {
                 ++upper;
 
             // Decrement.
-            if (credits < 0)
-            {
-                free_entry_list_type free_list;
-                decrement_sweep(free_list, lower, upper, -credits, hpx::throws);
-
-                free_components_sync(free_list, lower, upper, hpx::throws);
-            }
-            else
+            if (credits >= 0)
             {
                 HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                     "primary_namespace::decrement_credit",
                     "invalid credit count of {1}", credits);
             }
+
+            for (naming::gid_type raw = lower; raw != upper; ++raw)
+            {
+                updates.push_back(credit_update{raw, credits});
+            }
             res_credits.push_back(credits);
         }
 
+        free_entry_list_type free_list;
+        update_credits(updates, free_list, hpx::throws);
+
+        free_components_sync(free_list, hpx::throws);
+
         return res_credits;
     }
 
@@ -649,30 +770,27 @@ namespace hpx::agas::server {
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void primary_namespace::dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it,
-        refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
-        naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
+        refcnt_table_type const& refcnts, credit_update_iterator begin,
+        credit_update_iterator end, std::unique_lock<mutex_type>& l,
         char const* func_name)
     {
         // dump_refcnt_matches implementation
         HPX_ASSERT(l.owns_lock());
 
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
-            // We got nothing, bail - our caller is probably about to throw.
-            return;
-
         std::stringstream ss;
         hpx::util::format_to(ss,
-            "{1}, dumping server-side refcnt table matches, lower({2}), "
-            "upper({3}):",
-            func_name, lower, upper);
+            "{1}, dumping server-side refcnt table matches:", func_name);
 
-        for (/**/; lower_it != upper_it; ++lower_it)
+        for (/**/; begin != end; ++begin)
         {
+            auto const it = refcnts.find(begin->gid_);
+            if (it == refcnts.end())
+                continue;
+
             // The [server] tag is in there to make it easier to filter
             // through the logs.
             hpx::util::format_to(ss, "\n  [server] lower({1}), credits({2})",
-                lower_it->first, lower_it->second);
+                it->first, it->second);
         }
 
         LAGAS_(debug) << ss.str();
@@ -680,79 +798,108 @@ namespace hpx::agas::server {
 #endif
 
     ///////////////////////////////////////////////////////////////////////////////
-    void primary_namespace::increment(naming::gid_type const& lower,
-        naming::gid_type const& upper, std::int64_t const& credits,
-        error_code& ec)
-    {    // {{{ increment implementation
-        std::unique_lock<mutex_type> l(mutex_);
-
-#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        if (LAGAS_ENABLED(debug))
+    void primary_namespace::update_credits(std::vector<credit_update>& updates,
+        free_entry_list_type& free_entry_list, error_code& ec)
+    {    // {{{ update_credits implementation
+
+        // Group the updates by stripe, the relative order of the updates for
+        // the same gid is preserved.
+        std::stable_sort(updates.begin(), updates.end(),
+            [](credit_update const& lhs, credit_update const& rhs) {
+                return stripe_index(lhs.gid_) < stripe_index(rhs.gid_);
+            });
+
+        auto begin = updates.cbegin();
+        auto const end = updates.cend();
+        while (begin != end)
         {
-            typedef refcnt_table_type::iterator iterator;
+            std::size_t const index = stripe_index(begin->gid_);
+            auto const last = std::find_if(begin, end,
+                [index](credit_update const& u) {
+                    return stripe_index(u.gid_) != index;
+                });
 
-            // Find the mappings that we're about to touch.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-            refcnt_table_type::iterator upper_it;
-            if (lower != upper)
-            {
-                upper_it = refcnts_.find(upper);
-            }
-            else
+            stripe& s = stripes_[index];
+            std::unique_lock<mutex_type> l = lock_table(s.mtx_);
+
+#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
+            if (LAGAS_ENABLED(debug))
             {
-                upper_it = lower_it;
-                ++upper_it;
+                dump_refcnt_matches(s.refcnts_, begin, last, l,
+                    "primary_namespace::update_credits");
             }
-
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                "primary_namespace::increment");
-        }
 #endif
 
-        // TODO: Whine loudly if a reference count overflows. We reserve ~0 for
-        // internal bookkeeping in the decrement algorithm, so the maximum global
-        // reference count is 2^64 - 2. The maximum number of credits a single GID
-        // can hold, however, is limited to 2^32 - 1.
-
-        // The third parameter we pass here is the default data to use in case the
-        // key is not mapped. We don't insert GIDs into the refcnt table when we
-        // allocate/bind them, so if a GID is not in the refcnt table, we know that
-        // it's global reference count is the initial global reference count.
+            // TODO: Whine loudly if a reference count overflows. We reserve ~0
+            // for internal bookkeeping in the decrement algorithm, so the
+            // maximum global reference count is 2^64 - 2. The maximum number
+            // of credits a single GID can hold, however, is limited to
+            // 2^32 - 1.
 
-        for (naming::gid_type raw = lower; raw != upper; ++raw)
-        {
-            auto it = refcnts_.find(raw);
-            if (it == refcnts_.end())
+            // We don't insert GIDs into the refcnt table when we
+            // allocate/bind them, so if a GID is not in the refcnt table, we
+            // know that it's global reference count is the initial global
+            // reference count.
+            for (/**/; begin != last; ++begin)
             {
-                std::int64_t count =
-                    static_cast<std::int64_t>(HPX_GLOBALCREDIT_INITIAL) +
-                    credits;
+                naming::gid_type const& raw = begin->gid_;
+
+                auto it = s.refcnts_.find(raw);
+
+                std::int64_t count = begin->credits_;
+                if (it == s.refcnts_.end())
+                {
+                    count +=
+                        static_cast<std::int64_t>(HPX_GLOBALCREDIT_INITIAL);
+                }
+                else
+                {
+                    count += it->second;
+                }
 
-                std::pair<refcnt_table_type::iterator, bool> const p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
-                if (!p.second)
+                // Sanity check.
+                if (count < 0)
                 {
                     l.unlock();
 
                     HPX_THROWS_IF(ec, hpx::error::invalid_data,
-                        "primary_namespace::increment",
-                        "couldn't create entry in reference count table, "
-                        "raw({1}), ref-count({2})",
+                        "primary_namespace::update_credits",
+                        "negative entry in reference count table, raw({1}), "
+                        "refcount({2})",
                         raw, count);
                     return;
                 }
 
-                it = p.first;
-            }
-            else
-            {
-                it->second += credits;
-            }
+                LAGAS_(info).format(
+                    "primary_namespace::update_credits, raw({1}), "
+                    "credits({2}), refcnt({3})",
+                    raw, begin->credits_, count);
 
-            LAGAS_(info).format(
-                "primary_namespace::increment, raw({1}), refcnt({2})", lower,
-                it->second);
-        }
+                if (count != 0)
+                {
+                    if (it == s.refcnts_.end())
+                    {
+                        s.refcnts_.emplace(raw, count);
+                    }
+                    else
+                    {
+                        it->second = count;
+                    }
+                    continue;
+                }
+
+                // this object needs to be deleted, remove its entry from the
+                // refcnt table
+                if (it != s.refcnts_.end())
+                {
+                    s.refcnts_.erase(it);
+                }
+
+                resolve_free_entry(l, raw, free_entry_list, ec);
+                if (ec)
+                    return;
+            }
+        }    // Unlock the mutex.
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -764,223 +911,86 @@ namespace hpx::agas::server {
 #pragma warning(push)
 #pragma warning(disable : 26110)
 #endif
-    void primary_namespace::resolve_free_list(std::unique_lock<mutex_type>& l,
-        std::list<refcnt_table_type::iterator> const& free_list,
-        free_entry_list_type& free_entry_list,
-        naming::gid_type const& /* lower */,
-        naming::gid_type const& /* upper */, error_code& ec)
+    void primary_namespace::resolve_free_entry(std::unique_lock<mutex_type>& l,
+        naming::gid_type const& gid, free_entry_list_type& free_entry_list,
+        error_code& ec)
     {
         HPX_ASSERT_OWNS_LOCK(l);
 
         using hpx::get;
 
-        using iterator = refcnt_table_type::iterator;
-
-        for (iterator const& it : free_list)
+        if (naming::detail::is_migratable(gid))
         {
-            using key_type = refcnt_table_type::key_type;
-
-            // The mapping's key space.
-            key_type gid = it->first;
-
-            if (naming::detail::is_migratable(gid))
-            {
-                // wait for any migration to be completed
-                wait_for_migration_locked(l, gid, ec);
-            }
-
-            // Resolve the query GID.
-            resolved_type r = resolve_gid_locked(l, gid, ec);
-            if (ec)
-                return;
+            // wait for any migration to be completed
+            wait_for_migration_locked(l, gid, ec);
+        }
 
-            naming::gid_type& raw = get<0>(r);
-            if (raw == naming::invalid_gid)
-            {
-                l.unlock();
+        // Resolve the query GID.
+        resolved_type r = resolve_gid_locked(l, gid, ec);
+        if (ec)
+            return;
 
-                HPX_THROWS_IF(ec, hpx::error::internal_server_error,
-                    "primary_namespace::resolve_free_list",
-                    "primary_namespace::resolve_free_list, failed to resolve "
-                    "gid, gid({1})",
-                    gid);
-                return;    // couldn't resolve this one
-            }
+        naming::gid_type& raw = get<0>(r);
+        if (raw == naming::invalid_gid)
+        {
+            l.unlock();
 
-            // Make sure the GVA is valid.
-            gva& g = get<1>(r);
+            HPX_THROWS_IF(ec, hpx::error::internal_server_error,
+                "primary_namespace::resolve_free_entry",
+                "primary_namespace::resolve_free_entry, failed to resolve "
+                "gid, gid({1})",
+                gid);
+            return;    // couldn't resolve this one
+        }
 
-            // REVIEW: Should we do more to make sure the GVA is valid?
-            if (HPX_UNLIKELY(
-                    to_int(hpx::components::component_enum_type::invalid) ==
-                    g.type))
-            {
-                l.unlock();
+        // Make sure the GVA is valid.
+        gva& g = get<1>(r);
 
-                HPX_THROWS_IF(ec, hpx::error::internal_server_error,
-                    "primary_namespace::resolve_free_list",
-                    "encountered a GVA with an invalid type while performing a "
-                    "decrement, gid({1}), gva({2})",
-                    gid, g);
-                return;
-            }
-            else if (HPX_UNLIKELY(0 == g.count))
-            {
-                l.unlock();
+        // REVIEW: Should we do more to make sure the GVA is valid?
+        if (HPX_UNLIKELY(
+                to_int(hpx::components::component_enum_type::invalid) ==
+                g.type))
+        {
+            l.unlock();
 
-                HPX_THROWS_IF(ec, hpx::error::internal_server_error,
-                    "primary_namespace::resolve_free_list",
-                    "encountered a GVA with a count of zero while performing a "
-                    "decrement, gid({1}), gva({2})",
-                    gid, g);
-                return;
-            }
+            HPX_THROWS_IF(ec, hpx::error::internal_server_error,
+                "primary_namespace::resolve_free_entry",
+                "encountered a GVA with an invalid type while performing a "
+                "decrement, gid({1}), gva({2})",
+                gid, g);
+            return;
+        }
+        else if (HPX_UNLIKELY(0 == g.count))
+        {
+            l.unlock();
 
-            LAGAS_(info).format(
-                "primary_namespace::resolve_free_list, resolved match, "
-                "gid({1}), gva({2})",
+            HPX_THROWS_IF(ec, hpx::error::internal_server_error,
+                "primary_namespace::resolve_free_entry",
+                "encountered a GVA with a count of zero while performing a "
+                "decrement, gid({1}), gva({2})",
                 gid, g);
+            return;
+        }
 
-            // Fully resolve the range.
-            gva const resolved = g.resolve(gid, raw);
+        LAGAS_(info).format(
+            "primary_namespace::resolve_free_entry, resolved match, "
+            "gid({1}), gva({2})",
+            gid, g);
 
-            // Add the information needed to destroy these components to the
-            // free list.
-            free_entry_list.emplace_back(resolved, gid, get<2>(r));
+        // Fully resolve the range.
+        gva const resolved = g.resolve(gid, raw);
 
-            // remove this entry from the refcnt table
-            refcnts_.erase(it);
-        }
+        // Add the information needed to destroy these components to the
+        // free list.
+        free_entry_list.emplace_back(resolved, gid, get<2>(r));
     }
 #if defined(HPX_MSVC)
 #pragma warning(pop)
 #endif
 
-    ///////////////////////////////////////////////////////////////////////////////
-    void primary_namespace::decrement_sweep(
-        free_entry_list_type& free_entry_list, naming::gid_type const& lower,
-        naming::gid_type const& upper, std::int64_t credits, error_code& ec)
-    {    // {{{ decrement_sweep implementation
-        LAGAS_(info).format(
-            "primary_namespace::decrement_sweep, lower({1}), upper({2}), "
-            "credits({3})",
-            lower, upper, credits);
-
-        free_entry_list.clear();
-
-        {
-            std::unique_lock<mutex_type> l(mutex_);
-
-#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-            if (LAGAS_ENABLED(debug))
-            {
-                typedef refcnt_table_type::iterator iterator;
-
-                // Find the mappings that we just added or modified.
-                refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-                refcnt_table_type::iterator upper_it;
-                if (lower != upper)
-                {
-                    upper_it = refcnts_.find(upper);
-                }
-                else
-                {
-                    upper_it = lower_it;
-                    ++upper_it;
-                }
-
-                dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                    "primary_namespace::decrement_sweep");
-            }
-#endif
-
-            ///////////////////////////////////////////////////////////////////////
-            // Apply the decrement across the entire key space (e.g. [lower, upper]).
-
-            // The third parameter we pass here is the default data to use in case
-            // the key is not mapped. We don't insert GIDs into the refcnt table
-            // when we allocate/bind them, so if a GID is not in the refcnt table,
-            // we know that it's global reference count is the initial global
-            // reference count.
-
-            std::list<refcnt_table_type::iterator> free_list;    //-V826
-            for (naming::gid_type raw = lower; raw != upper; ++raw)
-            {
-                auto it = refcnts_.find(raw);
-                if (it == refcnts_.end())
-                {
-                    if (credits >
-                        static_cast<std::int64_t>(HPX_GLOBALCREDIT_INITIAL))
-                    {
-                        l.unlock();
-
-                        HPX_THROWS_IF(ec, hpx::error::invalid_data,
-                            "primary_namespace::decrement_sweep",
-                            "negative entry in reference count table, "
-                            "raw({1}), refcount({2})",
-                            raw,
-                            static_cast<std::int64_t>(
-                                HPX_GLOBALCREDIT_INITIAL) -
-                                credits);
-                        return;
-                    }
-
-                    std::int64_t count =
-                        static_cast<std::int64_t>(HPX_GLOBALCREDIT_INITIAL) -
-                        credits;
-
-                    std::pair<refcnt_table_type::iterator, bool> const p =
-                        refcnts_.emplace(raw, count);
-                    if (!p.second)
-                    {
-                        l.unlock();
-
-                        HPX_THROWS_IF(ec, hpx::error::invalid_data,
-                            "primary_namespace::decrement_sweep",
-                            "couldn't create entry in reference count table, "
-                            "raw({1}), ref-count({2})",
-                            raw, count);
-                        return;
-                    }
-
-                    it = p.first;
-                }
-                else
-                {
-                    it->second -= credits;
-                }
-
-                // Sanity check.
-                if (it->second < 0)
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, hpx::error::invalid_data,
-                        "primary_namespace::decrement_sweep",
-                        "negative entry in reference count table, raw({1}), "
-                        "refcount({2})",
-                        raw, it->second);
-                    return;
-                }
-
-                // this objects needs to be deleted
-                if (it->second == 0)
-                    free_list.push_back(it);
-            }
-
-            // Resolve the objects which have to be deleted.
-            resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
-
-        }    // Unlock the mutex.
-
-        if (&ec != &throws)
-            ec = make_success_code();
-    }
-
     ///////////////////////////////////////////////////////////////////////////////
     void primary_namespace::free_components_sync(
-        free_entry_list_type const& free_list, naming::gid_type const& lower,
-        naming::gid_type const& upper, error_code& ec) const
+        free_entry_list_type const& free_list, error_code& ec) const
     {
         using hpx::get;
 
@@ -994,16 +1004,16 @@ namespace hpx::agas::server {
             {
                 LAGAS_(info).format(
                     "primary_namespace::free_components_sync, cancelling free "
-                    "operation because the threadmanager is down, lower({1}), "
-                    "upper({2}), base({3}), gva({4}), locality({5})",
-                    lower, upper, e.gid_, e.gva_, e.locality_);
+                    "operation because the threadmanager is down, base({1}), "
+                    "gva({2}), locality({3})",
+                    e.gid_, e.gva_, e.locality_);
                 continue;
             }
 
             LAGAS_(info).format(
                 "primary_namespace::free_components_sync, freeing component, "
-                "lower({1}), upper({2}), base({3}), gva({4}), locality({5})",
-                lower, upper, e.gid_, e.gva_, e.locality_);
+                "base({1}), gva({2}), locality({3})",
+                e.gid_, e.gva_, e.locality_);
 
             // Destroy the component.
             HPX_ASSERT(e.locality_ == e.gva_.prefix);
@@ -1070,24 +1080,26 @@ namespace hpx::agas::server {
         naming::gid_type id = gid;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        gva_table_type::const_iterator it = gvas_.lower_bound(id);
-        gva_table_type::const_iterator const begin = gvas_.begin();
+        // Check for exact match of a single object
+        stripe const& s = get_stripe(id);
+        HPX_ASSERT(l.mutex() == &s.mtx_);
 
-        if (gva_table_type::const_iterator const end = gvas_.end(); it != end)
+        if (auto const it = s.gvas_.find(id); it != s.gvas_.end())
         {
-            // Check for exact match
-            if (it->first == id)
-            {
-                if (&ec != &throws)
-                    ec = make_success_code();
+            if (&ec != &throws)
+                ec = make_success_code();
 
-                gva_table_data_type const& data = it->second;
-                return resolved_type(it->first, data.first, data.second);
-            }
+            gva_table_data_type const& data = it->second;
+            return resolved_type(it->first, data.first, data.second);
+        }
 
-            // We need to decrement the iterator, first we check that it's safe
-            // to do this.
-            if (it != begin)
+        // Check for the GID being part of a block of objects
+        if (num_ranges_.load(std::memory_order_acquire) != 0)
+        {
+            std::unique_lock<mutex_type> rl = lock_table(ranges_mtx_);
+
+            auto it = ranges_.upper_bound(id);
+            if (it != ranges_.begin())
             {
                 --it;
 
@@ -1097,6 +1109,7 @@ namespace hpx::agas::server {
                 {
                     if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
                     {
+                        rl.unlock();
                         l.unlock();
 
                         HPX_THROWS_IF(ec, hpx::error::internal_server_error,
@@ -1115,32 +1128,6 @@ namespace hpx::agas::server {
             }
         }
 
-        else if (HPX_LIKELY(!gvas_.empty()))
-        {
-            --it;
-
-            // Found the GID in a range
-            gva_table_data_type const& data = it->second;
-            if ((it->first + data.first.count) > id)
-            {
-                if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, hpx::error::internal_server_error,
-                        "primary_namespace::resolve_gid_locked",
-                        "MSBs of lower and upper range bound do not match");
-                    return resolved_type(
-                        naming::invalid_gid, gva(), naming::invalid_gid);
-                }
-
-                if (&ec != &throws)
-                    ec = make_success_code();
-
-                return resolved_type(it->first, data.first, data.second);
-            }
-        }
-
         if (&ec != &throws)
             ec = make_success_code();
 
@@ -1210,6 +1197,12 @@ namespace hpx::agas::server {
         return util::get_and_reset_value(end_migration_.count_, reset);
     }
 
+    std::int64_t primary_namespace::counter_data::get_lock_wait_count(
+        bool reset)
+    {
+        return util::get_and_reset_value(lock_wait_.count_, reset);
+    }
+
     std::int64_t primary_namespace::counter_data::get_overall_count(bool reset)
     {
         return
@@ -1273,6 +1266,12 @@ namespace hpx::agas::server {
         return util::get_and_reset_value(end_migration_.time_, reset);
     }
 
+    std::int64_t primary_namespace::counter_data::get_lock_wait_time(
+        bool reset)
+    {
+        return util::get_and_reset_value(lock_wait_.time_, reset);
+    }
+
     std::int64_t primary_namespace::counter_data::get_overall_time(bool reset)
     {
         return
@@ -1369,6 +1368,14 @@ namespace hpx::agas::server {
         }
     }
 
+    void primary_namespace::counter_data::increment_lock_wait_count()
+    {
+        if (lock_wait_.enabled_)
+        {
+            ++lock_wait_.count_;
+        }
+    }
+
 #if defined(HPX_HAVE_NETWORKING)
     std::int64_t primary_namespace::counter_data::get_route_count(bool reset)
     {
@@ -26,6 +26,7 @@
 #include <mutex>
 #include <regex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -87,12 +88,13 @@ namespace hpx::agas::server {
             counter_data_.bind_.time_, counter_data_.bind_.enabled_);
         counter_data_.increment_bind_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        stripe& s = get_stripe(key);
+        std::unique_lock<mutex_type> l(s.mtx_);
 
         naming::gid_type gid = gid_;
 
-        auto const it = gids_.find(key);
-        if (auto const end = gids_.end(); it != end)
+        auto const it = s.gids_.find(key);
+        if (auto const end = s.gids_.end(); it != end)
         {
             std::int64_t const credits =
                 naming::detail::get_credit_from_gid(gid);
@@ -136,7 +138,7 @@ namespace hpx::agas::server {
         }
 
         if (HPX_UNLIKELY(!util::insert_checked(
-                gids_.emplace(key, std::make_shared<naming::gid_type>(gid)))))
+                s.gids_.emplace(key, std::make_shared<naming::gid_type>(gid)))))
         {
             l.unlock();
 
@@ -146,8 +148,13 @@ namespace hpx::agas::server {
                 "memory corruption");
         }
 
+        {
+            std::lock_guard<mutex_type> ln(names_mtx_);
+            names_.insert(key);
+        }
+
         // handle registered events
-        if (auto const [first, last] = on_event_data_.equal_range(key);
+        if (auto const [first, last] = s.on_event_data_.equal_range(key);
             first != last)
         {
             std::vector<hpx::id_type> lcos;
@@ -159,7 +166,7 @@ namespace hpx::agas::server {
                 ++iter;
             }
 
-            on_event_data_.erase(first, last);
+            s.on_event_data_.erase(first, last);
 
             // notify all LCOS which were registered with this name
             for (hpx::id_type const& id : lcos)
@@ -167,8 +174,8 @@ namespace hpx::agas::server {
                 // re-locate the entry in the GID table for each LCO anew, as we
                 // need to unlock the mutex protecting the table for each
                 // iteration below
-                auto gid_it = gids_.find(key);
-                if (gid_it == gids_.end())
+                auto gid_it = s.gids_.find(key);
+                if (gid_it == s.gids_.end())
                 {
                     l.unlock();
 
@@ -215,10 +222,11 @@ namespace hpx::agas::server {
             counter_data_.resolve_.time_, counter_data_.resolve_.enabled_);
         counter_data_.increment_resolve_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        stripe& s = get_stripe(key);
+        std::unique_lock<mutex_type> l(s.mtx_);
 
-        auto const it = gids_.find(key);
-        if (auto const end = gids_.end(); it == end)
+        auto const it = s.gids_.find(key);
+        if (auto const end = s.gids_.end(); it == end)
         {
             l.unlock();
 
@@ -250,10 +258,11 @@ namespace hpx::agas::server {
             counter_data_.unbind_.time_, counter_data_.unbind_.enabled_);
         counter_data_.increment_unbind_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        stripe& s = get_stripe(key);
+        std::unique_lock<mutex_type> l(s.mtx_);
 
-        auto const it = gids_.find(key);
-        if (auto const end = gids_.end(); it == end)
+        auto const it = s.gids_.find(key);
+        if (auto const end = s.gids_.end(); it == end)
         {
             l.unlock();
 
@@ -266,7 +275,12 @@ namespace hpx::agas::server {
 
         naming::gid_type gid = *(it->second);
 
-        gids_.erase(it);
+        s.gids_.erase(it);
+
+        {
+            std::lock_guard<mutex_type> ln(names_mtx_);
+            names_.erase(key);
+        }
 
         l.unlock();
 
@@ -287,39 +301,66 @@ namespace hpx::agas::server {
 
         std::map<std::string, naming::gid_type> found;
 
-        if (pattern.find_first_of("*?[]") != std::string::npos)
-        {
-            std::string const str_rx(util::regex_from_pattern(pattern, throws));
-            std::regex const rx(str_rx);
+        // resolve the given name, if it is still bound
+        auto const resolve_name = [&](std::string const& name) {
+            stripe& s = get_stripe(name);
+            std::unique_lock<mutex_type> l(s.mtx_);
 
-            std::unique_lock<mutex_type> l(mutex_);
-            for (auto& gid : gids_)
-            {
-                if (!std::regex_match(gid.first, rx))
-                    continue;
+            auto const it = s.gids_.find(name);
+            if (it == s.gids_.end())
+                return;
+
+            // hold on to entry while map is unlocked
+            std::shared_ptr<naming::gid_type> const current_gid(it->second);
+            l.unlock();
 
-                // hold on to entry while map is unlocked
-                std::shared_ptr<naming::gid_type> current_gid(gid.second);
-                unlock_guard<std::unique_lock<mutex_type>> ul(l);
+            found[name] = naming::detail::split_gid_if_needed(
+                hpx::launch::sync, *current_gid);
+        };
 
-                found[gid.first] = naming::detail::split_gid_if_needed(
-                    hpx::launch::sync, *current_gid);
-            }
+        if (pattern.find_first_of("*?[]") == std::string::npos &&
+            !pattern.empty())
+        {
+            // no wildcards, look up the name directly
+            resolve_name(pattern);
         }
         else
         {
-            std::unique_lock<mutex_type> l(mutex_);
-            for (auto& gid : gids_)
+            // only names starting with the literal prefix of the pattern can
+            // match
+            std::string const prefix =
+                pattern.substr(0, pattern.find_first_of("*?[\\"));
+
+            std::vector<std::string> names;
             {
-                if (!pattern.empty() && pattern != gid.first)
-                    continue;
+                std::lock_guard<mutex_type> l(names_mtx_);
+                for (auto it = names_.lower_bound(prefix);
+                     it != names_.end() &&
+                     it->compare(0, prefix.size(), prefix) == 0;
+                     ++it)
+                {
+                    names.push_back(*it);
+                }
+            }
 
-                // hold on to entry while map is unlocked
-                std::shared_ptr<naming::gid_type> current_gid(gid.second);
-                unlock_guard<std::unique_lock<mutex_type>> ul(l);
+            if (!pattern.empty())
+            {
+                std::string const str_rx(
+                    util::regex_from_pattern(pattern, throws));
+                std::regex const rx(str_rx);
 
-                found[gid.first] = naming::detail::split_gid_if_needed(
-                    hpx::launch::sync, *current_gid);
+                for (std::string const& name : names)
+                {
+                    if (std::regex_match(name, rx))
+                        resolve_name(name);
+                }
+            }
+            else
+            {
+                for (std::string const& name : names)
+                {
+                    resolve_name(name);
+                }
             }
         }
 
@@ -335,13 +376,14 @@ namespace hpx::agas::server {
             counter_data_.on_event_.time_, counter_data_.on_event_.enabled_);
         counter_data_.increment_on_event_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        stripe& s = get_stripe(name);
+        std::unique_lock<mutex_type> l(s.mtx_);
 
         bool handled = false;
 
         if (call_for_past_events)
         {
-            if (auto const it = gids_.find(name); it != gids_.end())
+            if (auto const it = s.gids_.find(name); it != s.gids_.end())
             {
                 // split the credit as the receiving end will expect to keep the
                 // object alive
@@ -371,11 +413,12 @@ namespace hpx::agas::server {
 
         if (!handled)
         {
-            [[maybe_unused]] auto const it = on_event_data_.emplace(name, lco);
+            [[maybe_unused]] auto const it =
+                s.on_event_data_.emplace(name, lco);
 
             // This overload of insert always returns the iterator pointing
             // to the inserted value. It should never point to end
-            HPX_ASSERT_LOCKED(l, it != on_event_data_.end());
+            HPX_ASSERT_LOCKED(l, it != s.on_event_data_.end());
         }
 
         l.unlock();
@@ -17,6 +17,7 @@
 #include <hpx/actions/register_action.hpp>
 #include <hpx/actions/transfer_base_action.hpp>
 #include <hpx/actions_base/actions_base_support.hpp>
+#include <hpx/actions_base/detail/direct_execution_statistics.hpp>
 #include <hpx/async_distributed/continuation.hpp>
 #include <hpx/async_distributed/traits/action_trigger_continuation.hpp>
 
@@ -190,6 +191,22 @@ namespace hpx::actions {
                 target_gid, hpx::id_type::management_type::managed);
         }
 
+        // execute cheap, non-suspending actions directly instead of
+        // scheduling a new thread
+        if (this->select_direct_execution())
+        {
+            {
+                actions::detail::direct_execution_timer timer(
+                    base_type::derived_type::get_direct_execution_statistics());
+                hpx::detail::call_sync<typename base_type::derived_type>(
+                    HPX_MOVE(cont_), lva, comptype,
+                    HPX_MOVE(hpx::get<Is>(this->arguments_))...);
+            }
+            base_type::derived_type::get_direct_execution_statistics()
+                .increment_direct_invocation_count();
+            return;
+        }
+
         threads::thread_init_data data;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
@@ -257,7 +274,8 @@ namespace hpx::actions {
         {
             // If this is a direct action and deferred schedule was requested,
             // i.e. if we are not the last parcel, return immediately
-            if (base_type::direct_execution::value)
+            if (base_type::direct_execution::value ||
+                this->select_direct_execution())
             {
                 return;
             }
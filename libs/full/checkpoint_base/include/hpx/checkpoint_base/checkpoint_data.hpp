@@ -35,7 +35,11 @@ namespace hpx::util {
     ///                      checkpoint.
     ///
     /// Save_checkpoint_data takes any number of objects which a user may wish
-    /// to store in the given container.
+    /// to store in the given container. If the container is a
+    /// \a hpx::serialization::segmented_output_buffer, the data is handed to
+    /// the buffer's sink in fixed size segments, which bounds the memory
+    /// needed for writing large checkpoints (the last segment is handed over
+    /// by calling the buffer's flush function).
     template <typename Container, typename... Ts>
     void save_checkpoint_data(Container& data, Ts&&... ts)
     {
@@ -94,7 +98,9 @@ namespace hpx::util {
     /// restore_checkpoint_data takes any number of objects which a user may
     /// wish to restore from the given container. The sequence of objects has to
     /// correspond to the sequence of objects for the corresponding call to
-    /// save_checkpoint_data that had used the given container instance.
+    /// save_checkpoint_data that had used the given container instance. A
+    /// \a hpx::serialization::segmented_input_buffer can be used to read the
+    /// data in fixed size segments.
     template <typename Container, typename... Ts>
     void restore_checkpoint_data(Container const& cont, Ts&... ts)
     {
@@ -11,10 +11,57 @@
 #include <hpx/modules/serialization.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <string>
 #include <vector>
 
+// checkpoint data written and read in fixed size segments
+void test_segmented_checkpoint_data()
+{
+    std::string const str = "I am a string of characters";
+    std::vector<double> const vec(100000, 42.0);
+
+    constexpr std::size_t segment_size = 4096;
+
+    std::vector<char> stream;
+    std::size_t max_segment_size = 0;
+    {
+        hpx::serialization::segmented_output_buffer buffer(
+            [&](char const* data, std::size_t size) {
+                max_segment_size = (std::max) (max_segment_size, size);
+                stream.insert(stream.end(), data, data + size);
+            },
+            segment_size);
+
+        hpx::util::save_checkpoint_data(buffer, str, vec);
+        buffer.flush();
+    }
+
+    HPX_TEST(max_segment_size <= segment_size);
+    HPX_TEST_EQ(stream.size(), hpx::util::prepare_checkpoint_data(str, vec));
+
+    std::string str2;
+    std::vector<double> vec2;
+    {
+        std::size_t pos = 0;
+        hpx::serialization::segmented_input_buffer buffer(
+            [&](char* data, std::size_t size) {
+                std::size_t const n = (std::min) (size, stream.size() - pos);
+                std::memcpy(data, stream.data() + pos, n);
+                pos += n;
+                return n;
+            },
+            segment_size);
+
+        hpx::util::restore_checkpoint_data(buffer, str2, vec2);
+    }
+
+    HPX_TEST_EQ(str, str2);
+    HPX_TEST(vec == vec2);
+}
+
 int main()
 {
     char character = 'd';
@@ -49,5 +96,7 @@ int main()
     HPX_TEST_EQ(str, str2);
     HPX_TEST(vec == vec2);
 
+    test_segmented_checkpoint_data();
+
     return hpx::util::report_errors();
 }
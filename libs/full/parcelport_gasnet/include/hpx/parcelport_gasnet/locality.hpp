@@ -14,6 +14,7 @@
 #include <hpx/modules/gasnet_base.hpp>
 #include <hpx/modules/serialization.hpp>
 
+#include <cstddef>
 #include <cstdint>
 
 namespace hpx::parcelset::policies::gasnet {
@@ -46,6 +47,11 @@ namespace hpx::parcelset::policies::gasnet {
             return rank_ != ((unsigned int) -1);
         }
 
+        constexpr std::size_t hash() const noexcept
+        {
+            return static_cast<std::size_t>(rank_);
+        }
+
         HPX_EXPORT void save(serialization::output_archive& ar) const;
         HPX_EXPORT void load(serialization::input_archive& ar);
 
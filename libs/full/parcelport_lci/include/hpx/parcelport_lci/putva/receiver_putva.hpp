@@ -74,8 +74,7 @@ namespace hpx::parcelset::policies::lci {
                     consumed += decode_eager(
                         (char*) request.data.mbuffer.address + consumed,
                         buffer);
-                    handle_received_parcels(
-                        decode_parcels(*pp_, HPX_MOVE(buffer)));
+                    handle_buffer(HPX_MOVE(buffer));
                 }
                 HPX_ASSERT(consumed == request.data.mbuffer.length);
             }
@@ -85,8 +84,51 @@ namespace hpx::parcelset::policies::lci {
                 HPX_ASSERT(request.type == LCI_IOVEC);
                 buffer_type buffer;
                 decode_iovec(request.data.iovec, buffer);
+                handle_buffer(HPX_MOVE(buffer));
+            }
+        }
+
+        void handle_buffer(buffer_type&& buffer)
+        {
+            if (pp_->get_decode_pool() == nullptr)
+            {
                 handle_received_parcels(decode_parcels(*pp_, HPX_MOVE(buffer)));
+                return;
+            }
+
+            // The buffer refers to the memory of the LCI request, which is not
+            // guaranteed to outlive its processing. The message has to be
+            // copied for being de-serialized on the decode pool.
+            std::unique_ptr<char[]> data = copy_message(buffer);
+            decode_and_handle_parcels(*pp_, HPX_MOVE(buffer),
+                static_cast<std::size_t>(-1), HPX_MOVE(data));
+        }
+
+        // Copy the data and the zero-copy chunks of the message into a single
+        // allocation, the buffer is updated to refer to the copy.
+        static std::unique_ptr<char[]> copy_message(buffer_type& buffer)
+        {
+            std::size_t size = buffer.data_.length;
+            for (auto const& chunk : buffer.chunks_)
+            {
+                size += chunk.size();
+            }
+
+            std::unique_ptr<char[]> data(new char[size]);
+            char* p = data.get();
+
+            std::memcpy(p, buffer.data_.ptr, buffer.data_.length);
+            buffer.data_.ptr = p;
+            p += buffer.data_.length;
+
+            for (auto& chunk : buffer.chunks_)
+            {
+                std::size_t const chunk_size = chunk.size();
+                std::memcpy(p, chunk.data(), chunk_size);
+                chunk = serialization::create_pointer_chunk(p, chunk_size);
+                p += chunk_size;
             }
+            return data;
         }
 
         size_t decode_eager(void* address, buffer_type& buffer)
@@ -377,7 +377,8 @@ namespace hpx::parcelset::policies::lci {
             // decode and handle received data
             HPX_ASSERT(buffer.num_chunks_.first == 0 ||
                 !pp_->allow_zero_copy_receive_optimizations());
-            handle_received_parcels(decode_parcels(*pp_, HPX_MOVE(buffer)));
+            decode_and_handle_parcels(*pp_, HPX_MOVE(buffer),
+                static_cast<std::size_t>(-1), HPX_MOVE(chunk_buffers_));
             chunk_buffers_.clear();
         }
         else
@@ -12,6 +12,7 @@
 #if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_MPI)
 #include <hpx/modules/serialization.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <iosfwd>
 
@@ -45,6 +46,11 @@ namespace hpx::parcelset::policies::mpi {
             return rank_ != -1;
         }
 
+        [[nodiscard]] constexpr std::size_t hash() const noexcept
+        {
+            return static_cast<std::size_t>(rank_);
+        }
+
         HPX_EXPORT void save(serialization::output_archive& ar) const;
         HPX_EXPORT void load(serialization::input_archive& ar);
 
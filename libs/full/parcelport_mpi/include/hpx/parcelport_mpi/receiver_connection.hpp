@@ -448,9 +448,8 @@ namespace hpx::parcelset::policies::mpi {
                 // decode and handle received data
                 HPX_ASSERT(buffer_.num_chunks_.first == 0 ||
                     !pp_.allow_zero_copy_receive_optimizations());
-                handle_received_parcels(
-                    decode_parcels(pp_, HPX_MOVE(buffer_), num_thread),
-                    num_thread);
+                decode_and_handle_parcels(pp_, HPX_MOVE(buffer_), num_thread,
+                    HPX_MOVE(chunk_buffers_));
                 chunk_buffers_.clear();
             }
             else
@@ -0,0 +1,415 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // All structures placed into shared memory are aligned to (and padded
+    // up to) this size to avoid false sharing between the processes.
+    inline constexpr std::size_t shared_cache_line_size = 64;
+
+    constexpr std::size_t align_up(
+        std::size_t size, std::size_t alignment) noexcept
+    {
+        return (size + alignment - 1) & ~(alignment - 1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    enum class frame_kind : std::uint32_t
+    {
+        // fills the end of the ring buffer if the next frame does not fit
+        padding = 0,
+
+        // the message is stored in the frame itself
+        message = 1,
+
+        // the message is stored in a separate shared memory segment
+        segment = 2
+    };
+
+    // Each message written to a channel is preceded by a frame header.
+    struct frame_header
+    {
+        // overall size of the frame including this header
+        std::uint64_t frame_size;
+        frame_kind kind;
+
+        // number of zero-copy and non-zero-copy chunks of the message
+        std::uint32_t num_zero_copy_chunks;
+        std::uint32_t num_non_zero_copy_chunks;
+        std::uint32_t reserved;
+
+        // overall size of the serialized data and size of the arguments
+        std::uint64_t size;
+        std::uint64_t data_size;
+
+        // identifies the shared memory segment holding the message, if any
+        std::uint64_t segment_id;
+        std::uint64_t segment_size;
+    };
+
+    static_assert(sizeof(frame_header) % alignof(std::uint64_t) == 0);
+
+    // Messages without zero-copy chunks are written into the channel itself
+    // if their frame does not exceed the given threshold, all other messages
+    // are stored in a separate shared memory segment.
+    constexpr bool is_inline_message(std::size_t num_zero_copy_chunks,
+        std::size_t size, std::size_t inline_threshold) noexcept
+    {
+        return num_zero_copy_chunks == 0 &&
+            align_up(sizeof(frame_header) + size, alignof(frame_header)) <=
+            inline_threshold;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    enum class channel_state : std::uint32_t
+    {
+        free = 0,
+        claimed = 1,
+        open = 2,
+        closed = 3
+    };
+
+    // The control block of a channel. Head and tail are monotonically
+    // increasing byte offsets, head is modified by the sender only, tail by
+    // the receiver only.
+    struct alignas(shared_cache_line_size) channel_header
+    {
+        std::atomic<channel_state> state;
+        std::uint32_t sender_pid;
+
+        alignas(shared_cache_line_size) std::atomic<std::uint64_t> head;
+        alignas(shared_cache_line_size) std::atomic<std::uint64_t> tail;
+    };
+
+    static_assert(std::atomic<channel_state>::is_always_lock_free);
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A channel is a single-producer/single-consumer ring buffer placed in
+    /// shared memory. Messages are written into contiguous frames, a frame
+    /// that does not fit at the end of the buffer is placed at its beginning
+    /// instead.
+    class channel
+    {
+    public:
+        channel() = default;
+
+        channel(channel_header* header, char* data, std::size_t size) noexcept
+          : header_(header)
+          , data_(data)
+          , size_(size)
+        {
+            HPX_ASSERT(size_ % alignof(frame_header) == 0);
+        }
+
+        channel_header* header() const noexcept
+        {
+            return header_;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return header_ != nullptr;
+        }
+
+        // Return the overall frame size needed for a message of given size
+        static constexpr std::size_t frame_size(
+            std::size_t payload_size) noexcept
+        {
+            return align_up(
+                sizeof(frame_header) + payload_size, alignof(frame_header));
+        }
+
+        // Return the size of the largest message that can be written to the
+        // channel.
+        std::size_t max_frame_size() const noexcept
+        {
+            return size_;
+        }
+
+        /// Write a new frame to the channel (sender only). The function \a f
+        /// is invoked with the address the payload has to be copied to.
+        /// Returns false if there is not enough space available.
+        template <typename F>
+        bool try_write(
+            frame_header header, std::size_t payload_size, F&& f) noexcept
+        {
+            std::size_t const size = frame_size(payload_size);
+            HPX_ASSERT(size <= size_);
+
+            std::uint64_t const head =
+                header_->head.load(std::memory_order_relaxed);
+            std::uint64_t const tail =
+                header_->tail.load(std::memory_order_acquire);
+
+            // skip the end of the buffer if the frame does not fit
+            std::size_t const pos = head % size_;
+            std::size_t const skip = size_ - pos < size ? size_ - pos : 0;
+            if (skip + size > size_ - (head - tail))
+            {
+                return false;
+            }
+
+            if (skip >= sizeof(frame_header))
+            {
+                frame_header padding{};
+                padding.frame_size = skip;
+                padding.kind = frame_kind::padding;
+                std::memcpy(data_ + pos, &padding, sizeof(frame_header));
+            }
+
+            char* frame = data_ + (head + skip) % size_;
+
+            header.frame_size = size;
+            std::memcpy(frame, &header, sizeof(frame_header));
+            f(frame + sizeof(frame_header));
+
+            header_->head.store(head + skip + size, std::memory_order_release);
+            return true;
+        }
+
+        /// Invoke the function \a f for all frames available in the channel
+        /// (receiver only). The space occupied by a frame is released after
+        /// \a f has returned. Returns the number of messages handled.
+        template <typename F>
+        std::size_t consume(F&& f)
+        {
+            std::uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+            std::uint64_t const head =
+                header_->head.load(std::memory_order_acquire);
+
+            std::size_t num_messages = 0;
+            while (tail != head)
+            {
+                std::size_t const pos = tail % size_;
+                if (size_ - pos < sizeof(frame_header))
+                {
+                    tail += size_ - pos;
+                    continue;
+                }
+
+                frame_header header;
+                std::memcpy(&header, data_ + pos, sizeof(frame_header));
+
+                if (header.kind != frame_kind::padding)
+                {
+                    f(header, data_ + pos + sizeof(frame_header));
+                    ++num_messages;
+                }
+
+                tail += header.frame_size;
+                header_->tail.store(tail, std::memory_order_release);
+            }
+
+            header_->tail.store(tail, std::memory_order_release);
+            return num_messages;
+        }
+
+        // Return whether there are no unread frames (receiver only).
+        bool empty() const noexcept
+        {
+            return header_->tail.load(std::memory_order_relaxed) ==
+                header_->head.load(std::memory_order_acquire);
+        }
+
+        // Release the channel (sender only). The receiver makes it available
+        // again once all of its frames have been consumed.
+        void close() noexcept
+        {
+            header_->state.store(
+                channel_state::closed, std::memory_order_release);
+        }
+
+        /// Make the channel available to other senders if it was closed by
+        /// its sender and all of its frames have been consumed (receiver
+        /// only). Returns whether the channel has been made available.
+        bool try_reclaim() noexcept
+        {
+            if (header_->state.load(std::memory_order_acquire) !=
+                    channel_state::closed ||
+                !empty())
+            {
+                return false;
+            }
+
+            header_->head.store(0, std::memory_order_relaxed);
+            header_->tail.store(0, std::memory_order_relaxed);
+            header_->state.store(
+                channel_state::free, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        channel_header* header_ = nullptr;
+        char* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The header of a mailbox, followed by the channels.
+    struct alignas(shared_cache_line_size) mailbox_header
+    {
+        static constexpr std::uint64_t magic_value = 0x6870782e73686d6dULL;
+        static constexpr std::uint32_t current_version = 1;
+
+        // set last while initializing the mailbox
+        std::atomic<std::uint64_t> magic;
+        std::uint32_t version;
+        std::uint32_t num_channels;
+        std::uint64_t channel_size;
+    };
+
+    /// A mailbox is the shared memory segment through which a locality
+    /// receives messages. It holds a fixed number of channels, each of which
+    /// is used by at most one sending connection at a time.
+    class mailbox
+    {
+    public:
+        static constexpr std::size_t channel_stride(
+            std::size_t channel_size) noexcept
+        {
+            return sizeof(channel_header) + channel_size;
+        }
+
+        static constexpr std::size_t segment_size(
+            std::size_t num_channels, std::size_t channel_size) noexcept
+        {
+            return sizeof(mailbox_header) +
+                num_channels * channel_stride(channel_size);
+        }
+
+        mailbox() = default;
+
+        /// Create a new mailbox of the given name (receiver only). The size of
+        /// the channels is rounded up to a multiple of the cache line size.
+        static mailbox create(std::string const& name,
+            std::size_t num_channels, std::size_t channel_size)
+        {
+            channel_size = align_up(channel_size, shared_cache_line_size);
+
+            mailbox result;
+            result.segment_ = shared_memory_segment::create(
+                name, segment_size(num_channels, channel_size));
+
+            // a newly created shared memory segment is zero-initialized, all
+            // channels are free
+            auto* header = new (result.segment_.data()) mailbox_header;
+            header->version = mailbox_header::current_version;
+            header->num_channels = static_cast<std::uint32_t>(num_channels);
+            header->channel_size = channel_size;
+            header->magic.store(
+                mailbox_header::magic_value, std::memory_order_release);
+
+            return result;
+        }
+
+        /// Open the existing mailbox of the given name (sender only).
+        static mailbox open(std::string const& name, error_code& ec = throws)
+        {
+            mailbox result;
+            result.segment_ = shared_memory_segment::open(name, ec);
+            if (ec)
+            {
+                return result;
+            }
+
+            mailbox_header const* header = result.header();
+            if (result.segment_.size() < sizeof(mailbox_header) ||
+                header->magic.load(std::memory_order_acquire) !=
+                    mailbox_header::magic_value ||
+                header->version != mailbox_header::current_version ||
+                result.segment_.size() <
+                    segment_size(header->num_channels, header->channel_size))
+            {
+                HPX_THROWS_IF(ec, hpx::error::network_error, "mailbox::open",
+                    "the shared memory segment {} does not hold a valid "
+                    "mailbox",
+                    name);
+                return mailbox();
+            }
+            return result;
+        }
+
+        std::size_t num_channels() const noexcept
+        {
+            return header()->num_channels;
+        }
+
+        std::size_t channel_size() const noexcept
+        {
+            return static_cast<std::size_t>(header()->channel_size);
+        }
+
+        /// Claim a free channel for the sending process \a pid (sender
+        /// only). Returns an empty channel if all channels are in use.
+        channel claim_channel(std::uint32_t pid) const noexcept
+        {
+            for (std::size_t i = 0; i != num_channels(); ++i)
+            {
+                channel ch = get_channel(i);
+                channel_header* header = ch.header();
+
+                channel_state expected = channel_state::free;
+                if (header->state.compare_exchange_strong(expected,
+                        channel_state::claimed, std::memory_order_acquire))
+                {
+                    header->sender_pid = pid;
+                    header->state.store(
+                        channel_state::open, std::memory_order_release);
+                    return ch;
+                }
+            }
+            return {};
+        }
+
+        channel get_channel(std::size_t i) const noexcept
+        {
+            HPX_ASSERT(i < num_channels());
+
+            char* base = static_cast<char*>(segment_.data()) +
+                sizeof(mailbox_header) + i * channel_stride(channel_size());
+            return channel(reinterpret_cast<channel_header*>(base),
+                base + sizeof(channel_header), channel_size());
+        }
+
+        // Remove the name of the mailbox (receiver only).
+        void unlink() noexcept
+        {
+            segment_.unlink();
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return static_cast<bool>(segment_);
+        }
+
+    private:
+        mailbox_header* header() const noexcept
+        {
+            return static_cast<mailbox_header*>(segment_.data());
+        }
+
+        shared_memory_segment segment_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
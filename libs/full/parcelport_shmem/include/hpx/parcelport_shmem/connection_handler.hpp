@@ -0,0 +1,150 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_shmem/channel.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::shmem {
+
+        template <typename Parcelport>
+        class receiver;
+
+        class HPX_EXPORT connection_handler;
+    }    // namespace policies::shmem
+
+    template <>
+    struct connection_handler_traits<policies::shmem::connection_handler>
+    {
+        using connection_type = policies::shmem::sender;
+        using send_early_parcel = std::false_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::false_type;
+        using is_connectionless = std::false_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies::shmem {
+
+        // Return the locality of this process as seen by the shared memory
+        // parcelport.
+        parcelset::locality parcelport_address();
+
+        /// The shared memory parcelport connects localities running on the
+        /// same host. Each locality creates a mailbox (a shared memory
+        /// segment holding a fixed number of ring buffers), connections to
+        /// other localities claim one of the ring buffers of the mailbox of
+        /// the destination.
+        class HPX_EXPORT connection_handler
+          : public parcelport_impl<connection_handler>
+        {
+            using base_type = parcelport_impl<connection_handler>;
+
+        public:
+            static std::vector<std::string> runtime_configuration()
+            {
+                std::vector<std::string> lines;
+                return lines;
+            }
+
+            connection_handler(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier);
+
+            ~connection_handler();
+
+            // Start the handling of connections.
+            bool do_run();
+
+            // Stop the handling of connections.
+            void do_stop();
+
+            // Return the name of this locality
+            std::string get_locality_name() const override;
+
+            std::shared_ptr<sender> create_connection(
+                parcelset::locality const& l, error_code& ec);
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const& ini) const override;
+
+            parcelset::locality create_locality() const override;
+
+            // Only localities on the same host can be reached, and only after
+            // bootstrapping has finished.
+            bool can_connect(parcelset::locality const& l,
+                bool use_alternative_parcelport) override;
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode);
+
+            // Queue a connection whose message could not be written
+            // immediately as the destination channel was full.
+            void add_pending(std::shared_ptr<sender> const& connection);
+
+        private:
+            std::shared_ptr<mailbox> get_mailbox(
+                std::string const& name, error_code& ec);
+
+            bool send_pending();
+
+            std::size_t num_channels_;
+            std::size_t channel_size_;
+            std::size_t inline_threshold_;
+
+            // the receiver is created only once the parcelport is started
+            std::unique_ptr<receiver<connection_handler>> receiver_;
+            std::atomic<bool> running_;
+
+            // the mailboxes of the destinations connected to
+            hpx::spinlock mailboxes_mtx_;
+            std::map<std::string, std::shared_ptr<mailbox>> mailboxes_;
+
+            // the connections waiting for space in their channel
+            hpx::spinlock pending_mtx_;
+            std::deque<std::shared_ptr<sender>> pending_;
+        };
+    }    // namespace policies::shmem
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,89 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/serialization.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    /// A shared memory locality is identified by the host it runs on and by
+    /// the name of the shared memory mailbox the locality receives its
+    /// messages through.
+    class locality
+    {
+    public:
+        locality() = default;
+
+        locality(std::string host, std::string mailbox)
+          : host_(HPX_MOVE(host))
+          , mailbox_(HPX_MOVE(mailbox))
+        {
+        }
+
+        // Identification of the host (and its current boot) the locality is
+        // running on
+        std::string const& host() const noexcept
+        {
+            return host_;
+        }
+
+        // Name of the shared memory mailbox of the locality
+        std::string const& mailbox() const noexcept
+        {
+            return mailbox_;
+        }
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return !mailbox_.empty();
+        }
+
+        // the mailbox name is unique on a host
+        std::size_t hash() const noexcept
+        {
+            return std::hash<std::string>()(mailbox_);
+        }
+
+        HPX_EXPORT void save(serialization::output_archive& ar) const;
+        HPX_EXPORT void load(serialization::input_archive& ar);
+
+    private:
+        friend bool operator==(
+            locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.mailbox_ == rhs.mailbox_ && lhs.host_ == rhs.host_;
+        }
+
+        friend bool operator<(locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.host_ < rhs.host_ ||
+                (lhs.host_ == rhs.host_ && lhs.mailbox_ < rhs.mailbox_);
+        }
+
+        friend HPX_EXPORT std::ostream& operator<<(
+            std::ostream& os, locality const& loc) noexcept;
+
+        std::string host_;
+        std::string mailbox_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,305 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <hpx/parcelport_shmem/channel.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+#include <hpx/parcelset_base/detail/data_point.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    /// The receiver polls all channels of the mailbox of this locality and
+    /// de-serializes the received messages directly from shared memory. If a
+    /// decode pool is configured, the messages are copied out of the channels
+    /// and de-serialized on that pool instead.
+    template <typename Parcelport>
+    class receiver
+    {
+        using parcel_buffer_type = parcel_buffer<std::vector<char>,
+            serialization::serialization_chunk>;
+        using transmission_chunk_type =
+            parcel_buffer_type::transmission_chunk_type;
+        using count_chunks_type = parcel_buffer_type::count_chunks_type;
+
+        // Refers to a message stored in shared memory, allows to
+        // de-serialize the message without copying it.
+        struct message_view
+        {
+            [[nodiscard]] constexpr char const& operator[](
+                std::size_t i) const noexcept
+            {
+                return data_[i];
+            }
+
+            [[nodiscard]] constexpr std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            char const* data_;
+            std::size_t size_;
+        };
+
+    public:
+        receiver(Parcelport& pp, mailbox&& mb)
+          : pp_(pp)
+          , mailbox_(HPX_MOVE(mb))
+          , channel_mtxs_(new hpx::spinlock[mailbox_.num_channels()])
+          , next_channel_(0)
+        {
+        }
+
+        receiver(receiver const&) = delete;
+        receiver(receiver&&) = delete;
+        receiver& operator=(receiver const&) = delete;
+        receiver& operator=(receiver&&) = delete;
+
+        ~receiver()
+        {
+            mailbox_.unlink();
+
+            // The frames still stored in the channels are never consumed,
+            // remove the segments referred to by them.
+            for (std::size_t i = 0; i != mailbox_.num_channels(); ++i)
+            {
+                channel ch = mailbox_.get_channel(i);
+                channel_header const* header = ch.header();
+                if (header->state.load(std::memory_order_acquire) ==
+                    channel_state::free)
+                {
+                    continue;
+                }
+
+                std::uint32_t const sender_pid = header->sender_pid;
+                ch.consume([&](frame_header const& frame, char const*) {
+                    if (frame.kind == frame_kind::segment)
+                    {
+                        shared_memory_segment::remove(
+                            segment_name(sender_pid, frame.segment_id));
+                    }
+                });
+            }
+        }
+
+        // Handle all messages that are available in any of the channels.
+        // Each channel is handled by at most one thread at a time, channels
+        // currently handled by other threads are skipped.
+        bool background_work(std::size_t num_thread)
+        {
+            std::size_t const num_channels = mailbox_.num_channels();
+
+            // let concurrent threads start with different channels
+            std::size_t const first =
+                next_channel_.fetch_add(1, std::memory_order_relaxed);
+
+            bool has_work = false;
+            for (std::size_t i = 0; i != num_channels; ++i)
+            {
+                std::size_t const idx = (first + i) % num_channels;
+
+                channel_header const* header =
+                    mailbox_.get_channel(idx).header();
+                if (header->state.load(std::memory_order_relaxed) ==
+                    channel_state::free)
+                {
+                    continue;
+                }
+
+                std::unique_lock l(channel_mtxs_[idx], std::try_to_lock);
+                if (l)
+                {
+                    has_work = handle_channel(idx, num_thread) || has_work;
+                }
+            }
+            return has_work;
+        }
+
+    private:
+        bool handle_channel(std::size_t idx, std::size_t num_thread)
+        {
+            channel ch = mailbox_.get_channel(idx);
+            channel_header* header = ch.header();
+
+            channel_state const state =
+                header->state.load(std::memory_order_acquire);
+            if (state == channel_state::claimed)
+            {
+                // the sender has not finished setting up the channel
+                return false;
+            }
+
+            std::uint32_t const sender_pid = header->sender_pid;
+            std::size_t const num_messages = ch.consume(
+                [&](frame_header const& frame, char const* payload) {
+                    handle_frame(frame, payload, sender_pid, num_thread);
+                });
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            if (num_messages != 0)
+            {
+                pp_.add_receive_operation();
+            }
+#endif
+
+            // make the channel available again once the sender has released
+            // it and all of its messages have been handled
+            if (state == channel_state::closed)
+            {
+                ch.try_reclaim();
+            }
+
+            return num_messages != 0;
+        }
+
+        void handle_frame(frame_header const& frame, char const* payload,
+            std::uint32_t sender_pid, std::size_t num_thread)
+        {
+            parcel_buffer_type buffer;
+            buffer.size_ = frame.size;
+            buffer.data_size_ = frame.data_size;
+            buffer.num_chunks_ = count_chunks_type(
+                frame.num_zero_copy_chunks, frame.num_non_zero_copy_chunks);
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer.data_point_.bytes_ = static_cast<std::size_t>(frame.size);
+#endif
+
+            if (frame.kind == frame_kind::message)
+            {
+                if (pp_.get_decode_pool() != nullptr)
+                {
+                    // the channel is reused once the frame was consumed, the
+                    // message has to be copied for being de-serialized on the
+                    // decode pool
+                    buffer.data_.assign(payload, payload + frame.size);
+                    decode_and_handle_parcels(
+                        pp_, HPX_MOVE(buffer), num_thread);
+                    return;
+                }
+
+                message_view const data{
+                    payload, static_cast<std::size_t>(frame.size)};
+                serialization::input_archive archive(
+                    data, static_cast<std::size_t>(frame.data_size));
+
+                handle_received_parcels(
+                    decode_message_with_chunks(
+                        archive, pp_, buffer, 0, num_thread),
+                    num_thread);
+                return;
+            }
+
+            HPX_ASSERT(frame.kind == frame_kind::segment);
+
+            // the segment is not needed anymore once it has been mapped
+            std::string const name =
+                segment_name(sender_pid, frame.segment_id);
+
+            error_code ec(throwmode::lightweight);
+            shared_memory_segment segment =
+                shared_memory_segment::open(name, ec);
+            if (ec)
+            {
+                // skip the frame, the message is lost
+                LPT_(error).format(
+                    "shmem::receiver: dropping message: {}", ec.get_message());
+                return;
+            }
+            segment.unlink();
+
+            if (segment.size() != frame.segment_size)
+            {
+                LPT_(error).format(
+                    "shmem::receiver: dropping message: the shared memory "
+                    "segment {} has {} bytes, expected {}",
+                    name, segment.size(), frame.segment_size);
+                return;
+            }
+
+            char const* data = static_cast<char const*>(segment.data());
+
+            std::size_t const num_zero_copy_chunks = frame.num_zero_copy_chunks;
+            if (num_zero_copy_chunks != 0)
+            {
+                auto& chunks = buffer.transmission_chunks_;
+                chunks.resize(
+                    num_zero_copy_chunks + frame.num_non_zero_copy_chunks);
+
+                std::size_t const chunks_size =
+                    chunks.size() * sizeof(transmission_chunk_type);
+                std::memcpy(
+                    static_cast<void*>(chunks.data()), data, chunks_size);
+                data += align_up(chunks_size, shared_cache_line_size);
+            }
+
+            message_view const message{
+                data, static_cast<std::size_t>(frame.size)};
+            data += align_up(
+                static_cast<std::size_t>(frame.size), shared_cache_line_size);
+
+            // the zero-copy chunks refer to the data in the segment
+            buffer.chunks_.reserve(num_zero_copy_chunks);
+            for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+            {
+                auto const size = static_cast<std::size_t>(
+                    buffer.transmission_chunks_[i].second);
+                buffer.chunks_.push_back(
+                    serialization::create_pointer_chunk(data, size));
+                data += align_up(size, shared_cache_line_size);
+            }
+
+            if (pp_.get_decode_pool() != nullptr)
+            {
+                // the zero-copy chunks keep referring to the segment, which
+                // stays mapped until the message was de-serialized
+                buffer.data_.assign(message.data_, message.data_ + frame.size);
+                decode_and_handle_parcels(
+                    pp_, HPX_MOVE(buffer), num_thread, HPX_MOVE(segment));
+                return;
+            }
+
+            std::vector<serialization::serialization_chunk> chunks(
+                decode_chunks(buffer));
+            serialization::input_archive archive(
+                message, static_cast<std::size_t>(frame.data_size), &chunks);
+
+            handle_received_parcels(
+                decode_message_with_chunks(archive, pp_, buffer, 0, num_thread),
+                num_thread);
+        }
+
+        Parcelport& pp_;
+        mailbox mailbox_;
+
+        std::unique_ptr<hpx::spinlock[]> channel_mtxs_;
+        std::atomic<std::size_t> next_channel_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,284 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_shmem/channel.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset_base/detail/data_point.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    class sender;
+
+    // Return the name of the shared memory segment holding a message that
+    // does not fit into a channel.
+    HPX_EXPORT std::string segment_name(
+        std::uint32_t sender_pid, std::uint64_t segment_id);
+
+    // Return a new (process-wide) unique id for a message segment.
+    HPX_EXPORT std::uint64_t next_segment_id() noexcept;
+
+    // Queue a connection whose message could not be written immediately.
+    HPX_EXPORT void add_pending(
+        parcelset::parcelport* pp, std::shared_ptr<sender> const& ptr);
+
+    class sender
+      : public parcelset::parcelport_connection<sender, std::vector<char>>
+    {
+    public:
+        using handler_type = hpx::move_only_function<void(error_code const&)>;
+        using post_handler_type = hpx::move_only_function<void(
+            error_code const&, parcelset::locality const&,
+            std::shared_ptr<sender>)>;
+
+        // Construct a sending connection which writes to the given channel of
+        // the mailbox of the destination locality. The channel has been
+        // claimed already.
+        sender(parcelset::locality const& there,
+            std::shared_ptr<mailbox> destination, channel ch,
+            std::uint32_t pid, std::size_t inline_threshold,
+            parcelset::parcelport* pp) noexcept
+          : there_(there)
+          , mailbox_(HPX_MOVE(destination))
+          , channel_(ch)
+          , pid_(pid)
+          , inline_threshold_(inline_threshold)
+          , frame_()
+          , payload_size_(0)
+          , pp_(pp)
+        {
+        }
+
+        sender(sender const&) = delete;
+        sender(sender&&) = delete;
+        sender& operator=(sender const&) = delete;
+        sender& operator=(sender&&) = delete;
+
+        ~sender()
+        {
+            // remove the segment of a message that was never written
+            if (segment_pending_)
+            {
+                shared_memory_segment::remove(
+                    segment_name(pid_, frame_.segment_id));
+            }
+
+            // release the channel, the receiver makes it available again
+            // once all of the messages have been consumed
+            channel_.close();
+        }
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        static constexpr void verify_(
+            parcelset::locality const& /* parcel_locality_id */) noexcept
+        {
+        }
+
+        void async_write(
+            handler_type&& handler, post_handler_type&& parcel_postprocess)
+        {
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+            HPX_ASSERT(!buffer_.data_.empty());
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+#endif
+            handler_ = HPX_MOVE(handler);
+            postprocess_handler_ = HPX_MOVE(parcel_postprocess);
+
+            error_code ec(throwmode::lightweight);
+            prepare(ec);
+            if (ec)
+            {
+                done(ec);
+                return;
+            }
+
+            if (!send())
+            {
+                // the channel is full, the message is written as soon as the
+                // receiver has made enough space available
+                add_pending(pp_, shared_from_this());
+            }
+        }
+
+        // Try to write the prepared frame into the channel, returns false if
+        // there is not enough space available.
+        bool send()
+        {
+            bool const written = channel_.try_write(
+                frame_, payload_size_, [this](char* data) {
+                    if (frame_.kind == frame_kind::message)
+                    {
+                        std::memcpy(
+                            data, buffer_.data_.data(), buffer_.data_.size());
+                    }
+                });
+
+            if (written)
+            {
+                // the receiver removes the segment (if any) from now on
+                segment_pending_ = false;
+                done(error_code(throwmode::lightweight));
+            }
+            return written;
+        }
+
+    private:
+        // Prepare the frame to write. Messages with zero-copy chunks and
+        // messages which are too large are placed into a separate shared
+        // memory segment, only a reference to that segment is written to the
+        // channel.
+        void prepare(error_code& ec)
+        {
+            frame_ = frame_header{};
+            frame_.num_zero_copy_chunks = buffer_.num_chunks_.first;
+            frame_.num_non_zero_copy_chunks = buffer_.num_chunks_.second;
+            frame_.size = buffer_.size_;
+            frame_.data_size = buffer_.data_size_;
+
+            if (is_inline_message(buffer_.num_chunks_.first,
+                    buffer_.data_.size(), inline_threshold_))
+            {
+                frame_.kind = frame_kind::message;
+                payload_size_ = buffer_.data_.size();
+                return;
+            }
+
+            frame_.kind = frame_kind::segment;
+            payload_size_ = 0;
+
+            // the segment holds the transmission chunks, the serialized data,
+            // and the zero-copy chunks, each of which is aligned
+            auto const& chunks = buffer_.transmission_chunks_;
+            std::size_t const chunks_size = align_up(chunks.size() *
+                    sizeof(parcel_buffer_type::transmission_chunk_type),
+                shared_cache_line_size);
+
+            std::size_t size = chunks_size +
+                align_up(buffer_.data_.size(), shared_cache_line_size);
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+                {
+                    size += align_up(c.size_, shared_cache_line_size);
+                }
+            }
+
+            frame_.segment_id = next_segment_id();
+            frame_.segment_size = size;
+
+            shared_memory_segment segment = shared_memory_segment::create(
+                segment_name(pid_, frame_.segment_id), size, ec);
+            if (ec)
+            {
+                return;
+            }
+            segment_pending_ = true;
+
+            char* data = static_cast<char*>(segment.data());
+            if (!chunks.empty())
+            {
+                std::memcpy(data, chunks.data(),
+                    chunks.size() *
+                        sizeof(parcel_buffer_type::transmission_chunk_type));
+            }
+            data += chunks_size;
+
+            std::memcpy(data, buffer_.data_.data(), buffer_.data_.size());
+            data += align_up(buffer_.data_.size(), shared_cache_line_size);
+
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+                {
+                    std::memcpy(data, c.data_.cpos_, c.size_);
+                    data += align_up(c.size_, shared_cache_line_size);
+                }
+            }
+
+            // the mapping is released, the receiver removes the segment after
+            // having opened it
+        }
+
+        void done(error_code const& ec)
+        {
+            handler_(ec);
+            handler_.reset();
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            if (!ec)
+            {
+                buffer_.data_point_.time_ =
+                    timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+                pp_->add_sent_data(buffer_.data_point_);
+            }
+#endif
+            buffer_.clear();
+
+            post_handler_type postprocess_handler;
+            std::swap(postprocess_handler, postprocess_handler_);
+            if (postprocess_handler)
+            {
+                postprocess_handler(ec, there_, shared_from_this());
+            }
+        }
+
+        parcelset::locality there_;
+
+        // keeps the mapping of the destination's mailbox alive
+        std::shared_ptr<mailbox> mailbox_;
+        channel channel_;
+
+        std::uint32_t pid_;
+        std::size_t inline_threshold_;
+
+        // the frame to write
+        frame_header frame_;
+        std::size_t payload_size_;
+
+        // the segment of the prepared frame has not been written yet
+        bool segment_pending_ = false;
+
+        handler_type handler_;
+        post_handler_type postprocess_handler_;
+
+        parcelset::parcelport* pp_;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+#endif
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,87 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+
+#include <cstddef>
+#include <string>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::policies::shmem {
+
+    /// A shared_memory_segment manages the mapping of a named POSIX shared
+    /// memory object into the address space of the current process. The
+    /// mapping is released on destruction, the name of the shared memory
+    /// object is removed only when explicitly requested (see \a unlink).
+    class HPX_EXPORT shared_memory_segment
+    {
+    public:
+        shared_memory_segment() = default;
+        ~shared_memory_segment();
+
+        shared_memory_segment(shared_memory_segment&& rhs) noexcept;
+        shared_memory_segment& operator=(shared_memory_segment&& rhs) noexcept;
+
+        shared_memory_segment(shared_memory_segment const&) = delete;
+        shared_memory_segment& operator=(
+            shared_memory_segment const&) = delete;
+
+        /// Create a new shared memory object of the given size and map it.
+        /// A stale object of the same name (left behind by a process that
+        /// has terminated abnormally) is replaced.
+        static shared_memory_segment create(
+            std::string const& name, std::size_t size, error_code& ec = throws);
+
+        /// Map an existing shared memory object in its entirety.
+        static shared_memory_segment open(
+            std::string const& name, error_code& ec = throws);
+
+        /// Remove the name of the shared memory object. Existing mappings
+        /// stay valid until they are released.
+        void unlink() noexcept;
+
+        /// Remove the name of the shared memory object of the given name
+        /// without mapping it.
+        static void remove(std::string const& name) noexcept;
+
+        void* data() const noexcept
+        {
+            return data_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        std::string const& name() const noexcept
+        {
+            return name_;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return data_ != nullptr;
+        }
+
+    private:
+        void release() noexcept;
+
+        std::string name_;
+        void* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,270 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/parcelport_shmem/channel.hpp>
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace {
+
+        std::string host_name()
+        {
+            char name[256] = {0};
+            if (::gethostname(name, sizeof(name) - 1) != 0)
+            {
+                return "localhost";
+            }
+            return name;
+        }
+
+        // Identify the host and its current boot. Localities that are
+        // started on different machines sharing the same host name (e.g.
+        // containers) are distinguished by the boot id.
+        std::string host_identity()
+        {
+            std::string boot_id;
+            std::ifstream in("/proc/sys/kernel/random/boot_id");
+            if (in)
+            {
+                std::getline(in, boot_id);
+            }
+            return host_name() + "/" + boot_id;
+        }
+
+        std::string mailbox_name(std::uint32_t pid)
+        {
+            return "/hpx.shmem." + std::to_string(pid);
+        }
+
+        std::uint32_t this_process_id() noexcept
+        {
+            return static_cast<std::uint32_t>(::getpid());
+        }
+    }    // namespace
+
+    std::string segment_name(std::uint32_t sender_pid, std::uint64_t segment_id)
+    {
+        return mailbox_name(sender_pid) + "." + std::to_string(segment_id);
+    }
+
+    std::uint64_t next_segment_id() noexcept
+    {
+        static std::atomic<std::uint64_t> segment_id(0);
+        return ++segment_id;
+    }
+
+    void add_pending(
+        parcelset::parcelport* pp, std::shared_ptr<sender> const& ptr)
+    {
+        static_cast<connection_handler*>(pp)->add_pending(ptr);
+    }
+
+    parcelset::locality parcelport_address()
+    {
+        return parcelset::locality(
+            locality(host_identity(), mailbox_name(this_process_id())));
+    }
+
+    connection_handler::connection_handler(
+        util::runtime_configuration const& ini,
+        threads::policies::callback_notifier const& notifier)
+      : base_type(ini, parcelport_address(), notifier)
+      , num_channels_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.shmem.channels", 64))
+      , channel_size_(align_up(hpx::util::get_entry_as<std::size_t>(ini,
+                                   "hpx.parcel.shmem.channel_size", 65536),
+            shared_cache_line_size))
+      , inline_threshold_(channel_size_ / 4)
+      , running_(false)
+    {
+        if (num_channels_ == 0)
+        {
+            num_channels_ = 1;
+        }
+    }
+
+    connection_handler::~connection_handler() = default;
+
+    bool connection_handler::do_run()
+    {
+        // the mailbox is created only if this parcelport is enabled
+        receiver_ = std::make_unique<receiver<connection_handler>>(*this,
+            mailbox::create(here().get<locality>().mailbox(), num_channels_,
+                channel_size_));
+        running_.store(true, std::memory_order_release);
+        return true;
+    }
+
+    void connection_handler::do_stop()
+    {
+        // write all messages still pending
+        while (send_pending())
+        {
+            if (threads::get_self_ptr())
+            {
+                hpx::this_thread::suspend(
+                    hpx::threads::thread_schedule_state::pending,
+                    "shmem::connection_handler::do_stop");
+            }
+        }
+
+        running_.store(false, std::memory_order_release);
+
+        std::lock_guard l(mailboxes_mtx_);
+        mailboxes_.clear();
+    }
+
+    std::string connection_handler::get_locality_name() const
+    {
+        return host_name();
+    }
+
+    std::shared_ptr<sender> connection_handler::create_connection(
+        parcelset::locality const& l, error_code& ec)
+    {
+        std::shared_ptr<mailbox> destination =
+            get_mailbox(l.get<locality>().mailbox(), ec);
+        if (!destination)
+        {
+            return nullptr;
+        }
+
+        // claim a free channel of the destination's mailbox
+        std::uint32_t const pid = this_process_id();
+        if (channel ch = destination->claim_channel(pid))
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return std::make_shared<sender>(
+                l, HPX_MOVE(destination), ch, pid, inline_threshold_, this);
+        }
+
+        HPX_THROWS_IF(ec, hpx::error::network_error,
+            "shmem::connection_handler::create_connection",
+            "no free channel available in the mailbox of {}, consider "
+            "increasing hpx.parcel.shmem.channels",
+            l);
+        return nullptr;
+    }
+
+    parcelset::locality connection_handler::agas_locality(
+        util::runtime_configuration const&) const
+    {
+        // this parcelport is never used for bootstrapping
+        return parcelset::locality(locality());
+    }
+
+    parcelset::locality connection_handler::create_locality() const
+    {
+        return parcelset::locality(locality());
+    }
+
+    bool connection_handler::can_connect(
+        parcelset::locality const& l, bool use_alternative_parcelport)
+    {
+        return use_alternative_parcelport &&
+            l.get<locality>().host() == here().get<locality>().host();
+    }
+
+    bool connection_handler::background_work(
+        std::size_t num_thread, parcelport_background_mode mode)
+    {
+        if (!running_.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        bool has_work = false;
+        if (mode & parcelport_background_mode::send)
+        {
+            has_work = send_pending();
+        }
+        if (mode & parcelport_background_mode::receive)
+        {
+            has_work = receiver_->background_work(num_thread) || has_work;
+        }
+        return has_work;
+    }
+
+    void connection_handler::add_pending(
+        std::shared_ptr<sender> const& connection)
+    {
+        std::lock_guard l(pending_mtx_);
+        pending_.push_back(connection);
+    }
+
+    std::shared_ptr<mailbox> connection_handler::get_mailbox(
+        std::string const& name, error_code& ec)
+    {
+        std::lock_guard l(mailboxes_mtx_);
+
+        auto it = mailboxes_.find(name);
+        if (it == mailboxes_.end())
+        {
+            mailbox mb = mailbox::open(name, ec);
+            if (!mb)
+            {
+                return nullptr;
+            }
+
+            it = mailboxes_
+                     .emplace(name, std::make_shared<mailbox>(HPX_MOVE(mb)))
+                     .first;
+        }
+        return it->second;
+    }
+
+    // Retry writing the message of the connection waiting the longest,
+    // returns whether there was a connection to handle.
+    bool connection_handler::send_pending()
+    {
+        std::shared_ptr<sender> connection;
+        {
+            std::unique_lock l(pending_mtx_, std::try_to_lock);
+            if (!l || pending_.empty())
+            {
+                return false;
+            }
+
+            connection = HPX_MOVE(pending_.front());
+            pending_.pop_front();
+        }
+
+        if (!connection->send())
+        {
+            add_pending(connection);
+        }
+        return true;
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,198 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace {
+
+        // map the whole shared memory object referred to by the given file
+        // descriptor, closes the descriptor
+        void* map_segment(int fd, std::size_t size) noexcept
+        {
+            void* data = ::mmap(
+                nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+            int const error = errno;
+            ::close(fd);
+            errno = error;
+
+            return data == MAP_FAILED ? nullptr : data;
+        }
+    }    // namespace
+
+    shared_memory_segment::~shared_memory_segment()
+    {
+        release();
+    }
+
+    shared_memory_segment::shared_memory_segment(
+        shared_memory_segment&& rhs) noexcept
+      : name_(HPX_MOVE(rhs.name_))
+      , data_(std::exchange(rhs.data_, nullptr))
+      , size_(std::exchange(rhs.size_, 0))
+    {
+    }
+
+    shared_memory_segment& shared_memory_segment::operator=(
+        shared_memory_segment&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            release();
+
+            name_ = HPX_MOVE(rhs.name_);
+            data_ = std::exchange(rhs.data_, nullptr);
+            size_ = std::exchange(rhs.size_, 0);
+        }
+        return *this;
+    }
+
+    shared_memory_segment shared_memory_segment::create(
+        std::string const& name, std::size_t size, error_code& ec)
+    {
+        shared_memory_segment segment;
+
+        int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd == -1 && errno == EEXIST)
+        {
+            // the name is still in use by a process that has terminated
+            // abnormally
+            ::shm_unlink(name.c_str());
+            fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        }
+
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::create",
+                "shm_open failed for {}: {}", name, std::strerror(errno));
+            return segment;
+        }
+
+        // make sure the memory is actually available, otherwise accessing it
+        // would raise SIGBUS later on
+        if (int const error =
+                ::posix_fallocate(fd, 0, static_cast<off_t>(size));
+            error != 0)
+        {
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::create",
+                "allocating {} bytes of shared memory for {} failed: {}", size,
+                name, std::strerror(error));
+            return segment;
+        }
+
+        segment.data_ = map_segment(fd, size);
+        if (segment.data_ == nullptr)
+        {
+            ::shm_unlink(name.c_str());
+
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::create", "mmap failed for {}: {}",
+                name, std::strerror(errno));
+            return segment;
+        }
+
+        segment.name_ = name;
+        segment.size_ = size;
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return segment;
+    }
+
+    shared_memory_segment shared_memory_segment::open(
+        std::string const& name, error_code& ec)
+    {
+        shared_memory_segment segment;
+
+        int const fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::open", "shm_open failed for {}: {}",
+                name, std::strerror(errno));
+            return segment;
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) == -1)
+        {
+            int const error = errno;
+            ::close(fd);
+
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::open", "fstat failed for {}: {}", name,
+                std::strerror(error));
+            return segment;
+        }
+
+        auto const size = static_cast<std::size_t>(st.st_size);
+        segment.data_ = map_segment(fd, size);
+        if (segment.data_ == nullptr)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::open", "mmap failed for {}: {}", name,
+                std::strerror(errno));
+            return segment;
+        }
+
+        segment.name_ = name;
+        segment.size_ = size;
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return segment;
+    }
+
+    void shared_memory_segment::unlink() noexcept
+    {
+        if (!name_.empty())
+        {
+            ::shm_unlink(name_.c_str());
+        }
+    }
+
+    void shared_memory_segment::remove(std::string const& name) noexcept
+    {
+        ::shm_unlink(name.c_str());
+    }
+
+    void shared_memory_segment::release() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(data_, size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
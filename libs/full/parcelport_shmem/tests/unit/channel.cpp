@@ -0,0 +1,219 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelport_shmem/channel.hpp>
+
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace hpx::parcelset::policies::shmem;
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t channel_size = 1024;
+
+// a channel placed in the memory of this process
+struct local_channel
+{
+    local_channel()
+      : header()
+      , ch(&header, data, channel_size)
+    {
+    }
+
+    channel_header header;
+    alignas(shared_cache_line_size) char data[channel_size];
+    channel ch;
+};
+
+// write a message of the given size, each byte holds the value 'fill'
+bool write_message(channel& ch, std::size_t size, char fill)
+{
+    frame_header frame{};
+    frame.kind = frame_kind::message;
+    frame.size = size;
+    return ch.try_write(
+        frame, size, [&](char* data) { std::memset(data, fill, size); });
+}
+
+// read all messages, return their sizes and verify their contents
+std::vector<std::size_t> read_messages(channel& ch, char first_fill)
+{
+    std::vector<std::size_t> sizes;
+    ch.consume([&](frame_header const& frame, char const* data) {
+        HPX_TEST(frame.kind == frame_kind::message);
+        for (std::size_t i = 0; i != frame.size; ++i)
+        {
+            HPX_TEST_EQ(data[i], static_cast<char>(first_fill + sizes.size()));
+        }
+        sizes.push_back(static_cast<std::size_t>(frame.size));
+    });
+    return sizes;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// A frame which does not fit at the end of the buffer is placed at its
+// beginning, the end of the buffer is marked by a padding frame.
+void test_wrap_around_padding()
+{
+    local_channel c;
+
+    std::size_t const payload = 300;
+    std::size_t const size = channel::frame_size(payload);
+
+    // fill the channel until no more frames fit
+    std::size_t num_written = 0;
+    while (write_message(c.ch, payload, static_cast<char>('a' + num_written)))
+    {
+        ++num_written;
+    }
+    HPX_TEST_EQ(num_written, channel_size / size);
+
+    // the consumed frames make room for a frame at the beginning of the buffer
+    HPX_TEST_EQ(read_messages(c.ch, 'a').size(), num_written);
+    HPX_TEST(c.ch.empty());
+
+    std::size_t const head_before = c.header.head.load();
+    HPX_TEST(write_message(c.ch, payload, 'x'));
+
+    // the frame skipped the remainder of the buffer
+    std::size_t const skipped = channel_size - head_before % channel_size;
+    HPX_TEST_LTE(sizeof(frame_header), skipped);
+    HPX_TEST_EQ(c.header.head.load(), head_before + skipped + size);
+
+    // the padding frame is not reported as a message
+    std::vector<std::size_t> const sizes = read_messages(c.ch, 'x');
+    HPX_TEST_EQ(sizes.size(), std::size_t(1));
+    HPX_TEST_EQ(sizes[0], payload);
+    HPX_TEST(c.ch.empty());
+}
+
+// The remainder of the buffer may be too small to hold a padding frame, the
+// receiver skips it anyway.
+void test_wrap_around_no_padding()
+{
+    local_channel c;
+
+    // three frames leave less than a frame header at the end of the buffer
+    std::size_t const payload = 280;
+    std::size_t const size = channel::frame_size(payload);
+    HPX_TEST_LT(channel_size - 3 * size, sizeof(frame_header));
+
+    for (std::size_t i = 0; i != 3; ++i)
+    {
+        HPX_TEST(write_message(c.ch, payload, static_cast<char>('a' + i)));
+    }
+    HPX_TEST_EQ(read_messages(c.ch, 'a').size(), std::size_t(3));
+
+    for (std::size_t i = 0; i != 3; ++i)
+    {
+        HPX_TEST(write_message(c.ch, payload, static_cast<char>('d' + i)));
+    }
+    HPX_TEST_EQ(read_messages(c.ch, 'd').size(), std::size_t(3));
+    HPX_TEST(c.ch.empty());
+}
+
+// A full channel rejects new frames until the receiver has consumed enough
+// of the pending frames.
+void test_full_channel()
+{
+    local_channel c;
+
+    std::size_t const payload = channel_size / 2 - sizeof(frame_header);
+    HPX_TEST(write_message(c.ch, payload, 'a'));
+    HPX_TEST(write_message(c.ch, payload, 'b'));
+    HPX_TEST(!write_message(c.ch, 1, 'c'));
+
+    HPX_TEST_EQ(read_messages(c.ch, 'a').size(), std::size_t(2));
+    HPX_TEST(write_message(c.ch, 1, 'c'));
+    HPX_TEST_EQ(read_messages(c.ch, 'c').size(), std::size_t(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Messages up to a quarter of the channel size are written into the channel
+// itself, larger messages and messages with zero-copy chunks are not.
+void test_inline_threshold()
+{
+    std::size_t const threshold = channel_size / 4;
+    std::size_t const max_inline = threshold - sizeof(frame_header);
+
+    HPX_TEST(is_inline_message(0, 0, threshold));
+    HPX_TEST(is_inline_message(0, max_inline, threshold));
+    HPX_TEST(!is_inline_message(0, max_inline + 1, threshold));
+    HPX_TEST(!is_inline_message(1, 0, threshold));
+    HPX_TEST(!is_inline_message(1, max_inline, threshold));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Each channel of a mailbox is used by at most one sender. A channel closed
+// by its sender becomes available again once all of its frames have been
+// consumed.
+void test_mailbox_channels()
+{
+    std::string const name =
+        "/hpx.shmem.test." + std::to_string(static_cast<int>(::getpid()));
+    std::size_t const num_channels = 2;
+
+    mailbox receiving = mailbox::create(name, num_channels, channel_size);
+
+    hpx::error_code ec(hpx::throwmode::lightweight);
+    mailbox sending = mailbox::open(name, ec);
+    HPX_TEST(!ec);
+    HPX_TEST_EQ(sending.num_channels(), num_channels);
+    HPX_TEST_EQ(sending.channel_size(), channel_size);
+
+    // run out of channels
+    auto const pid = static_cast<std::uint32_t>(::getpid());
+    channel ch1 = sending.claim_channel(pid);
+    channel ch2 = sending.claim_channel(pid);
+    HPX_TEST(static_cast<bool>(ch1));
+    HPX_TEST(static_cast<bool>(ch2));
+    HPX_TEST(!sending.claim_channel(pid));
+
+    // an open channel is not reclaimed
+    channel received = receiving.get_channel(0);
+    HPX_TEST_EQ(received.header()->sender_pid, pid);
+    HPX_TEST(!received.try_reclaim());
+
+    // a closed channel is reclaimed after its frames were consumed
+    HPX_TEST(write_message(ch1, 10, 'a'));
+    ch1.close();
+    HPX_TEST(!received.try_reclaim());
+    HPX_TEST(!sending.claim_channel(pid));
+
+    HPX_TEST_EQ(read_messages(received, 'a').size(), std::size_t(1));
+    HPX_TEST(received.try_reclaim());
+
+    channel ch3 = sending.claim_channel(pid);
+    HPX_TEST(static_cast<bool>(ch3));
+    HPX_TEST_EQ(ch3.header(), ch1.header());
+    HPX_TEST(received.empty());
+
+    receiving.unlink();
+
+    // the name of the mailbox has been removed
+    mailbox::open(name, ec);
+    HPX_TEST(ec);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_wrap_around_padding();
+    test_wrap_around_no_padding();
+    test_full_channel();
+    test_inline_threshold();
+    test_mailbox_channels();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,169 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Send messages of different sizes through the shared memory parcelport:
+// messages written into the channels (wrapping around the end of the ring
+// buffers), messages around the size threshold above which a separate shared
+// memory segment is used, and messages with zero-copy chunks.
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t checksum(std::vector<char> const& data)
+{
+    return std::accumulate(data.begin(), data.end(), std::uint64_t(0),
+        [](std::uint64_t sum, char c) {
+            return sum * 31 + static_cast<unsigned char>(c);
+        });
+}
+
+std::uint64_t echo_checksum(std::vector<char> const& data)
+{
+    return checksum(data);
+}
+
+HPX_PLAIN_ACTION(echo_checksum)
+
+std::vector<char> generate_data(std::size_t size)
+{
+    std::vector<char> data(size);
+    std::generate(data.begin(), data.end(),
+        []() { return static_cast<char>(std::rand() % 255); });
+    return data;
+}
+
+void send_messages(hpx::id_type const& id, std::vector<std::size_t> sizes)
+{
+    std::vector<std::vector<char>> data;
+    data.reserve(sizes.size());
+
+    std::vector<hpx::future<std::uint64_t>> results;
+    results.reserve(sizes.size());
+
+    for (std::size_t size : sizes)
+    {
+        data.push_back(generate_data(size));
+        results.push_back(hpx::async(echo_checksum_action(), id, data.back()));
+    }
+
+    hpx::wait_all(results);
+
+    for (std::size_t i = 0; i != results.size(); ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), checksum(data[i]));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t get_config_size(std::string const& key, std::size_t dflt)
+{
+    return std::stoul(hpx::get_config_entry(key, std::to_string(dflt)));
+}
+
+// many small messages wrap around the end of the channels multiple times
+void test_wrap_around(hpx::id_type const& id, std::size_t channel_size)
+{
+    std::vector<std::size_t> sizes;
+    for (std::size_t i = 0; i != 20 * channel_size / 256; ++i)
+    {
+        sizes.push_back(64 + std::rand() % 128);
+    }
+    send_messages(id, sizes);
+}
+
+// the serialized messages cross the threshold above which they are placed
+// into a separate shared memory segment
+void test_inline_threshold(hpx::id_type const& id, std::size_t channel_size)
+{
+    std::size_t const threshold = channel_size / 4;
+
+    std::vector<std::size_t> sizes;
+    for (std::size_t size = threshold / 2; size <= 2 * threshold; size += 8)
+    {
+        sizes.push_back(size);
+    }
+    send_messages(id, sizes);
+}
+
+// messages with zero-copy chunks are always placed into a separate segment
+void test_zero_copy_chunks(hpx::id_type const& id)
+{
+    std::size_t const zero_copy_threshold = get_config_size(
+        "hpx.parcel.zero_copy_serialization_threshold", 8192);
+
+    send_messages(id,
+        {zero_copy_threshold + 1, 2 * zero_copy_threshold,
+            16 * zero_copy_threshold + 3});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    auto seed = static_cast<unsigned int>(std::time(nullptr));
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    std::size_t const channel_size =
+        get_config_size("hpx.parcel.shmem.channel_size", 65536);
+
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_wrap_around(id, channel_size);
+        test_inline_threshold(id, channel_size);
+        test_zero_copy_chunks(id);
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    // use small channels to make the messages wrap around frequently
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.shmem.channel_size=4096"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
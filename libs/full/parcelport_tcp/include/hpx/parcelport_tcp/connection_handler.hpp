@@ -109,6 +109,13 @@ namespace hpx::parcelset {
 
             parcelset::locality create_locality() const override;
 
+            // Return the number of messages a connection may send before it
+            // waits for the acknowledgements of the receiving end.
+            std::size_t send_window() const noexcept
+            {
+                return send_window_;
+            }
+
         private:
             void handle_accept(std::error_code const& e,
                 std::shared_ptr<receiver> receiver_conn);
@@ -118,6 +125,9 @@ namespace hpx::parcelset {
             /// Acceptor used to listen for incoming connections.
             asio::ip::tcp::acceptor* acceptor_;
 
+            /// The number of unacknowledged messages per connection
+            std::size_t send_window_;
+
             /// The list of accepted connections
             mutable hpx::spinlock connections_mtx_;
 
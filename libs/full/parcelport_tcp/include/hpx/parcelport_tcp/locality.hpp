@@ -15,7 +15,9 @@
 #if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP)
 #include <hpx/modules/serialization.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <string>
 
 namespace hpx::parcelset::policies::tcp {
@@ -54,6 +56,11 @@ namespace hpx::parcelset::policies::tcp {
             return port_ != static_cast<std::uint16_t>(-1);
         }
 
+        std::size_t hash() const noexcept
+        {
+            return std::hash<std::string>()(address_) * 31 + port_;
+        }
+
         HPX_EXPORT void save(serialization::output_archive& ar) const;
         HPX_EXPORT void load(serialization::input_archive& ar);
 
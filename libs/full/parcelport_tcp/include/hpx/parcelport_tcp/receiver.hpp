@@ -43,6 +43,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <system_error>
@@ -62,7 +63,9 @@ namespace hpx::parcelset::policies::tcp {
             connection_handler& parcelport)
           : socket_(io_service)
           , max_inbound_size_(max_inbound_size)
-          , ack_(false)
+          , receive_buffer_(receive_buffer_size)
+          , receive_begin_(0)
+          , receive_end_(0)
           , parcelport_(parcelport)
           , operation_in_flight_(0)
         {
@@ -85,56 +88,56 @@ namespace hpx::parcelset::policies::tcp {
         }
 
         // Asynchronously read a data structure from the socket.
+        //
+        // The data is read into the receive buffer using as few operations as
+        // possible. All messages received completely are de-serialized
+        // directly from that buffer and are acknowledged at once. Messages
+        // that don't fit into the receive buffer (or that have zero-copy
+        // chunks) are read into separately allocated buffers.
         template <typename Handler>
         void async_read(Handler handler)
         {
             HPX_ASSERT(buffer_.data_.empty());
 
-            // Store the time of the begin of the read operation
-#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
-            parcelset::data_point& data = buffer_.data_point_;
-            data.time_ = timer_.elapsed_nanoseconds();
-            data.serialization_time_ = 0;
-            data.bytes_ = 0;
-            data.num_parcels_ = 0;
-#endif
             parcels_.clear();
             chunk_buffers_.clear();
 
-            // Issue a read operation to read the message size.
-            using asio::buffer;
-            std::vector<asio::mutable_buffer> buffers;
-            buffers.emplace_back(&buffer_.size_, sizeof(buffer_.size_));
-            buffers.emplace_back(
-                &buffer_.data_size_, sizeof(buffer_.data_size_));
-
-            buffers.emplace_back(
-                &buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
-
+            // de-serialize all messages that have been received completely
+            std::size_t num_messages = 0;
+            while (peek_header())
             {
-                std::unique_lock lk(mtx_);
-                if (!socket_.is_open())
+                if (buffer_.size_ > max_inbound_size_)
                 {
-                    lk.unlock();
                     // report this problem back to the handler
                     handler(asio::error::make_error_code(
-                        asio::error::not_connected));
+                        asio::error::operation_not_supported));
                     return;
                 }
-#if defined(__linux) || defined(linux) || defined(__linux__)
-                asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_QUICKACK>
-                    quickack(true);
-                socket_.set_option(quickack);
-#endif
 
-                void (receiver::*f)(std::error_code const&, std::size_t,
-                    Handler) = &receiver::handle_read_header<Handler>;
+                if (buffer_.num_chunks_.first != 0 ||
+                    receive_end_ - receive_begin_ < header_size + buffer_.size_)
+                {
+                    break;
+                }
+
+                decode_received_message();
+                ++num_messages;
+            }
 
-                asio::async_read(socket_, buffers,
-                    hpx::bind(f, shared_from_this(),
-                        placeholders::_1,    // error
-                        placeholders::_2,    // bytes_transferred
-                        util::protect(handler)));
+            if (num_messages != 0)
+            {
+                ++operation_in_flight_;
+                async_write_acks(num_messages, HPX_MOVE(handler));
+            }
+            else if (peek_header() &&
+                (buffer_.num_chunks_.first != 0 ||
+                    header_size + buffer_.size_ > receive_buffer_.size()))
+            {
+                async_read_message(HPX_MOVE(handler));
+            }
+            else
+            {
+                async_read_some(HPX_MOVE(handler));
             }
         }
 
@@ -158,103 +161,296 @@ namespace hpx::parcelset::policies::tcp {
         }
 
     private:
-        // Handle a completed read of the message size from the message header.
-        template <typename Handler>
-        void handle_read_header(std::error_code const& e,
-            std::size_t /* bytes_transferred */, Handler handler)
+        // The size of the fixed part of each message: message size, overall
+        // data size, and the number of (zero-copy and non-zero-copy) chunks.
+        static constexpr std::size_t header_size = 2 * sizeof(std::uint64_t) +
+            sizeof(parcel_buffer_type::count_chunks_type);
+
+        static constexpr std::size_t receive_buffer_size = 64 * 1024;
+
+        // Refers to a message that was received completely into the receive
+        // buffer, allows to de-serialize the message without copying it.
+        struct message_view
         {
-            HPX_ASSERT(operation_in_flight_ == 0);
-            if (e)
+            [[nodiscard]] constexpr char const& operator[](
+                std::size_t i) const noexcept
             {
-                handler(e);
+                return data_[i];
             }
-            else
+
+            [[nodiscard]] constexpr std::size_t size() const noexcept
             {
-                ++operation_in_flight_;
+                return size_;
+            }
 
-                // Determine the length of the serialized data.
-                std::uint64_t const inbound_size = buffer_.size_;
+            char const* data_;
+            std::size_t size_;
+        };
 
-                if (inbound_size > max_inbound_size_)
-                {
-                    // report this problem back to the handler
-                    handler(asio::error::make_error_code(
-                        asio::error::operation_not_supported));
-                    return;
-                }
+        // Extract the header of the next message from the receive buffer
+        // without consuming it, return false if the header was not received
+        // completely yet.
+        bool peek_header() noexcept
+        {
+            if (receive_end_ - receive_begin_ < header_size)
+            {
+                return false;
+            }
+
+            char const* data = receive_buffer_.data() + receive_begin_;
+            std::memcpy(&buffer_.size_, data, sizeof(buffer_.size_));
+            data += sizeof(buffer_.size_);
+            std::memcpy(&buffer_.data_size_, data, sizeof(buffer_.data_size_));
+            data += sizeof(buffer_.data_size_);
+
+            std::uint32_t num_chunks[2];
+            std::memcpy(num_chunks, data, sizeof(num_chunks));
+            buffer_.num_chunks_ = parcel_buffer_type::count_chunks_type(
+                num_chunks[0], num_chunks[1]);
+            return true;
+        }
+
+        // De-serialize the message at the front of the receive buffer in
+        // place.
+        void decode_received_message()
+        {
+            receive_begin_ += header_size;
+
+            auto const inbound_size = static_cast<std::size_t>(buffer_.size_);
+            message_view const data{
+                receive_buffer_.data() + receive_begin_, inbound_size};
+            receive_begin_ += inbound_size;
 
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
-                buffer_.data_point_.bytes_ =
-                    static_cast<std::size_t>(inbound_size);
+            buffer_.data_point_ = parcelset::data_point();
+            buffer_.data_point_.bytes_ = inbound_size;
 #endif
-                // receive buffers
-                std::vector<asio::mutable_buffer> buffers;
+            if (parcelport_.get_decode_pool() != nullptr)
+            {
+                // the receive buffer is reused by the next read, the message
+                // has to be copied for being de-serialized on the decode pool
+                buffer_.data_.assign(data.data_, data.data_ + inbound_size);
+                decode_and_handle_parcels(parcelport_, HPX_MOVE(buffer_));
+                buffer_ = parcel_buffer_type();
+                return;
+            }
 
-                // determine the size of the chunk buffer
-                auto const num_zero_copy_chunks = static_cast<std::size_t>(
-                    static_cast<std::uint32_t>(buffer_.num_chunks_.first));
-                auto const num_non_zero_copy_chunks = static_cast<std::size_t>(
-                    static_cast<std::uint32_t>(buffer_.num_chunks_.second));
+            serialization::input_archive archive(
+                data, static_cast<std::size_t>(buffer_.data_size_));
 
-                void (receiver::*f)(std::error_code const&, Handler);
+            handle_received_parcels(
+                decode_message_with_chunks(archive, parcelport_, buffer_, 0));
+        }
 
-                if (num_zero_copy_chunks != 0)
+        // Read more data into the free part of the receive buffer.
+        template <typename Handler>
+        void async_read_some(Handler handler)
+        {
+            // move a partially received message to the front of the buffer
+            std::size_t const available = receive_end_ - receive_begin_;
+            if (receive_begin_ != 0)
+            {
+                if (available != 0)
                 {
-                    using transmission_chunk_type =
-                        parcel_buffer_type::transmission_chunk_type;
+                    std::memmove(receive_buffer_.data(),
+                        receive_buffer_.data() + receive_begin_, available);
+                }
+                receive_begin_ = 0;
+                receive_end_ = available;
+            }
+            HPX_ASSERT(receive_end_ < receive_buffer_.size());
 
-                    std::vector<transmission_chunk_type>& chunks =
-                        buffer_.transmission_chunks_;
+            std::unique_lock lk(mtx_);
+            if (!socket_.is_open())
+            {
+                lk.unlock();
 
-                    chunks.resize(static_cast<std::size_t>(
-                        num_zero_copy_chunks + num_non_zero_copy_chunks));
+                // report this problem back to the handler
+                handler(
+                    asio::error::make_error_code(asio::error::not_connected));
+                return;
+            }
 
-                    buffers.emplace_back(chunks.data(),
-                        chunks.size() * sizeof(transmission_chunk_type));
+#if defined(__linux) || defined(linux) || defined(__linux__)
+            asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_QUICKACK>
+                quickack(true);
+            socket_.set_option(quickack);
+#endif
+            void (receiver::*f)(std::error_code const&, std::size_t, Handler) =
+                &receiver::handle_read_some<Handler>;
+
+            socket_.async_read_some(
+                asio::buffer(receive_buffer_.data() + receive_end_,
+                    receive_buffer_.size() - receive_end_),
+                hpx::bind(f, shared_from_this(),
+                    placeholders::_1,    // error
+                    placeholders::_2,    // bytes_transferred
+                    util::protect(handler)));
+        }
 
-                    // add main buffer holding data that was serialized normally
-                    buffer_.data_.resize(
-                        static_cast<std::size_t>(inbound_size));
-                    buffers.emplace_back(asio::buffer(buffer_.data_));
+        template <typename Handler>
+        void handle_read_some(std::error_code const& e,
+            std::size_t bytes_transferred, Handler handler)
+        {
+            if (e)
+            {
+                handler(e);
+                return;
+            }
 
-                    // Start an asynchronous call to receive the data.
-                    f = &receiver::handle_read_chunk_data<Handler>;
-                }
-                else
-                {
-                    // add main buffer holding data that was serialized normally
-                    buffer_.data_.resize(
-                        static_cast<std::size_t>(inbound_size));
-                    buffers.emplace_back(asio::buffer(buffer_.data_));
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            parcelport_.add_receive_operation();
+#endif
+            receive_end_ += bytes_transferred;
+            async_read(handler);
+        }
 
-                    // Start an asynchronous call to receive the data.
-                    f = &receiver::handle_read_data<Handler>;
-                }
+        // Fill the given buffers, the data that is already available in the
+        // receive buffer is consumed first, the remaining part is read from
+        // the socket.
+        template <typename Handler>
+        void async_read_buffers(std::vector<asio::mutable_buffer> buffers,
+            void (receiver::*f)(std::error_code const&, Handler),
+            Handler handler)
+        {
+            std::size_t consumed = asio::buffer_copy(buffers,
+                asio::buffer(receive_buffer_.data() + receive_begin_,
+                    receive_end_ - receive_begin_));
+            receive_begin_ += consumed;
 
+            std::vector<asio::mutable_buffer> remaining;
+            for (asio::mutable_buffer const& b : buffers)
+            {
+                if (consumed >= b.size())
                 {
-                    std::unique_lock lk(mtx_);
-                    if (!socket_.is_open())
-                    {
-                        lk.unlock();
+                    consumed -= b.size();
+                    continue;
+                }
+                remaining.emplace_back(b + consumed);
+                consumed = 0;
+            }
 
-                        // report this problem back to the handler
-                        handler(asio::error::make_error_code(
-                            asio::error::not_connected));
-                        return;
-                    }
+            std::unique_lock lk(mtx_);
+            if (!socket_.is_open())
+            {
+                lk.unlock();
+
+                // report this problem back to the handler
+                handler(
+                    asio::error::make_error_code(asio::error::not_connected));
+                return;
+            }
 
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            if (!remaining.empty())
+            {
+                parcelport_.add_receive_operation();
+            }
+#endif
 #if defined(__linux) || defined(linux) || defined(__linux__)
-                    asio::detail::socket_option::boolean<IPPROTO_TCP,
-                        TCP_QUICKACK>
-                        quickack(true);
-                    socket_.set_option(quickack);
+            asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_QUICKACK>
+                quickack(true);
+            socket_.set_option(quickack);
 #endif
-                    asio::async_read(socket_, buffers,
-                        hpx::bind(f, shared_from_this(),
-                            placeholders::_1,    // error,
-                            util::protect(handler)));
-                }
+            asio::async_read(socket_, remaining,
+                hpx::bind(f, shared_from_this(),
+                    placeholders::_1,    // error,
+                    util::protect(handler)));
+        }
+
+        // Read a message that does not fit into the receive buffer (or that
+        // has zero-copy chunks) into separately allocated buffers.
+        template <typename Handler>
+        void async_read_message(Handler handler)
+        {
+            HPX_ASSERT(operation_in_flight_ == 0);
+            ++operation_in_flight_;
+
+            receive_begin_ += header_size;
+
+            // Determine the length of the serialized data.
+            std::uint64_t const inbound_size = buffer_.size_;
+
+            // Store the time of the begin of the read operation
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            parcelset::data_point& data = buffer_.data_point_;
+            data = parcelset::data_point();
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.bytes_ = static_cast<std::size_t>(inbound_size);
+#endif
+            // receive buffers
+            std::vector<asio::mutable_buffer> buffers;
+
+            // determine the size of the chunk buffer
+            auto const num_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+            auto const num_non_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.second));
+
+            void (receiver::*f)(std::error_code const&, Handler);
+
+            if (num_zero_copy_chunks != 0)
+            {
+                using transmission_chunk_type =
+                    parcel_buffer_type::transmission_chunk_type;
+
+                std::vector<transmission_chunk_type>& chunks =
+                    buffer_.transmission_chunks_;
+
+                chunks.resize(static_cast<std::size_t>(
+                    num_zero_copy_chunks + num_non_zero_copy_chunks));
+
+                buffers.emplace_back(chunks.data(),
+                    chunks.size() * sizeof(transmission_chunk_type));
+
+                // add main buffer holding data that was serialized normally
+                buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+                buffers.emplace_back(asio::buffer(buffer_.data_));
+
+                // Start an asynchronous call to receive the data.
+                f = &receiver::handle_read_chunk_data<Handler>;
             }
+            else
+            {
+                // add main buffer holding data that was serialized normally
+                buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+                buffers.emplace_back(asio::buffer(buffer_.data_));
+
+                // Start an asynchronous call to receive the data.
+                f = &receiver::handle_read_data<Handler>;
+            }
+
+            async_read_buffers(HPX_MOVE(buffers), f, HPX_MOVE(handler));
+        }
+
+        // Acknowledge the given number of messages using a single write
+        // operation.
+        template <typename Handler>
+        void async_write_acks(std::size_t num_messages, Handler handler)
+        {
+            HPX_ASSERT(operation_in_flight_ != 0);
+
+            acks_.assign(num_messages, static_cast<char>(true));
+
+            void (receiver::*f)(std::error_code const&, Handler) =
+                &receiver::handle_write_ack<Handler>;
+
+            std::unique_lock lk(mtx_);
+            if (!socket_.is_open())
+            {
+                lk.unlock();
+
+                // report this problem back to the handler
+                handler(
+                    asio::error::make_error_code(asio::error::not_connected));
+                --operation_in_flight_;
+                return;
+            }
+
+            asio::async_write(socket_, asio::buffer(acks_),
+                hpx::bind(f, shared_from_this(),
+                    placeholders::_1,    // error,
+                    util::protect(handler)));
         }
 
         // Handle a completed read of message data.
@@ -349,32 +545,10 @@ namespace hpx::parcelset::policies::tcp {
                 }
 
                 // Start an asynchronous call to receive the zero-copy data.
-                {
-                    void (receiver::*f)(std::error_code const&, Handler) =
-                        &receiver::handle_read_data<Handler>;
-
-                    std::unique_lock lk(mtx_);
-                    if (!socket_.is_open())
-                    {
-                        lk.unlock();
-
-                        // report this problem back to the handler
-                        handler(asio::error::make_error_code(
-                            asio::error::not_connected));
-                        return;
-                    }
+                void (receiver::*f)(std::error_code const&, Handler) =
+                    &receiver::handle_read_data<Handler>;
 
-#if defined(__linux) || defined(linux) || defined(__linux__)
-                    asio::detail::socket_option::boolean<IPPROTO_TCP,
-                        TCP_QUICKACK>
-                        quickack(true);
-                    socket_.set_option(quickack);
-#endif
-                    asio::async_read(socket_, buffers,
-                        hpx::bind(f, shared_from_this(),
-                            placeholders::_1,    // error,
-                            util::protect(handler)));
-                }
+                async_read_buffers(HPX_MOVE(buffers), f, HPX_MOVE(handler));
             }
         }
 
@@ -397,17 +571,13 @@ namespace hpx::parcelset::policies::tcp {
                 buffer_.data_point_.time_ =
                     timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
 #endif
-                // now send acknowledgment byte
-                void (receiver::*f)(std::error_code const&, Handler) =
-                    &receiver::handle_write_ack<Handler>;
-
                 if (parcels_.empty())
                 {
                     // decode and handle received data
                     HPX_ASSERT(buffer_.num_chunks_.first == 0 ||
                         !parcelport_.allow_zero_copy_receive_optimizations());
-                    handle_received_parcels(
-                        decode_parcels(parcelport_, HPX_MOVE(buffer_)));
+                    decode_and_handle_parcels(parcelport_, HPX_MOVE(buffer_),
+                        static_cast<std::size_t>(-1), HPX_MOVE(chunk_buffers_));
                 }
                 else
                 {
@@ -417,25 +587,8 @@ namespace hpx::parcelset::policies::tcp {
                     handle_received_parcels(HPX_MOVE(parcels_));
                 }
 
-                ack_ = true;
-                {
-                    std::unique_lock lk(mtx_);
-                    if (!socket_.is_open())
-                    {
-                        lk.unlock();
-
-                        // report this problem back to the handler
-                        handler(asio::error::make_error_code(
-                            asio::error::not_connected));
-                        return;
-                    }
-
-                    asio::async_write(socket_,
-                        asio::buffer(&ack_, sizeof(ack_)),
-                        hpx::bind(f, shared_from_this(),
-                            placeholders::_1,    // error,
-                            util::protect(handler)));
-                }
+                // now send acknowledgment byte
+                async_write_acks(1, HPX_MOVE(handler));
             }
         }
 
@@ -464,7 +617,14 @@ namespace hpx::parcelset::policies::tcp {
 
         std::uint64_t max_inbound_size_;
 
-        bool ack_;
+        // Data received from the socket, [receive_begin_, receive_end_) has
+        // not been processed yet.
+        std::vector<char> receive_buffer_;
+        std::size_t receive_begin_;
+        std::size_t receive_end_;
+
+        // one acknowledgement byte for each received message
+        std::vector<char> acks_;
 
         // The handler used to process the incoming request.
         connection_handler& parcelport_;
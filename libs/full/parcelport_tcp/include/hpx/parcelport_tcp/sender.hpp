@@ -58,11 +58,19 @@ namespace hpx::parcelset::policies::tcp {
 
     public:
         // Construct a sending parcelport_connection with the given io_context.
+        //
+        // The receiving end acknowledges each message with a single byte. The
+        // connection may send up to send_window messages before it waits for
+        // those acknowledgements, all outstanding acknowledgements are then
+        // read using a single operation. A window of size one causes the
+        // connection to wait for the acknowledgement of each message.
         sender(asio::io_context& io_service,
             parcelset::locality const& locality_id,
-            [[maybe_unused]] parcelset::parcelport* pp)
+            [[maybe_unused]] parcelset::parcelport* pp,
+            std::size_t send_window = 1)
           : socket_(io_service)
-          , ack_(false)
+          , send_window_(send_window != 0 ? send_window : 1)
+          , unacknowledged_(0)
           , there_(locality_id)
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
           , pp_(pp)
@@ -240,7 +248,16 @@ namespace hpx::parcelset::policies::tcp {
             pp_->add_sent_data(buffer_.data_point_);
 #endif
 
-            // now handle the acknowledgment byte which is sent by the receiver
+            // the connection is immediately available for sending the next
+            // message as long as the send window is not exhausted
+            if (++unacknowledged_ < send_window_)
+            {
+                handle_read_ack(e);
+                return;
+            }
+
+            // now handle the acknowledgment bytes which are sent by the
+            // receiver, one for each message sent since the last time
 #if defined(__linux) || defined(linux) || defined(__linux__)
             asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_QUICKACK>
                 quickack(true);
@@ -248,12 +265,19 @@ namespace hpx::parcelset::policies::tcp {
 #endif
 
             void (sender::*f)(std::error_code const&) =
-                &sender::handle_read_ack;
+                &sender::handle_read_acks;
 
-            asio::async_read(socket_, asio::buffer(&ack_, sizeof(ack_)),
+            acks_.resize(unacknowledged_);
+            asio::async_read(socket_, asio::buffer(acks_),
                 hpx::bind(f, shared_from_this(), placeholders::_1));
         }
 
+        void handle_read_acks(std::error_code const& e)
+        {
+            unacknowledged_ = 0;
+            handle_read_ack(e);
+        }
+
         void handle_read_ack(std::error_code const& e)
         {
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
@@ -274,7 +298,12 @@ namespace hpx::parcelset::policies::tcp {
         // Socket for the parcelport_connection.
         asio::ip::tcp::socket socket_;
 
-        bool ack_;
+        // the number of messages which may be sent before waiting for the
+        // acknowledgements of the receiver, and the number of messages sent
+        // since the acknowledgements have been read last
+        std::size_t send_window_;
+        std::size_t unacknowledged_;
+        std::vector<char> acks_;
 
         // the other (receiving) end of this connection
         parcelset::locality there_;
@@ -30,6 +30,7 @@
 #include <asio/io_context.hpp>
 #include <asio/ip/tcp.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -62,11 +63,24 @@ namespace hpx::parcelset::policies::tcp {
             locality(HPX_INITIAL_IP_ADDRESS, HPX_INITIAL_IP_PORT));
     }
 
+    namespace {
+
+        std::size_t get_send_window(util::runtime_configuration const& ini)
+        {
+            // a window of size one causes for each message to be acknowledged
+            // before the next one is sent
+            return (std::max) (hpx::util::get_entry_as<std::size_t>(
+                                   ini, "hpx.parcel.tcp.send_window", 1),
+                static_cast<std::size_t>(1));
+        }
+    }    // namespace
+
     connection_handler::connection_handler(
         util::runtime_configuration const& ini,
         threads::policies::callback_notifier const& notifier)
       : base_type(ini, parcelport_address(ini), notifier)
       , acceptor_(nullptr)
+      , send_window_(get_send_window(ini))
     {
         if (here_.type() != std::string("tcp"))
         {
@@ -160,7 +174,8 @@ namespace hpx::parcelset::policies::tcp {
 
         // The parcel gets serialized inside the connection constructor, no
         // need to keep the original parcel alive after this call returned.
-        auto sender_connection = std::make_shared<sender>(io_service, l, this);
+        auto sender_connection =
+            std::make_shared<sender>(io_service, l, this, send_window_);
 
         // Connect to the target locality, retry if needed
         std::error_code error = asio::error::try_again;
@@ -19,6 +19,7 @@
 //      [hpx.parcel.tcp]
 //      ...
 //      priority = 1
+//      send_window = 1
 //
 template <>
 struct hpx::traits::plugin_config_data<
@@ -42,7 +43,9 @@ struct hpx::traits::plugin_config_data<
 
     static constexpr char const* call() noexcept
     {
-        return "";
+        // number of messages a connection may send before waiting for the
+        // acknowledgements of the receiver, default: stop-and-wait
+        return "send_window = ${HPX_PARCEL_TCP_SEND_WINDOW:1}\n";
     }
 };    // namespace hpx::traits
 
@@ -5,10 +5,6 @@
 //  Parts of this code were taken from the Boost.Regex library
 //  Copyright (c) 2004 John Maddock
 //
-//  Parts of this code were taking from this article:
-//  http://timday.bitbucket.org/lru.html
-//  Copyright (c) 2010-2011 Tim Day
-//
 //  SPDX-License-Identifier: BSL-1.0
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
@@ -19,29 +15,64 @@
 
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/assert.hpp>
-#include <hpx/modules/datastructures.hpp>
+#include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/errors.hpp>
-#include <hpx/modules/logging.hpp>
 #include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/type_support.hpp>
 #include <hpx/modules/util.hpp>
 
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
-#include <deque>
-#include <list>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
-#include <stdexcept>
-#include <string>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::util {
 
+    namespace detail {
+
+        template <typename Key>
+        using connection_cache_key_hash_t =
+            decltype(std::declval<Key const&>().hash());
+
+        // Keys providing a hash() member function (like parcelset::locality)
+        // are hashed using it, all other keys are hashed using std::hash.
+        template <typename Key>
+        std::size_t hash_connection_cache_key(Key const& key)
+        {
+            if constexpr (util::is_detected_v<connection_cache_key_hash_t,
+                              Key>)
+            {
+                return key.hash();
+            }
+            else
+            {
+                return std::hash<Key>()(key);
+            }
+        }
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
-    /// This class implements an LRU cache to hold connections. It includes
-    /// entries checked out from the cache in its cache size.
+    /// This class implements a concurrent cache to hold connections. It
+    /// includes entries checked out from the cache in its cache size.
+    ///
+    /// The cached connections to each key are held in a lock-free stack,
+    /// getting a connection from the cache and returning it to the cache does
+    /// not require any locks once the entry for the key has been found. The
+    /// entries are distributed over a number of shards, each of which is
+    /// protected by its own lock that is held only while looking up an entry.
+    /// If the cache is full, connections are evicted using the CLOCK
+    /// algorithm, an approximation of LRU that does not require reordering
+    /// the entries on every access.
+    ///
+    /// The limits on the number of connections are checked without
+    /// synchronizing concurrent accesses, they may be exceeded temporarily.
     template <typename Connection, typename Key>
     class connection_cache
     {
@@ -49,18 +80,52 @@ namespace hpx::util {
         using mutex_type = hpx::spinlock;
 
         using connection_type = std::shared_ptr<Connection>;
-        using value_type = std::deque<connection_type>;
         using key_type = Key;
-        using key_tracker_type = std::list<key_type>;
-        using cache_value_type = hpx::tuple<
-            value_type,     // cached (available) connections
-            std::size_t,    // number of existing connections
-            std::size_t,    // max number of cached connections
-            typename key_tracker_type::iterator>;    // reference into LRU list
+        using size_type = std::size_t;
+
+    private:
+        struct entry
+        {
+            entry(key_type const& key, std::size_t max_connections)
+              : key_(key)
+              , connections_(max_connections)
+              , num_existing_(0)
+              , max_connections_(max_connections)
+              , referenced_(true)
+              , removed_(false)
+            {
+            }
+
+            key_type const key_;
+
+            // cached (available) connections
+            hpx::lockfree::stack<connection_type> connections_;
+
+            // number of existing connections, including the ones checked out
+            // from the cache
+            std::atomic<std::size_t> num_existing_;
+
+            // max number of cached connections
+            std::atomic<std::size_t> max_connections_;
 
-        using cache_type = std::map<key_type, cache_value_type>;
-        using size_type = typename cache_type::size_type;
+            // the CLOCK reference bit, set whenever the entry is accessed
+            std::atomic<bool> referenced_;
 
+            // set once the entry has been removed from the cache
+            std::atomic<bool> removed_;
+        };
+
+        using entry_type = std::shared_ptr<entry>;
+
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            std::map<key_type, entry_type> entries_;
+        };
+
+        static constexpr std::size_t num_shards = 16;
+
+    public:
         connection_cache(
             size_type max_connections, size_type max_connections_per_locality)
           : max_connections_(max_connections < 2 ? 2 : max_connections)
@@ -68,6 +133,7 @@ namespace hpx::util {
                     2 :
                     max_connections_per_locality)
           , connections_(0)
+          , clock_hand_(0)
           , shutting_down_(false)
           , insertions_(0)
           , evictions_(0)
@@ -90,79 +156,87 @@ namespace hpx::util {
         }
 
     private:
-        static value_type& cached_connections(cache_value_type& entry)
+        shard& get_shard(key_type const& l)
         {
-            return hpx::get<0>(entry);
+            return shards_[detail::hash_connection_cache_key(l) % num_shards];
         }
-        static value_type const& cached_connections(
-            cache_value_type const& entry)
+        shard const& get_shard(key_type const& l) const
         {
-            return hpx::get<0>(entry);
+            return shards_[detail::hash_connection_cache_key(l) % num_shards];
         }
 
-        static std::size_t& num_existing_connections(cache_value_type& entry)
-        {
-            return hpx::get<1>(entry);
-        }
-        static std::size_t const& num_existing_connections(
-            cache_value_type const& entry)
+        // Return the entry for the given key, if any.
+        entry_type find_entry(key_type const& l) const
         {
-            return hpx::get<1>(entry);
-        }
+            shard const& s = get_shard(l);
 
-        static std::size_t& max_num_connections(cache_value_type& entry)
-        {
-            return hpx::get<2>(entry);
-        }
-        static std::size_t const& max_num_connections(
-            cache_value_type const& entry)
-        {
-            return hpx::get<2>(entry);
+            std::lock_guard<mutex_type> lock(s.mtx_);
+            auto const it = s.entries_.find(l);
+            return it != s.entries_.end() ? it->second : entry_type();
         }
 
-        static typename key_tracker_type::iterator& lru_reference(
-            cache_value_type& entry)
-        {
-            return hpx::get<3>(entry);
-        }
-        static typename key_tracker_type::iterator const& lru_reference(
-            cache_value_type const& entry)
+        // Return the entry for the given key, create it if necessary.
+        entry_type find_or_create_entry(key_type const& l)
         {
-            return hpx::get<3>(entry);
+            entry_type e;
+
+            {
+                shard& s = get_shard(l);
+
+                std::lock_guard<mutex_type> lock(s.mtx_);
+                auto const it = s.entries_.find(l);
+                if (it != s.entries_.end())
+                {
+                    return it->second;
+                }
+
+                e = std::make_shared<entry>(l, max_connections_per_locality_);
+                s.entries_.emplace(l, e);
+            }
+
+            // make the new entry visible to the eviction
+            std::lock_guard<mutex_type> lock(clock_mtx_);
+            clock_.push_back(e);
+
+            return e;
         }
 
         ///////////////////////////////////////////////////////////////////////
         // Increase the per-locality and overall connection counts.
-        void increment_connection_count(cache_value_type& e)
+        void increment_connection_count(entry& e)
         {
-            std::size_t& num_connections = num_existing_connections(e);
-            ++num_connections;
+            std::size_t const num_connections = ++e.num_existing_;
             ++connections_;
 
             // If appropriate, update the maximum number of allowed cached
             // connections.
-            std::size_t& max_connections = max_num_connections(e);
+            std::size_t max_connections =
+                e.max_connections_.load(std::memory_order_relaxed);
             if (num_connections > max_connections * 2)
             {
-                max_connections = static_cast<std::size_t>(
-                    static_cast<double>(max_connections) * 1.5);
+                e.max_connections_.compare_exchange_strong(max_connections,
+                    static_cast<std::size_t>(
+                        static_cast<double>(max_connections) * 1.5),
+                    std::memory_order_relaxed);
             }
         }
 
         // Decrease the per-locality and overall connection counts.
-        void decrement_connection_count(cache_value_type& e)
+        void decrement_connection_count(entry& e)
         {
-            std::size_t& num_connections = num_existing_connections(e);
-            --num_connections;
+            std::size_t const num_connections = --e.num_existing_;
             --connections_;
 
             // If appropriate, update the maximum number of allowed
             // cached connections.
-            std::size_t& max_connections = max_num_connections(e);
+            std::size_t max_connections =
+                e.max_connections_.load(std::memory_order_relaxed);
             if (num_connections < max_connections / 2)
             {
-                max_connections = static_cast<std::size_t>(
-                    static_cast<double>(max_connections) / 1.5);
+                e.max_connections_.compare_exchange_strong(max_connections,
+                    static_cast<std::size_t>(
+                        static_cast<double>(max_connections) / 1.5),
+                    std::memory_order_relaxed);
             }
         }
 
@@ -176,37 +250,25 @@ namespace hpx::util {
         ///          \a reclaim().
         connection_type get(key_type const& l)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
-
-            // Check if this key already exists in the cache.
-            typename cache_type::iterator const it = cache_.find(l);
-
             // Check if this key already exists in the cache.
-            if (it != cache_.end())
+            entry_type const e = find_entry(l);
+            if (e)
             {
-                // Key exists in cache.
-
-                // Update LRU meta data.
-                key_tracker_.splice(key_tracker_.end(), key_tracker_,
-                    lru_reference(it->second));
+                // Key exists in cache, update CLOCK meta data.
+                e->referenced_.store(true, std::memory_order_relaxed);
 
                 // If connections to the locality are available in the cache,
-                // remove the oldest one and return it.
-                if (!cached_connections(it->second).empty())
+                // remove the most recently returned one and return it.
+                connection_type result;
+                if (e->connections_.pop(result))
                 {
-                    value_type& connections = cached_connections(it->second);
-                    connection_type result = connections.front();
-                    connections.pop_front();
-
                     ++hits_;
-                    check_invariants();
                     return result;
                 }
             }
 
             // If we get here then the item is not in the cache.
             ++misses_;
-            check_invariants();
             return connection_type();
         }
 
@@ -230,110 +292,65 @@ namespace hpx::util {
         bool get_or_reserve(
             key_type const& l, connection_type& conn, bool force_insert = false)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
+            entry_type const e = find_or_create_entry(l);
 
-            typename cache_type::iterator const it = cache_.find(l);
+            // Update CLOCK meta data.
+            e->referenced_.store(true, std::memory_order_relaxed);
 
-            // Check if this key already exists in the cache.
-            if (it != cache_.end())
+            // If connections to the locality are available in the cache,
+            // remove the most recently returned one and return it.
+            connection_type result;
+            if (e->connections_.pop(result))
             {
-                // Key exists in cache.
-
-                // Update LRU meta data.
-                key_tracker_.splice(key_tracker_.end(), key_tracker_,
-                    lru_reference(it->second));
-
-                // If connections to the locality are available in the cache,
-                // remove the oldest one and return it.
-                if (!cached_connections(it->second).empty())
-                {
-                    value_type& connections = cached_connections(it->second);
-                    conn = connections.front();
-                    connections.pop_front();
+                conn = HPX_MOVE(result);
 
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
-                    conn->set_state(Connection::state_reinitialized);
+                conn->set_state(Connection::state_reinitialized);
 #endif
-                    ++hits_;
-                    check_invariants();
-                    return true;
-                }
+                ++hits_;
+                return true;
+            }
 
-                // Otherwise, if we have less connections for this locality
-                // than the maximum, try to reserve space in the cache for a new
-                // connection.
-                if (num_existing_connections(it->second) <
-                        max_num_connections(it->second) ||
-                    force_insert)
+            // Otherwise, if we have less connections for this locality than
+            // the maximum, try to reserve space in the cache for a new
+            // connection.
+            std::size_t const num_existing =
+                e->num_existing_.load(std::memory_order_relaxed);
+            if (num_existing <
+                    e->max_connections_.load(std::memory_order_relaxed) ||
+                force_insert)
+            {
+                // See if we have enough space or can make space available.
+
+                // Note that if we don't have any space and there are no
+                // outstanding connections for this locality, we grow the
+                // cache size beyond its limit (hoping that it will be reduced
+                // in size next time some connection is handed back to the
+                // cache).
+                if (!free_space() && num_existing != 0 && !force_insert)
                 {
-                    // See if we have enough space or can make space available.
-
-                    // Note that if we don't have any space and there are no
-                    // outstanding connections for this locality, we grow the
-                    // cache size beyond its limit (hoping that it will be
-                    // reduced in size next time some connection is handed back
-                    // to the cache).
-
-                    if (!free_space() &&
-                        num_existing_connections(it->second) != 0 &&
-                        !force_insert)
-                    {
-                        // If we can't find or make space, give up.
-                        ++misses_;
-                        check_invariants();
-                        return false;
-                    }
-
-                    // Make sure the input connection shared_ptr doesn't hold
-                    // anything.
-                    conn.reset();
-
-                    // Increase the per-locality and overall connection counts.
-                    increment_connection_count(it->second);
-
-                    // Statistics
-                    ++insertions_;
-                    check_invariants();
-                    return true;
+                    // If we can't find or make space, give up.
+                    ++misses_;
+                    return false;
                 }
 
-                // We've reached the maximum number of connections for this
-                // locality, and none of them are checked into the cache, so
-                // we have to give up.
-                ++misses_;
-                check_invariants();
-                return false;
-            }
-
-            // Key (locality) isn't in cache.
-
-            // See if we have enough space or can make space available.
-
-            // Note that we ignore the outcome of free_space() here as we have
-            // to guarantee to have space for the new connection as there are
-            // no connections outstanding for this locality. If free_space
-            // fails we grow the cache size beyond its limit (hoping that it
-            // will be reduced in size next time some connection is handed back
-            // to the cache).
-            free_space();
-
-            // Update LRU meta data.
-            typename key_tracker_type::iterator kt =
-                key_tracker_.insert(key_tracker_.end(), l);
+                // Make sure the input connection shared_ptr doesn't hold
+                // anything.
+                conn.reset();
 
-            cache_.emplace(l,
-                hpx::make_tuple(
-                    value_type(), 1, max_connections_per_locality_, kt));
+                // Increase the per-locality and overall connection counts.
+                increment_connection_count(*e);
 
-            // Make sure the input connection shared_ptr doesn't hold anything.
-            conn.reset();
-
-            // Increase the overall connection counts.
-            ++connections_;
+                // Statistics
+                ++insertions_;
+                return true;
+            }
 
-            ++insertions_;
-            check_invariants();
-            return true;
+            // We've reached the maximum number of connections for this
+            // locality, and none of them are checked into the cache, so we
+            // have to give up.
+            ++misses_;
+            return false;
         }
 
         /// Returns a connection for \a l to the cache.
@@ -342,48 +359,42 @@ namespace hpx::util {
         ///       a prior call to \a get() or \a get_or_reserve().
         void reclaim(key_type const& l, connection_type const& conn)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
-
             // Search for an entry for this key.
-            typename cache_type::iterator const ct = cache_.find(l);
+            entry_type const e = find_entry(l);
+            if (!e)
+            {
+                return;
+            }
+
+            // Update CLOCK meta data.
+            e->referenced_.store(true, std::memory_order_relaxed);
 
-            if (ct != cache_.end())
+            // Return the connection back to the cache only if the number of
+            // connections does not need to be shrunk.
+            if (e->num_existing_.load(std::memory_order_relaxed) <=
+                e->max_connections_.load(std::memory_order_relaxed))
             {
-                // Update LRU meta data.
-                key_tracker_.splice(key_tracker_.end(), key_tracker_,
-                    lru_reference(ct->second));
-
-                // Return the connection back to the cache only if the number
-                // of connections does not need to be shrunk.
-                if (num_existing_connections(ct->second) <=
-                    max_num_connections(ct->second))
-                {
-                    // Add the connection to the entry.
-                    cached_connections(ct->second).push_back(conn);
+                // Add the connection to the entry.
+                e->connections_.push(conn);
 
-                    ++reclaims_;
+                ++reclaims_;
 
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
-                    conn->set_state(Connection::state_reclaimed);
+                conn->set_state(Connection::state_reclaimed);
 #endif
-                }
-                else
-                {
-                    // Adjust the number of existing connections for this key.
-                    decrement_connection_count(ct->second);
+            }
+            else
+            {
+                // Adjust the number of existing connections for this key.
+                decrement_connection_count(*e);
 
-                    // do the accounting
-                    ++evictions_;
+                // do the accounting
+                ++evictions_;
 
-                    // the connection itself will go out of scope on return
+                // the connection itself will go out of scope on return
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
-                    conn->set_state(Connection::state_deleting);
+                conn->set_state(Connection::state_deleting);
 #endif
-                }
-
-                // FIXME: Again, this should probably throw instead of asserting,
-                // as invariants could be invalidated here due to caller error.
-                check_invariants();
             }
         }
 
@@ -391,26 +402,23 @@ namespace hpx::util {
         /// than the maximum number of overall connections, and false otherwise.
         bool full() const
         {
-            std::lock_guard<mutex_type> lock(mtx_);
-            return (connections_ >= max_connections_);
+            return connections_.load(std::memory_order_relaxed) >=
+                max_connections_;
         }
 
         /// Returns true if the connection count for \a l is equal to or larger
         /// than the maximum connection count per locality, and false otherwise.
         bool full(key_type const& l) const
         {
-            std::lock_guard<mutex_type> lock(mtx_);
-
-            if (!cache_.count(l))
-                return false || (connections_ >= max_connections_);
-
-            auto ct = cache_.find(l);
-            if (ct == cache_.end())
-                return false;
+            entry_type const e = find_entry(l);
+            if (!e)
+            {
+                return full();
+            }
 
-            return (num_existing_connections(ct->second) >=
-                       max_num_connections(ct->second)) ||
-                (connections_ >= max_connections_);
+            return (e->num_existing_.load(std::memory_order_relaxed) >=
+                       e->max_connections_.load(std::memory_order_relaxed)) ||
+                full();
         }
 
         /// Destroys all connections in the cache, and resets all counts.
@@ -420,9 +428,20 @@ namespace hpx::util {
         ///       invariants.
         void clear()
         {
-            std::lock_guard<mutex_type> lock(mtx_);
-            key_tracker_.clear();
-            cache_.clear();
+            std::lock_guard<mutex_type> clock_lock(clock_mtx_);
+
+            for (shard& s : shards_)
+            {
+                std::lock_guard<mutex_type> lock(s.mtx_);
+                for (auto& p : s.entries_)
+                {
+                    p.second->removed_.store(true, std::memory_order_relaxed);
+                }
+                s.entries_.clear();
+            }
+
+            clock_.clear();
+            clock_hand_ = 0;
             connections_ = 0;
 
             insertions_ = 0;
@@ -430,10 +449,6 @@ namespace hpx::util {
             hits_ = 0;
             misses_ = 0;
             reclaims_ = 0;
-
-            // FIXME: This should probably throw instead of asserting, as it
-            // can be triggered by caller error.
-            check_invariants();
         }
 
         /// Destroys all connections for the given locality in the cache, reset
@@ -444,41 +459,46 @@ namespace hpx::util {
         ///       invariants.
         void clear(key_type const& l)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
+            entry_type e;
 
-            // Check if this key already exists in the cache.
-            typename cache_type::iterator it = cache_.find(l);
-            if (it != cache_.end())
             {
-                // Remove from LRU meta data.
-                key_tracker_.erase(lru_reference(it->second));
+                shard& s = get_shard(l);
 
-                // correct counter to avoid assertions later on
-                std::size_t num_existing = num_existing_connections(it->second);
-                connections_ -= num_existing;
-                evictions_ += num_existing;
+                // Check if this key already exists in the cache.
+                std::lock_guard<mutex_type> lock(s.mtx_);
+                auto const it = s.entries_.find(l);
+                if (it == s.entries_.end())
+                {
+                    return;
+                }
 
-                // Erase entry if key exists in the cache.
-                cache_.erase(it);
+                e = HPX_MOVE(it->second);
+                s.entries_.erase(it);
             }
 
-            // FIXME: This should probably throw instead of asserting, as it
-            // can be triggered by caller error.
-            check_invariants();
+            // The entry is removed from the CLOCK meta data lazily during
+            // the next eviction.
+            e->removed_.store(true, std::memory_order_relaxed);
+
+            // correct counter to avoid assertions later on
+            std::size_t const num_existing = e->num_existing_.exchange(0);
+            connections_ -= num_existing;
+            evictions_ += static_cast<std::int64_t>(num_existing);
+
+            // release the cached connections right away
+            e->connections_.consume_all([](connection_type const&) {});
         }
 
         /// Destroys all connections for the given locality in the cache, reset
         /// all associated counts.
         void clear(key_type const& l, connection_type const& conn)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
-
             // Check if this key already exists in the cache.
-            typename cache_type::iterator const it = cache_.find(l);
-            if (it != cache_.end())
+            entry_type const e = find_entry(l);
+            if (e)
             {
                 // Adjust the number of existing connections for this key.
-                decrement_connection_count(it->second);
+                decrement_connection_count(*e);
 
                 // do the accounting
                 ++evictions_;
@@ -490,154 +510,164 @@ namespace hpx::util {
                 HPX_UNUSED(conn);
 #endif
             }
-
-            check_invariants();
         }
 
         // access statistics
         std::int64_t get_cache_insertions(bool reset)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
             return util::get_and_reset_value(insertions_, reset);
         }
 
         std::int64_t get_cache_evictions(bool reset)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
             return util::get_and_reset_value(evictions_, reset);
         }
 
         std::int64_t get_cache_hits(bool reset)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
             return util::get_and_reset_value(hits_, reset);
         }
 
         std::int64_t get_cache_misses(bool reset)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
             return util::get_and_reset_value(misses_, reset);
         }
 
         std::int64_t get_cache_reclaims(bool reset)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
             return util::get_and_reset_value(reclaims_, reset);
         }
 
     private:
-        /// Verify class invariants
-        void check_invariants() const
+        // Remove the entry at the given position from the CLOCK meta data,
+        // the entry moved into its place is inspected next.
+        void remove_from_clock(std::size_t pos)
         {
-#if defined(HPX_DEBUG)
-            using const_iterator = typename cache_type::const_iterator;
-
-            size_type in_cache_count = 0, total_count = 0;
-            const_iterator end = cache_.end();
-            for (const_iterator ct = cache_.begin(); ct != end; ++ct)
+            if (pos != clock_.size() - 1)
             {
-                cache_value_type const& val = ct->second;
-
-                std::size_t num_connections = cached_connections(val).size();
-                std::size_t num_existing = num_existing_connections(val);
+                clock_[pos] = HPX_MOVE(clock_.back());
+            }
+            clock_.pop_back();
+        }
 
-                // The separate item counter has to properly count all the
-                // existing elements, not only those in the cache entry.
-                HPX_ASSERT(num_connections <= num_existing);
+        // Remove an entry without any connections from its shard. This fails
+        // if any other thread currently refers to the entry.
+        bool try_remove_entry(entry_type const& e)
+        {
+            shard& s = get_shard(e->key_);
 
-                // Count all connections (both those in the cache and those
-                // checked out of the cache).
-                in_cache_count += num_connections;
-                total_count += num_existing;
+            std::lock_guard<mutex_type> lock(s.mtx_);
+            auto const it = s.entries_.find(e->key_);
+            if (it == s.entries_.end() || it->second != e)
+            {
+                return false;
             }
 
-            // Overall connection count should be larger than or equal to the
-            // number of entries in the cache.
-            HPX_ASSERT(in_cache_count <= connections_);
-
-            // Overall connection count should be equal to the sum of connection
-            // counts for all localities.
-            HPX_ASSERT(total_count == connections_);
+            // the entry is referenced by the shard and the CLOCK meta data
+            // only, no other thread can access it anymore
+            if (e.use_count() != 2 ||
+                e->num_existing_.load(std::memory_order_relaxed) != 0)
+            {
+                return false;
+            }
 
-            // The list of key trackers should have the same size as the cache.
-            HPX_ASSERT(key_tracker_.size() == cache_.size());
-#endif
+            e->removed_.store(true, std::memory_order_relaxed);
+            s.entries_.erase(it);
+            return true;
         }
 
-        /// Evict the least recently used removable entry from the cache if the
-        /// cache is full.
+        /// Evict cached connections from the cache if the cache is full. The
+        /// entries are visited in a round robin fashion, entries that were
+        /// accessed since the last visit are skipped once (CLOCK).
         ///
-        /// \returns Returns true if an entry was evicted or if the cache is not
-        ///          full, and false if nothing could be evicted.
+        /// \returns Returns true if enough connections were evicted or if the
+        ///          cache is not full, and false if nothing could be evicted.
         bool free_space()
         {
             // If the cache isn't full, just return true.
-            if (connections_ < max_connections_)
+            if (!full())
                 return true;
 
-            // Find the least recently used key.
-            auto kt = key_tracker_.begin();
-            while (connections_ >= max_connections_)
+            std::lock_guard<mutex_type> lock(clock_mtx_);
+
+            // Visit each entry at most twice, the first visit may just reset
+            // its reference bit.
+            std::size_t steps = 2 * clock_.size();
+            while (full() && steps-- != 0 && !clock_.empty())
             {
-                // Find the least recently used keys data.
-                auto ct = cache_.find(*kt);
-                if (ct == cache_.end())
-                    break;
-
-                // If the entry is empty, ignore it and try the next least
-                // recently used entry.
-                if (cached_connections(ct->second).empty())
+                if (clock_hand_ >= clock_.size())
                 {
-                    // Remove the key if its connection count is zero.
-                    if (0 == num_existing_connections(ct->second))
-                    {
-                        cache_.erase(ct);
-                        key_tracker_.erase(kt);
-                        kt = key_tracker_.begin();
-                    }
-                    else
-                    {
-                        // REVIEW: Should we reorder key_tracker_ to speed up
-                        // the eviction?
-                        ++kt;
-                    }
-
-                    // If we've gone through key_tracker_ and haven't found
-                    // anything evict-able, then all the entries must be
-                    // currently checked out.
-                    if (key_tracker_.end() == kt)
-                        return false;
+                    clock_hand_ = 0;
+                }
 
+                // note: the entry is accessed by reference to not affect the
+                // reference count checked in try_remove_entry
+                entry_type const& e = clock_[clock_hand_];
+                if (e->removed_.load(std::memory_order_relaxed))
+                {
+                    remove_from_clock(clock_hand_);
                     continue;
                 }
 
-                // Remove the oldest connection.
-                cached_connections(ct->second).pop_front();
+                // Give recently used entries a second chance.
+                if (e->referenced_.exchange(false, std::memory_order_relaxed))
+                {
+                    ++clock_hand_;
+                    continue;
+                }
 
-                // Adjust the overall and per-locality connection count.
-                decrement_connection_count(ct->second);
+                // Remove one of the cached connections.
+                connection_type conn;
+                if (e->connections_.pop(conn))
+                {
+                    // Adjust the overall and per-locality connection count.
+                    decrement_connection_count(*e);
 
-                // Statistics
-                ++evictions_;
+                    // Statistics
+                    ++evictions_;
+
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+                    conn->set_state(Connection::state_deleting);
+#endif
+                    ++clock_hand_;
+                    continue;
+                }
+
+                // Remove the key if its connection count is zero.
+                if (e->num_existing_.load(std::memory_order_relaxed) == 0 &&
+                    try_remove_entry(e))
+                {
+                    remove_from_clock(clock_hand_);
+                    continue;
+                }
+
+                // All connections of this entry are currently checked out.
+                ++clock_hand_;
             }
 
-            return true;
+            return !full();
         }
 
-        mutable mutex_type mtx_;
         size_type const max_connections_;
         size_type const max_connections_per_locality_;
-        key_tracker_type key_tracker_;
-        cache_type cache_;
-        size_type connections_;
-        bool shutting_down_;
+
+        std::array<util::cache_aligned_data_derived<shard>, num_shards>
+            shards_;
+        std::atomic<size_type> connections_;
+
+        // CLOCK meta data, protected by clock_mtx_
+        mutex_type clock_mtx_;
+        std::vector<entry_type> clock_;
+        std::size_t clock_hand_;
+
+        std::atomic<bool> shutting_down_;
 
         // statistics support
-        std::int64_t insertions_;
-        std::int64_t evictions_;
-        std::int64_t hits_;
-        std::int64_t misses_;
-        std::int64_t reclaims_;
+        std::atomic<std::int64_t> insertions_;
+        std::atomic<std::int64_t> evictions_;
+        std::atomic<std::int64_t> hits_;
+        std::atomic<std::int64_t> misses_;
+        std::atomic<std::int64_t> reclaims_;
     };
 }    // namespace hpx::util
 
@@ -16,9 +16,12 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/serialization.hpp>
+#include <hpx/modules/threading_base.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/modules/type_support.hpp>
 
 #include <hpx/components_base/agas_interface.hpp>
+#include <hpx/parcelset/detail/compact_encoding.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/parcel_route_handler.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
@@ -261,16 +264,72 @@ namespace hpx::parcelset {
         }
     }
 
+    // Hand the received parcels over to the default thread pool. A single new
+    // thread on that pool schedules all of the parcels at once. Scheduling a
+    // parcel registers the thread executing its action with the pool of the
+    // scheduling thread, thus all action threads end up on the default pool
+    // without creating an additional thread for each of the parcels.
+    inline void handoff_received_parcels(
+        std::vector<parcelset::parcel>&& deferred_parcels)
+    {
+        if (HPX_UNLIKELY(deferred_parcels.empty()))
+        {
+            return;
+        }
+
+        auto f = [](std::vector<parcelset::parcel>&& parcels) {
+            for (parcelset::parcel& p : parcels)
+            {
+                LPT_(debug).format("handoff_received_parcels: received: {}",
+                    p.parcel_id());
+
+                if (p.schedule_action(static_cast<std::size_t>(-1)))
+                {
+                    // route this parcel as the object was migrated
+                    agas::route(HPX_MOVE(p),
+                        &parcelset::detail::parcel_route_handler,
+                        threads::thread_priority::normal);
+                }
+            }
+        };
+
+        hpx::threads::thread_init_data init_data(
+            hpx::threads::make_thread_function_nullary(util::deferred_call(
+                HPX_MOVE(f), HPX_MOVE(deferred_parcels))),
+            "handoff_received_parcels", threads::thread_priority::boost,
+            threads::thread_schedule_hint(),
+            threads::thread_stacksize::default_,
+            threads::thread_schedule_state::pending, true);
+        hpx::threads::register_thread(
+            init_data, &hpx::resource::get_thread_pool(0));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
+    // If defer_scheduling is set, none of the decoded parcels is scheduled,
+    // they are all returned to the caller instead.
     template <typename Parcelport, typename Buffer>
     std::vector<parcelset::parcel> decode_message_with_chunks(
         serialization::input_archive& archive, [[maybe_unused]] Parcelport& pp,
         [[maybe_unused]] Buffer& buffer, std::size_t parcel_count,
-        std::size_t num_thread = -1)
+        std::size_t num_thread = -1, bool defer_scheduling = false)
     {
         bool const allow_zero_copy_receive =
             archive.try_get_extra_data<
                 serialization::detail::allow_zero_copy_receive>() != nullptr;
+        bool const defer_all = allow_zero_copy_receive || defer_scheduling;
+
+        // let large arrays be received into the memory supplied by the
+        // registered allocator (if any)
+        if (auto const alloc = serialization::get_zero_copy_receive_allocator())
+        {
+            archive
+                .get_extra_data<serialization::zero_copy_receive_allocator>() =
+                alloc;
+        }
+
+        // the ids of polymorphic types are sent instead of their names
+        archive
+            .get_extra_data<serialization::detail::use_polymorphic_type_ids>();
 
         // protect from unhandled exceptions bubbling up
         try
@@ -288,9 +347,17 @@ namespace hpx::parcelset {
                 // De-serialize the parcel data
                 if (parcel_count == 0)
                 {
-                    archive >> parcel_count;    //-V128
+                    if (archive.compact_parcel_header())
+                    {
+                        parcel_count = static_cast<std::size_t>(
+                            detail::load_varint(archive));
+                    }
+                    else
+                    {
+                        archive >> parcel_count;    //-V128
+                    }
                 }
-                if (parcel_count > 1 || allow_zero_copy_receive)
+                if (parcel_count > 1 || defer_all)
                 {
                     deferred_parcels.reserve(parcel_count);
                 }
@@ -312,8 +379,17 @@ namespace hpx::parcelset {
                     // be loaded is a non direct action. If we only got one
                     // parcel to decode, deferred_schedule will be preset to
                     // false and the direct action will be called directly
-                    bool const migrated =
-                        p.load_schedule(archive, num_thread, deferred_schedule);
+                    bool migrated = false;
+                    if (defer_scheduling)
+                    {
+                        // migrated objects are handled while scheduling
+                        archive >> p;
+                    }
+                    else
+                    {
+                        migrated = p.load_schedule(
+                            archive, num_thread, deferred_schedule);
+                    }
 
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                     std::int64_t const add_parcel_time =
@@ -351,7 +427,7 @@ namespace hpx::parcelset {
                             &parcelset::detail::parcel_route_handler,
                             threads::thread_priority::normal);
                     }
-                    else if (deferred_schedule || allow_zero_copy_receive)
+                    else if (deferred_schedule || defer_all)
                     {
                         // store parcel if needed
                         deferred_parcels.emplace_back(HPX_MOVE(p));
@@ -454,6 +530,63 @@ namespace hpx::parcelset {
         return decode_message(parcelport, HPX_MOVE(buffer), 0, num_thread);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // De-serialize the parcels of the given message and schedule them. If the
+    // parcelport was configured to use a decode pool (see
+    // hpx.parcel.decode_pool), the message is de-serialized on a new thread on
+    // that pool and the decoded parcels are handed over to the default pool
+    // at once. Otherwise the message is de-serialized right away. The given
+    // data (if any) holds memory referred to by the buffer, it is kept alive
+    // until the message was de-serialized.
+    template <typename Parcelport, typename Buffer, typename... Ts>
+    void decode_and_handle_parcels(Parcelport& pp, Buffer buffer,
+        std::size_t num_thread = -1, Ts&&... data)
+    {
+        threads::thread_pool_base* pool = pp.get_decode_pool();
+        if (pool == nullptr)
+        {
+            handle_received_parcels(
+                decode_parcels(pp, HPX_MOVE(buffer), num_thread), num_thread);
+            return;
+        }
+
+        auto f = [&pp, enqueued = hpx::chrono::high_resolution_clock::now()](
+                     Buffer&& buffer, auto&&...) {
+            [[maybe_unused]] std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+
+            std::vector<serialization::serialization_chunk> chunks(
+                decode_chunks(buffer));
+
+            auto const inbound_data_size = static_cast<std::size_t>(
+                static_cast<std::uint64_t>(buffer.data_size_));
+            serialization::input_archive archive(
+                buffer.data_, inbound_data_size, &chunks);
+
+            std::vector<parcelset::parcel> parcels =
+                decode_message_with_chunks(archive, pp, buffer, 0, -1, true);
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            pp.add_decode_operation(static_cast<std::int64_t>(start - enqueued),
+                static_cast<std::int64_t>(
+                    hpx::chrono::high_resolution_clock::now() - start));
+#else
+            HPX_UNUSED(enqueued);
+#endif
+            handoff_received_parcels(HPX_MOVE(parcels));
+        };
+
+        hpx::threads::thread_init_data init_data(
+            hpx::threads::make_thread_function_nullary(
+                util::deferred_call(HPX_MOVE(f), HPX_MOVE(buffer),
+                    HPX_FORWARD(Ts, data)...)),
+            "decode_and_handle_parcels", threads::thread_priority::boost,
+            threads::thread_schedule_hint(),
+            threads::thread_stacksize::default_,
+            threads::thread_schedule_state::pending, true);
+        hpx::threads::register_thread(init_data, pool);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     std::vector<parcelset::parcel> decode_message_with_chunks_zero_copy(
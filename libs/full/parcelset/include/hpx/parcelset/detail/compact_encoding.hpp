@@ -0,0 +1,103 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers for the compact parcel header encoding, which is used if the
+// archive has the serialization::archive_flags::compact_parcel_header flag
+// set (see hpx.parcel.compact_header).
+namespace hpx::parcelset::detail {
+
+    // Store an unsigned integer using as many bytes as needed, seven bits per
+    // byte (LEB128).
+    inline void save_varint(
+        serialization::output_archive& ar, std::uint64_t value)
+    {
+        std::uint8_t buffer[10];
+        std::size_t size = 0;
+        while (value >= 0x80)
+        {
+            buffer[size++] = static_cast<std::uint8_t>(value | 0x80);
+            value >>= 7;
+        }
+        buffer[size++] = static_cast<std::uint8_t>(value);
+
+        ar.save_binary(buffer, size);
+    }
+
+    inline std::uint64_t load_varint(serialization::input_archive& ar)
+    {
+        std::uint64_t value = 0;
+        for (unsigned int shift = 0; shift < 64; shift += 7)
+        {
+            std::uint8_t byte = 0;
+            ar.load_binary(&byte, 1);
+
+            value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80))
+            {
+                return value;
+            }
+        }
+
+        HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+            "parcelset::detail::load_varint",
+            "malformed variable length integer in parcel header");
+    }
+
+    // Store a gid relative to the given (unshifted) locality prefix. The
+    // locality prefix of the gid is omitted if it matches, all remaining bits
+    // are stored as variable length integers.
+    inline void save_compact_gid(serialization::output_archive& ar,
+        naming::gid_type const& gid, std::uint64_t prefix)
+    {
+        std::uint64_t const msb = gid.get_msb();
+        std::uint64_t const gid_prefix =
+            msb >> naming::gid_type::locality_id_shift;
+
+        save_varint(ar, gid_prefix == prefix ? 0 : gid_prefix + 1);
+        save_varint(ar,
+            msb &
+                ~(naming::gid_type::locality_id_mask |
+                    naming::gid_type::is_locked_mask));
+        save_varint(ar, gid.get_lsb());
+    }
+
+    inline void load_compact_gid(serialization::input_archive& ar,
+        naming::gid_type& gid, std::uint64_t prefix)
+    {
+        std::uint64_t gid_prefix = load_varint(ar);
+        gid_prefix = gid_prefix == 0 ? prefix : gid_prefix - 1;
+
+        std::uint64_t const msb = load_varint(ar);
+        std::uint64_t const lsb = load_varint(ar);
+
+        gid = naming::gid_type(
+            (gid_prefix << naming::gid_type::locality_id_shift) |
+                (msb & ~naming::gid_type::locality_id_mask),
+            lsb);
+    }
+
+    // Return the (unshifted) locality prefix of the given gid.
+    constexpr std::uint64_t get_locality_prefix(
+        naming::gid_type const& gid) noexcept
+    {
+        return gid.get_msb() >> naming::gid_type::locality_id_shift;
+    }
+}    // namespace hpx::parcelset::detail
+
+#endif
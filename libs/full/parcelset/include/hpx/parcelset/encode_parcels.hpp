@@ -23,6 +23,7 @@
 #include <hpx/actions_base/basic_action.hpp>
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
 #include <hpx/naming/split_gid.hpp>
+#include <hpx/parcelset/detail/compact_encoding.hpp>
 #include <hpx/parcelset/parcel.hpp>
 #include <hpx/parcelset/parcelset_fwd.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
@@ -210,8 +211,18 @@ namespace hpx::parcelset {
                         archive_flags, &buffer.chunks_, filter.get(),
                         pp.get_zero_copy_serialization_threshold());
 
+                    // all localities agree on the ids of the registered
+                    // polymorphic types, send those instead of the names
+                    archive.get_extra_data<
+                        serialization::detail::use_polymorphic_type_ids>();
+
                     if (num_parcels != static_cast<std::size_t>(-1))
-                        archive << parcels_sent;    //-V128
+                    {
+                        if (archive.compact_parcel_header())
+                            detail::save_varint(archive, parcels_sent);
+                        else
+                            archive << parcels_sent;    //-V128
+                    }
 
                     for (std::size_t i = 0; i != parcels_sent; ++i)
                     {
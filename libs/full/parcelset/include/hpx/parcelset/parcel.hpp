@@ -43,6 +43,10 @@ namespace hpx::parcelset::detail {
         void serialize(serialization::input_archive& ar, unsigned);
         void serialize(serialization::output_archive& ar, unsigned) const;
 
+        // compact encoding, see serialization::archive_flags
+        void load_compact(serialization::input_archive& ar);
+        void save_compact(serialization::output_archive& ar) const;
+
         naming::gid_type source_id_;
         naming::gid_type dest_;
         naming::address addr_;
@@ -347,6 +347,34 @@ namespace hpx::parcelset {
         // the maximum size of zero-copy chunks per message received
         std::int64_t get_zchunks_recv_size_max(
             std::string const& pp_type, bool reset) const;
+
+        // the number of operations reading data from the network
+        std::int64_t get_receive_operation_count(
+            std::string const& pp_type, bool reset) const;
+
+        // the number of messages de-serialized on the decode pool
+        std::int64_t get_decode_count(
+            std::string const& pp_type, bool reset) const;
+
+        // the total time messages were waiting for being de-serialized on the
+        // decode pool (nanoseconds)
+        std::int64_t get_decode_queue_time(
+            std::string const& pp_type, bool reset) const;
+
+        // the total time it took to de-serialize messages on the decode pool
+        // (nanoseconds)
+        std::int64_t get_decode_time(
+            std::string const& pp_type, bool reset) const;
+
+        // the number of times pending parcels of the given lane (high
+        // priority or normal) were dequeued for being sent
+        std::int64_t get_send_queue_count(
+            std::string const& pp_type, bool high_priority, bool reset) const;
+
+        // the total time the oldest of the dequeued parcels of the given lane
+        // was waiting for being sent (nanoseconds)
+        std::int64_t get_send_queue_time(
+            std::string const& pp_type, bool high_priority, bool reset) const;
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -408,6 +436,10 @@ namespace hpx::parcelset {
 
         std::int64_t get_outgoing_queue_length(bool reset) const;
 
+        // the number of times enqueuing an outgoing parcel had to wait for
+        // another thread accessing the same queue
+        std::int64_t get_outgoing_queue_contention(bool reset) const;
+
     protected:
         std::pair<std::shared_ptr<parcelport>, locality>
         find_appropriate_destination(naming::gid_type const& dest_gid);
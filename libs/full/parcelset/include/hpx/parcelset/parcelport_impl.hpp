@@ -22,6 +22,7 @@
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/thread_support.hpp>
 #include <hpx/modules/threading.hpp>
+#include <hpx/modules/timing.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/modules/util.hpp>
 #include <hpx/util/from_string.hpp>
@@ -32,12 +33,15 @@
 #include <hpx/parcelset/encode_parcels.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <initializer_list>
 #include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -184,6 +188,14 @@ namespace hpx::parcelset {
                 archive_flags_ = archive_flags_ |
                     serialization::archive_flags::disable_receive_data_chunking;
             }
+
+            // the receiving end decodes the parcel headers based on the flags
+            // transmitted with each message
+            if (this->compact_parcel_header())
+            {
+                archive_flags_ = archive_flags_ |
+                    serialization::archive_flags::compact_parcel_header;
+            }
         }
 
         parcelport_impl(parcelport_impl const&) = delete;
@@ -194,6 +206,7 @@ namespace hpx::parcelset {
         ~parcelport_impl() override
         {
             connection_cache_.clear();
+            high_priority_connections_.clear();
         }
 
         bool can_bootstrap() const override
@@ -204,6 +217,9 @@ namespace hpx::parcelset {
 
         bool run(bool blocking = true) override
         {
+            // reject an invalid decode pool before any message is received
+            this->init_decode_pool();
+
             io_service_pool_.run(false);    // start pool
 
             bool const success = connection_handler().do_run();
@@ -271,8 +287,9 @@ namespace hpx::parcelset {
                     else
                     {
                         // enqueue the outgoing parcel ...
+                        bool const high_priority = is_high_priority_parcel(p);
                         enqueue_parcel(dest, HPX_MOVE(p), HPX_MOVE(f));
-                        get_connection_and_send_parcels(dest);
+                        get_connection_and_send_parcels(dest, high_priority);
                     }
                 });
         }
@@ -313,9 +330,14 @@ namespace hpx::parcelset {
                     }
                     else
                     {
+                        bool const high_priority = priority_lanes() &&
+                            std::any_of(parcels.begin(), parcels.end(),
+                                [this](parcel const& p) {
+                                    return is_high_priority_parcel(p);
+                                });
                         enqueue_parcels(
                             dest, HPX_MOVE(parcels), HPX_MOVE(handlers));
-                        get_connection_and_send_parcels(dest);
+                        get_connection_and_send_parcels(dest, high_priority);
                     }
                 });
         }
@@ -399,6 +421,7 @@ namespace hpx::parcelset {
             }
 
             connection_cache_.clear(loc);
+            clear_high_priority_connection(loc);
         }
 
         void remove_from_connection_cache(locality const& loc) override
@@ -709,39 +732,44 @@ namespace hpx::parcelset {
         {
             using mapped_type = pending_parcels_map::mapped_type;
 
-            std::unique_lock const l(mtx_);
+            pending_parcels_shard& shard =
+                get_pending_parcels_shard(locality_id);
+            bool const high_priority = is_high_priority_parcel(p);
+
+            std::unique_lock const l = lock_pending_parcels_shard(shard);
 
             [[maybe_unused]] util::ignore_while_checking il(&l);
 
-            mapped_type& e = pending_parcels_[locality_id];
+            mapped_type& e =
+                shard.get_pending_parcels(high_priority)[locality_id];
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            if (hpx::get<0>(e).empty())
+            {
+                hpx::get<2>(e) = hpx::chrono::high_resolution_clock::now();
+            }
+#endif
             hpx::get<0>(e).push_back(HPX_MOVE(p));
             hpx::get<1>(e).push_back(HPX_MOVE(f));
 
             ++num_parcel_destinations_;
-            if (!parcel_destinations_.insert(locality_id).second)
+            if (!shard.parcel_destinations_.insert(locality_id).second)
             {
                 --num_parcel_destinations_;
             }
         }
 
-        void enqueue_parcels(locality const& locality_id,
-            std::vector<parcel>&& parcels,
-            std::vector<write_handler_type>&& handlers)
+        static void append_pending_parcels(
+            pending_parcels_map::mapped_type& e, std::vector<parcel>& parcels,
+            std::vector<write_handler_type>& handlers)
         {
-            using mapped_type = pending_parcels_map::mapped_type;
-
-            std::unique_lock const l(mtx_);
-
-            [[maybe_unused]] util::ignore_while_checking il(&l);
-
-            HPX_ASSERT(parcels.size() == handlers.size());
-
-            mapped_type& e = pending_parcels_[locality_id];
             if (hpx::get<0>(e).empty())
             {
                 HPX_ASSERT(hpx::get<1>(e).empty());
                 std::swap(hpx::get<0>(e), parcels);
                 std::swap(hpx::get<1>(e), handlers);
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                hpx::get<2>(e) = hpx::chrono::high_resolution_clock::now();
+#endif
             }
             else
             {
@@ -756,9 +784,62 @@ namespace hpx::parcelset {
                 std::move(handlers.begin(), handlers.end(),
                     std::back_inserter(hpx::get<1>(e)));
             }
+        }
+
+        void enqueue_parcels(locality const& locality_id,
+            std::vector<parcel>&& parcels,
+            std::vector<write_handler_type>&& handlers)
+        {
+            HPX_ASSERT(parcels.size() == handlers.size());
+
+            // move the parcels of high priority actions to their own lane
+            std::vector<parcel> high_priority_parcels;
+            std::vector<write_handler_type> high_priority_handlers;
+            if (priority_lanes())
+            {
+                std::size_t j = 0;
+                for (std::size_t i = 0; i != parcels.size(); ++i)
+                {
+                    if (is_high_priority_parcel(parcels[i]))
+                    {
+                        high_priority_parcels.push_back(HPX_MOVE(parcels[i]));
+                        high_priority_handlers.push_back(
+                            HPX_MOVE(handlers[i]));
+                    }
+                    else
+                    {
+                        if (i != j)
+                        {
+                            parcels[j] = HPX_MOVE(parcels[i]);
+                            handlers[j] = HPX_MOVE(handlers[i]);
+                        }
+                        ++j;
+                    }
+                }
+                parcels.erase(parcels.begin() + j, parcels.end());
+                handlers.erase(handlers.begin() + j, handlers.end());
+            }
+
+            pending_parcels_shard& shard =
+                get_pending_parcels_shard(locality_id);
+            std::unique_lock const l = lock_pending_parcels_shard(shard);
+
+            [[maybe_unused]] util::ignore_while_checking il(&l);
+
+            if (!high_priority_parcels.empty())
+            {
+                append_pending_parcels(
+                    shard.high_priority_parcels_[locality_id],
+                    high_priority_parcels, high_priority_handlers);
+            }
+            if (!parcels.empty())
+            {
+                append_pending_parcels(shard.pending_parcels_[locality_id],
+                    parcels, handlers);
+            }
 
             ++num_parcel_destinations_;
-            if (!parcel_destinations_.insert(locality_id).second)
+            if (!shard.parcel_destinations_.insert(locality_id).second)
             {
                 --num_parcel_destinations_;
             }
@@ -768,34 +849,61 @@ namespace hpx::parcelset {
             std::vector<parcel>& parcels,
             std::vector<write_handler_type>& handlers)
         {
-            std::unique_lock const l(mtx_, std::try_to_lock);
+            pending_parcels_shard& shard =
+                get_pending_parcels_shard(locality_id);
+
+            std::unique_lock const l(shard.mtx_, std::try_to_lock);
             if (!l.owns_lock())
                 return false;
 
-            auto const it = pending_parcels_.find(locality_id);
-
-            // do nothing if parcels have already been picked up by another
-            // thread
-            if (it != pending_parcels_.end() &&
-                !hpx::get<0>(it->second).empty())
+            // parcels of high priority actions are sent first, without
+            // waiting for the other pending parcels
+            bool high_priority = true;
+            auto it = shard.high_priority_parcels_.find(locality_id);
+            if (it == shard.high_priority_parcels_.end() ||
+                hpx::get<0>(it->second).empty())
             {
-                HPX_ASSERT(it->first == locality_id);
-                HPX_ASSERT(handlers.empty());
-                HPX_ASSERT(handlers.size() == parcels.size());
-                std::swap(parcels, hpx::get<0>(it->second));
-                HPX_ASSERT(hpx::get<0>(it->second).empty());
-                std::swap(handlers, hpx::get<1>(it->second));
-                HPX_ASSERT(handlers.size() == parcels.size());
-
-                HPX_ASSERT(!handlers.empty());
+                high_priority = false;
+                it = shard.pending_parcels_.find(locality_id);
+
+                // do nothing if parcels have already been picked up by
+                // another thread
+                if (it == shard.pending_parcels_.end() ||
+                    hpx::get<0>(it->second).empty())
+                {
+                    HPX_ASSERT(it == shard.pending_parcels_.end() ||
+                        hpx::get<1>(it->second).empty());
+                    return false;
+                }
             }
-            else
+
+            HPX_ASSERT(it->first == locality_id);
+            HPX_ASSERT(handlers.empty());
+            HPX_ASSERT(handlers.size() == parcels.size());
+            std::swap(parcels, hpx::get<0>(it->second));
+            HPX_ASSERT(hpx::get<0>(it->second).empty());
+            std::swap(handlers, hpx::get<1>(it->second));
+            HPX_ASSERT(handlers.size() == parcels.size());
+
+            HPX_ASSERT(!handlers.empty());
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            add_send_queue_time(high_priority,
+                static_cast<std::int64_t>(
+                    hpx::chrono::high_resolution_clock::now() -
+                    hpx::get<2>(it->second)));
+#else
+            HPX_UNUSED(high_priority);
+#endif
+
+            // the destination stays registered as long as parcels are
+            // pending in any of the lanes
+            if (shard.has_pending_parcels(locality_id))
             {
-                HPX_ASSERT(hpx::get<1>(it->second).empty());
-                return false;
+                return true;
             }
 
-            parcel_destinations_.erase(locality_id);
+            shard.parcel_destinations_.erase(locality_id);
 
             HPX_ASSERT(
                 0 != num_parcel_destinations_.load(std::memory_order_relaxed));
@@ -808,27 +916,36 @@ namespace hpx::parcelset {
         bool dequeue_parcel(
             locality& dest, parcel& p, write_handler_type& handler)
         {
-            std::unique_lock const l(mtx_, std::try_to_lock);
-            if (!l.owns_lock())
-                return false;
-
-            for (auto& pending : pending_parcels_)
+            for (std::size_t i = 0; i != num_pending_parcels_shards_; ++i)
             {
-                auto& parcels = hpx::get<0>(pending.second);
-                if (!parcels.empty())
+                pending_parcels_shard& shard = pending_parcels_shards_[i];
+
+                std::unique_lock const l(shard.mtx_, std::try_to_lock);
+                if (!l.owns_lock())
+                    continue;
+
+                for (auto* lane :
+                    {&shard.high_priority_parcels_, &shard.pending_parcels_})
                 {
-                    auto& handlers = hpx::get<1>(pending.second);
-                    dest = pending.first;
-                    p = HPX_MOVE(parcels.back());
-                    parcels.pop_back();
-                    handler = HPX_MOVE(handlers.back());
-                    handlers.pop_back();
-
-                    if (parcels.empty())
+                    for (auto& pending : *lane)
                     {
-                        pending_parcels_.erase(dest);
+                        auto& parcels = hpx::get<0>(pending.second);
+                        if (!parcels.empty())
+                        {
+                            auto& handlers = hpx::get<1>(pending.second);
+                            dest = pending.first;
+                            p = HPX_MOVE(parcels.back());
+                            parcels.pop_back();
+                            handler = HPX_MOVE(handlers.back());
+                            handlers.pop_back();
+
+                            if (parcels.empty())
+                            {
+                                lane->erase(dest);
+                            }
+                            return true;
+                        }
                     }
-                    return true;
                 }
             }
             return false;
@@ -841,19 +958,17 @@ namespace hpx::parcelset {
 
             std::vector<locality> destinations;
 
+            for (std::size_t i = 0; i != num_pending_parcels_shards_; ++i)
             {
-                std::unique_lock const l(mtx_, std::try_to_lock);
-                if (!l.owns_lock())
-                    return true;
+                pending_parcels_shard& shard = pending_parcels_shards_[i];
 
-                if (parcel_destinations_.empty())
-                    return true;
+                std::unique_lock const l(shard.mtx_, std::try_to_lock);
+                if (!l.owns_lock() || shard.parcel_destinations_.empty())
+                    continue;
 
-                destinations.reserve(parcel_destinations_.size());
-                for (locality const& loc : parcel_destinations_)
-                {
-                    destinations.push_back(loc);
-                }
+                destinations.insert(destinations.end(),
+                    shard.parcel_destinations_.begin(),
+                    shard.parcel_destinations_.end());
             }
 
             // Create new HPX threads which send the parcels that are still
@@ -868,8 +983,111 @@ namespace hpx::parcelset {
 
     private:
         ///////////////////////////////////////////////////////////////////////
+        // Get the connection dedicated to sending high priority parcels to
+        // the given destination, create it if necessary. Return an empty
+        // pointer if the connection is currently in use.
+        std::shared_ptr<connection> get_high_priority_connection(
+            locality const& l, error_code& ec)
+        {
+            {
+                std::lock_guard lk(high_priority_connections_mtx_);
+
+                high_priority_connection& c = high_priority_connections_[l];
+                if (c.in_use_)
+                {
+                    if (&ec != &throws)
+                        ec = make_success_code();
+                    return {};
+                }
+
+                c.in_use_ = true;
+                if (c.connection_)
+                {
+                    if (&ec != &throws)
+                        ec = make_success_code();
+                    return c.connection_;
+                }
+            }
+
+            // the connection is created without holding the lock
+            std::shared_ptr<connection> sender_connection =
+                connection_handler().create_connection(l, ec);
+
+            std::lock_guard lk(high_priority_connections_mtx_);
+
+            high_priority_connection& c = high_priority_connections_[l];
+            if (!sender_connection || ec)
+            {
+                c.in_use_ = false;
+                return {};
+            }
+
+            c.connection_ = sender_connection;
+            return sender_connection;
+        }
+
+        // Mark the connection dedicated to high priority parcels as not being
+        // in use anymore (and drop it if 'reuse' is false). Return false if
+        // the given connection is not the dedicated one, i.e. if it belongs
+        // to the connection cache.
+        bool release_high_priority_connection(locality const& l,
+            std::shared_ptr<connection> const& sender_connection, bool reuse)
+        {
+            std::lock_guard lk(high_priority_connections_mtx_);
+
+            auto const it = high_priority_connections_.find(l);
+            if (it == high_priority_connections_.end() ||
+                it->second.connection_ != sender_connection)
+            {
+                return false;
+            }
+
+            it->second.in_use_ = false;
+            if (!reuse || it->second.discard_)
+            {
+                high_priority_connections_.erase(it);
+            }
+            return true;
+        }
+
+        void clear_high_priority_connection(locality const& l)
+        {
+            std::lock_guard lk(high_priority_connections_mtx_);
+
+            auto const it = high_priority_connections_.find(l);
+            if (it != high_priority_connections_.end())
+            {
+                if (it->second.in_use_)
+                {
+                    // drop the connection as soon as it is released
+                    it->second.discard_ = true;
+                }
+                else
+                {
+                    high_priority_connections_.erase(it);
+                }
+            }
+        }
+
+        // Give a connection back to the connection cache, or release it if
+        // it is the one dedicated to high priority parcels.
+        void reclaim_connection(locality const& l,
+            std::shared_ptr<connection> const& sender_connection)
+        {
+            if (!release_high_priority_connection(l, sender_connection, true))
+            {
+                connection_cache_.reclaim(l, sender_connection);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Parcels of high priority actions don't have to wait for one of the
+        // connections sending other parcels to be returned if all cached
+        // connections are in use. They are sent through one additional
+        // connection per destination instead, which is kept outside of the
+        // connection cache and is reused for later high priority parcels.
         void get_connection_and_send_parcels(
-            locality const& locality_id, bool /* background */ = false)
+            locality const& locality_id, bool high_priority = false)
         {
             if (connection_handler_traits<
                     ConnectionHandler>::send_immediate_parcels::value &&
@@ -887,6 +1105,12 @@ namespace hpx::parcelset {
             std::shared_ptr<connection> sender_connection =
                 get_connection(locality_id, force_connection, ec);
 
+            if (!sender_connection && high_priority && !ec)
+            {
+                sender_connection =
+                    get_high_priority_connection(locality_id, ec);
+            }
+
             if (!sender_connection)
             {
                 // We can safely return if no connection is available at this
@@ -903,7 +1127,7 @@ namespace hpx::parcelset {
             {
                 // Give this connection back to the cache as we couldn't dequeue
                 // parcels.
-                connection_cache_.reclaim(locality_id, sender_connection);
+                reclaim_connection(locality_id, sender_connection);
             }
             else
             {
@@ -927,21 +1151,22 @@ namespace hpx::parcelset {
             {
                 // Give this connection back to the cache as it's not
                 // needed anymore.
-                connection_cache_.reclaim(locality_id, sender_connection);
+                reclaim_connection(locality_id, sender_connection);
             }
-            else
+            else if (!release_high_priority_connection(
+                         locality_id, sender_connection, false))
             {
                 // remove this connection from cache
                 connection_cache_.clear(locality_id, sender_connection);
             }
 
             {
-                std::lock_guard l(mtx_);
+                pending_parcels_shard& shard =
+                    get_pending_parcels_shard(locality_id);
+                std::lock_guard l(shard.mtx_);
 
                 // HPX_ASSERT(locality_id == sender_connection->destination());
-                if (auto const it = pending_parcels_.find(locality_id);
-                    it == pending_parcels_.end() ||
-                    hpx::get<0>(it->second).empty())
+                if (!shard.has_pending_parcels(locality_id))
                 {
                     return;
                 }
@@ -1040,6 +1265,19 @@ namespace hpx::parcelset {
 
         using mutex_type = hpx::spinlock;
 
+        /// The connections dedicated to sending high priority parcels, at
+        /// most one per destination
+        struct high_priority_connection
+        {
+            std::shared_ptr<connection> connection_;
+            bool in_use_ = false;
+            bool discard_ = false;
+        };
+
+        mutex_type high_priority_connections_mtx_;
+        std::map<locality, high_priority_connection>
+            high_priority_connections_;
+
         int archive_flags_;
         hpx::util::atomic_count operations_in_flight_;
 
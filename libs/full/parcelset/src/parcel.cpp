@@ -22,6 +22,7 @@
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/components_base/component_type.hpp>
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
+#include <hpx/parcelset/detail/compact_encoding.hpp>
 #include <hpx/parcelset/parcel.hpp>
 #include <hpx/parcelset/parcelhandler.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
@@ -106,8 +107,90 @@ namespace hpx::parcelset::detail {
         return *this;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The compact header starts with a byte holding the flags below, fields
+    // that hold their default value are omitted. All integers are stored as
+    // variable length integers, the gids are stored relative to the locality
+    // prefix of the destination address.
+    namespace {
+
+        constexpr std::uint8_t has_continuation_flag = 0x01;
+        constexpr std::uint8_t has_source_id_flag = 0x02;
+        constexpr std::uint8_t has_destination_flag = 0x04;
+    }    // namespace
+
+    void parcel_data::load_compact(serialization::input_archive& ar)
+    {
+        std::uint8_t flags = 0;
+        ar.load_binary(&flags, 1);
+
+        load_compact_gid(ar, addr_.locality_, 0);
+        std::uint64_t const prefix = get_locality_prefix(addr_.locality_);
+
+        if (flags & has_destination_flag)
+            load_compact_gid(ar, dest_, prefix);
+        else
+            dest_ = naming::invalid_gid;
+
+        if (flags & has_source_id_flag)
+            load_compact_gid(ar, source_id_, prefix);
+        else
+            source_id_ = naming::invalid_gid;
+
+        addr_.type_ = static_cast<naming::component_type>(
+            static_cast<std::int64_t>(load_varint(ar)) - 1);
+        addr_.address_ =
+            reinterpret_cast<naming::address_type>(load_varint(ar));
+
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        ar >> parcel_id_;
+        ar >> start_time_;
+        ar >> creation_time_;
+#endif
+
+        has_continuation_ = (flags & has_continuation_flag) != 0;
+    }
+
+    void parcel_data::save_compact(serialization::output_archive& ar) const
+    {
+        std::uint8_t flags = 0;
+        if (has_continuation_)
+            flags |= has_continuation_flag;
+        if (source_id_ != naming::invalid_gid)
+            flags |= has_source_id_flag;
+        if (dest_ != naming::invalid_gid)
+            flags |= has_destination_flag;
+        ar.save_binary(&flags, 1);
+
+        save_compact_gid(ar, addr_.locality_, 0);
+        std::uint64_t const prefix = get_locality_prefix(addr_.locality_);
+
+        if (flags & has_destination_flag)
+            save_compact_gid(ar, dest_, prefix);
+
+        if (flags & has_source_id_flag)
+            save_compact_gid(ar, source_id_, prefix);
+
+        save_varint(ar,
+            static_cast<std::uint64_t>(
+                static_cast<std::int64_t>(addr_.type_) + 1));
+        save_varint(ar, reinterpret_cast<std::size_t>(addr_.address_));
+
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        ar << parcel_id_;
+        ar << start_time_;
+        ar << creation_time_;
+#endif
+    }
+
     void parcel_data::serialize(serialization::input_archive& ar, unsigned)
     {
+        if (ar.compact_parcel_header())
+        {
+            load_compact(ar);
+            return;
+        }
+
         ar >> source_id_;
         ar >> dest_;
         ar >> addr_;
@@ -124,6 +207,12 @@ namespace hpx::parcelset::detail {
     void parcel_data::serialize(
         serialization::output_archive& ar, unsigned) const
     {
+        if (ar.compact_parcel_header())
+        {
+            save_compact(ar);
+            return;
+        }
+
         ar << source_id_;
         ar << dest_;
         ar << addr_;
@@ -515,7 +604,14 @@ namespace hpx::parcelset::detail {
         ar >> data_;
 
         std::uint32_t id;
-        ar >> id;
+        if (ar.compact_parcel_header())
+        {
+            id = static_cast<std::uint32_t>(load_varint(ar));
+        }
+        else
+        {
+            ar >> id;
+        }
 
 #if !defined(HPX_DEBUG)
         action_.reset(action_registry::create(id, data_.has_continuation_));
@@ -539,7 +635,14 @@ namespace hpx::parcelset::detail {
         ar << data_;
 
         std::uint32_t const id = action_->get_action_id();
-        ar << id;
+        if (ar.compact_parcel_header())
+        {
+            save_varint(ar, id);
+        }
+        else
+        {
+            ar << id;
+        }
 
 #if defined(HPX_DEBUG)
         std::string const name(action_->get_action_name());
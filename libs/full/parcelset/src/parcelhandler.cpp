@@ -31,6 +31,7 @@
 #include <hpx/modules/util.hpp>
 #include <hpx/util/from_string.hpp>
 
+#include <hpx/actions_base/detail/direct_execution_statistics.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/naming_base/gid_type.hpp>
 #include <hpx/parcelset/init_parcelports.hpp>
@@ -98,6 +99,13 @@ namespace hpx::parcelset {
 #endif
     {
         LPROGRESS_;
+
+        // configure the heuristics executing cheap actions directly on the
+        // thread that has received the parcel
+        actions::detail::direct_execution_statistics::set_threshold(
+            util::get_entry_as<std::int64_t>(cfg,
+                "hpx.parcel.direct_execution_threshold",
+                HPX_PARCEL_DIRECT_EXECUTION_THRESHOLD));
     }
 
     parcelhandler::~parcelhandler() = default;
@@ -901,6 +909,17 @@ namespace hpx::parcelset {
         return parcel_count;
     }
 
+    std::int64_t parcelhandler::get_outgoing_queue_contention(bool reset) const
+    {
+        std::int64_t contention_count = 0;
+        for (pports_type::value_type const& pp : pports_)
+        {
+            contention_count +=
+                pp.second->get_pending_parcels_contention_count(reset);
+        }
+        return contention_count;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // default callback for put_parcel
     void default_write_handler(std::error_code const& ec, parcel const& p)
@@ -1263,6 +1282,60 @@ namespace hpx::parcelset {
         return pp ? pp->get_zchunks_recv_size_max(reset) : 0;
     }
 
+    // the number of operations reading data from the network
+    std::int64_t parcelhandler::get_receive_operation_count(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_receive_operation_count(reset) : 0;
+    }
+
+    // the number of messages de-serialized on the decode pool
+    std::int64_t parcelhandler::get_decode_count(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_decode_count(reset) : 0;
+    }
+
+    // the total time messages were waiting for being de-serialized
+    std::int64_t parcelhandler::get_decode_queue_time(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_decode_queue_time(reset) : 0;
+    }
+
+    // the total time it took to de-serialize messages on the decode pool
+    std::int64_t parcelhandler::get_decode_time(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_decode_time(reset) : 0;
+    }
+
+    // the number of times pending parcels of the given lane were dequeued
+    std::int64_t parcelhandler::get_send_queue_count(
+        std::string const& pp_type, bool high_priority, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_send_queue_count(high_priority, reset) : 0;
+    }
+
+    // the total time the dequeued parcels of the given lane were waiting
+    std::int64_t parcelhandler::get_send_queue_time(
+        std::string const& pp_type, bool high_priority, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_send_queue_time(high_priority, reset) : 0;
+    }
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
@@ -1423,6 +1496,17 @@ namespace hpx::parcelset {
                 HPX_ZERO_COPY_SERIALIZATION_THRESHOLD) "}");
         ini_defs.emplace_back("max_background_threads = "
                               "${HPX_PARCEL_MAX_BACKGROUND_THREADS:-1}");
+        ini_defs.emplace_back("pending_parcels_shards = "
+                              "${HPX_PARCEL_PENDING_PARCELS_SHARDS:16}");
+        ini_defs.emplace_back(
+            "compact_header = ${HPX_PARCEL_COMPACT_HEADER:0}");
+        ini_defs.emplace_back("decode_pool = ${HPX_PARCEL_DECODE_POOL:}");
+        ini_defs.emplace_back(
+            "priority_lanes = ${HPX_PARCEL_PRIORITY_LANES:1}");
+        ini_defs.emplace_back(
+            "direct_execution_threshold = "
+            "${HPX_PARCEL_DIRECT_EXECUTION_THRESHOLD:" HPX_PP_STRINGIZE(
+                HPX_PARCEL_DIRECT_EXECUTION_THRESHOLD) "}");
 
         for (plugins::parcelport_factory_base* f :
             parcelhandler::get_parcelport_factories())
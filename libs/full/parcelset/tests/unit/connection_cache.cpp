@@ -0,0 +1,183 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset/connection_cache.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_connection
+{
+    explicit test_connection(int key)
+      : key_(key)
+    {
+    }
+
+    int key_;
+};
+
+using cache_type = hpx::util::connection_cache<test_connection, int>;
+using connection_type = cache_type::connection_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_get_or_reserve()
+{
+    cache_type cache(8, 2);
+
+    // the first request for a key reserves space for a new connection
+    connection_type conn;
+    HPX_TEST(cache.get_or_reserve(1, conn));
+    HPX_TEST(!conn);
+    HPX_TEST_EQ(cache.get_cache_insertions(false), 1);
+
+    conn = std::make_shared<test_connection>(1);
+    cache.reclaim(1, conn);
+    HPX_TEST_EQ(cache.get_cache_reclaims(false), 1);
+
+    // the reclaimed connection is handed out again
+    connection_type cached;
+    HPX_TEST(cache.get_or_reserve(1, cached));
+    HPX_TEST(cached == conn);
+    HPX_TEST_EQ(cache.get_cache_hits(false), 1);
+
+    // a second connection can be reserved, a third one exceeds the limit
+    // per locality
+    connection_type second;
+    HPX_TEST(cache.get_or_reserve(1, second));
+    HPX_TEST(!second);
+    HPX_TEST(cache.full(1));
+
+    connection_type third;
+    HPX_TEST(!cache.get_or_reserve(1, third));
+    HPX_TEST_EQ(cache.get_cache_misses(false), 1);
+
+    // get() does not reserve any space
+    HPX_TEST(!cache.get(2));
+    HPX_TEST_EQ(cache.get_cache_misses(false), 2);
+
+    cache.reclaim(1, cached);
+    HPX_TEST(cache.get(1) == cached);
+    HPX_TEST_EQ(cache.get_cache_hits(false), 2);
+
+    // the limit per locality is ignored if insertion is forced
+    HPX_TEST(cache.get_or_reserve(1, third, true));
+    HPX_TEST(!third);
+    HPX_TEST_EQ(cache.get_cache_insertions(false), 3);
+
+    // connections exceeding the limit are not cached once returned
+    cache.reclaim(1, cached);
+    HPX_TEST_EQ(cache.get_cache_evictions(false), 1);
+}
+
+void test_eviction()
+{
+    cache_type cache(4, 2);
+
+    // fill the cache with connections to two localities
+    for (int key = 0; key != 2; ++key)
+    {
+        std::vector<connection_type> connections;
+        for (int i = 0; i != 2; ++i)
+        {
+            connection_type conn;
+            HPX_TEST(cache.get_or_reserve(key, conn));
+            HPX_TEST(!conn);
+            connections.push_back(std::make_shared<test_connection>(key));
+        }
+        for (connection_type const& conn : connections)
+        {
+            cache.reclaim(key, conn);
+        }
+    }
+    HPX_TEST(cache.full());
+    HPX_TEST_EQ(cache.get_cache_evictions(false), 0);
+
+    // reserving space for a new locality evicts cached connections
+    connection_type conn;
+    HPX_TEST(cache.get_or_reserve(2, conn));
+    HPX_TEST(!conn);
+    HPX_TEST_EQ(cache.get_cache_evictions(false), 1);
+
+    // removing a locality evicts all of its connections
+    cache.clear(2);
+    HPX_TEST_EQ(cache.get_cache_evictions(false), 2);
+    HPX_TEST(!cache.get(2));
+
+    cache.clear();
+    HPX_TEST(!cache.full());
+    HPX_TEST_EQ(cache.get_cache_evictions(false), 0);
+}
+
+void test_concurrent_access()
+{
+    constexpr int num_keys = 8;
+    constexpr std::size_t num_tasks = 32;
+    constexpr std::size_t num_iterations = 1000;
+
+    cache_type cache(1024, 4);
+    std::atomic<std::int64_t> successful(0);
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async([&, t]() {
+            for (std::size_t i = 0; i != num_iterations; ++i)
+            {
+                int const key = static_cast<int>((t + i) % num_keys);
+
+                connection_type conn;
+                if (!cache.get_or_reserve(key, conn))
+                {
+                    hpx::this_thread::yield();
+                    continue;
+                }
+
+                ++successful;
+                if (!conn)
+                {
+                    conn = std::make_shared<test_connection>(key);
+                }
+                HPX_TEST_EQ(conn->key_, key);
+
+                cache.reclaim(key, conn);
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    // every successful request either was a cache hit or reserved space
+    HPX_TEST_EQ(successful.load(),
+        cache.get_cache_hits(false) + cache.get_cache_insertions(false));
+    HPX_TEST_EQ(successful.load(), cache.get_cache_reclaims(false) +
+            cache.get_cache_evictions(false));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_get_or_reserve();
+    test_eviction();
+    test_concurrent_access();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -25,15 +25,16 @@ constexpr std::size_t numparcels_default = 10;
 
 ///////////////////////////////////////////////////////////////////////////////
 template <typename Action, typename T>
-hpx::parcelset::parcel generate_parcel(
-    hpx::id_type const& dest_id, hpx::id_type const& cont, T&& data)
+hpx::parcelset::parcel generate_parcel(hpx::id_type const& dest_id,
+    hpx::id_type const& cont, T&& data,
+    hpx::launch::async_policy policy = hpx::launch::async)
 {
     hpx::naming::address addr;
     hpx::naming::gid_type dest = dest_id.get_gid();
     hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
         std::move(dest), std::move(addr),
-        hpx::actions::typed_continuation<hpx::id_type>(cont), Action(),
-        hpx::launch::async, std::forward<T>(data)));
+        hpx::actions::typed_continuation<hpx::id_type>(cont), Action(), policy,
+        std::forward<T>(data)));
 
     p.set_source_id(hpx::find_here());
     p.size() = 4096;
@@ -78,6 +79,116 @@ void test_plain_argument(hpx::id_type const& id)
     }
 }
 
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_COUNTERS)
+// sum up the values of all counters matching the given name
+double get_counter_values(char const* name)
+{
+    using namespace hpx::performance_counters;
+
+    double result = 0.0;
+
+    hpx::error_code ec;
+    for (performance_counter const& c : discover_counters(name, ec))
+    {
+        counter_value value = c.get_counter_value(hpx::launch::sync, ec);
+        if (!ec)
+        {
+            result += value.get_value<double>();
+        }
+    }
+    return result;
+}
+
+struct send_queue_counters
+{
+    send_queue_counters()
+      : high_count(get_counter_values("/parcelport/count/*/send-queue/high"))
+      , high_time(get_counter_values("/parcelport/time/*/send-queue/high"))
+      , normal_count(
+            get_counter_values("/parcelport/count/*/send-queue/normal"))
+      , normal_time(get_counter_values("/parcelport/time/*/send-queue/normal"))
+    {
+    }
+
+    double high_count;
+    double high_time;
+    double normal_count;
+    double normal_time;
+};
+#endif
+
+// parcels of high priority actions are sent through a separate lane
+void test_mixed_priorities(hpx::id_type const& id)
+{
+    std::vector<double> data(vsize_default);
+    std::generate(data.begin(), data.end(), std::rand);
+
+    std::vector<hpx::future<hpx::id_type>> results;
+    results.reserve(numparcels_default);
+
+    // create parcels
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        hpx::distributed::promise<hpx::id_type> p;
+        auto f = p.get_future();
+
+        hpx::launch::async_policy const policy(i % 2 == 0 ?
+                hpx::threads::thread_priority::high :
+                hpx::threads::thread_priority::default_);
+
+        hpx::parcelset::parcel parcel =
+            generate_parcel<test1_action>(id, p.get_id(), data, policy);
+        HPX_TEST(parcel.get_thread_priority() == policy.priority());
+
+        parcels.push_back(std::move(parcel));
+        results.push_back(std::move(f));
+    }
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_COUNTERS)
+    send_queue_counters const before;
+#endif
+
+    // send parcels
+    hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
+        std::move(parcels));
+
+    // verify all messages got actually sent to the correct locality
+    hpx::wait_all(results);
+
+    for (hpx::future<hpx::id_type>& f : results)
+    {
+        HPX_TEST_EQ(f.get(), id);
+    }
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_COUNTERS)
+    send_queue_counters const after;
+
+    double const high_count = after.high_count - before.high_count;
+    double const normal_count = after.normal_count - before.normal_count;
+
+    if (hpx::get_config_entry("hpx.parcel.priority_lanes", "1") == "0")
+    {
+        // all parcels are sent through the normal lane
+        HPX_TEST_EQ(high_count, 0.0);
+        HPX_TEST_LT(0.0, normal_count);
+    }
+    else
+    {
+        HPX_TEST_LT(0.0, high_count);
+
+        // the high priority parcels are dequeued before the other parcels
+        // enqueued together with them, i.e. they wait less on average
+        if (normal_count != 0.0)
+        {
+            double const high_time = after.high_time - before.high_time;
+            double const normal_time = after.normal_time - before.normal_time;
+            HPX_TEST_LTE(high_time / high_count, normal_time / normal_count);
+        }
+    }
+#endif
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 hpx::id_type test2(hpx::future<double> const&)
 {
@@ -271,6 +382,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     for (hpx::id_type const& id : hpx::find_remote_localities())
     {
         test_plain_argument(id);
+        test_mixed_priorities(id);
         test_future_argument(id);
         test_mixed_arguments(id);
         test_task_group_argument(id);
@@ -282,6 +394,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
         // compare number of parcels with number of messages generated
         print_counters("/parcels/count/*/sent");
         print_counters("/messages/count/*/sent");
+        print_counters("/parcelport/count/*/send-queue/*");
     }
 #endif
 
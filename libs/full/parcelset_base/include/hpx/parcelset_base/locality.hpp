@@ -14,9 +14,11 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/iterator_support.hpp>
 #include <hpx/modules/serialization.hpp>
+#include <hpx/modules/type_support.hpp>
 
 #include <hpx/parcelset_base/parcelset_base_fwd.hpp>
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
@@ -28,6 +30,12 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::parcelset {
 
+    namespace detail {
+
+        template <typename Impl>
+        using locality_hash_t = decltype(std::declval<Impl const&>().hash());
+    }    // namespace detail
+
     //////////////////////////////////////////////////////////////////////////
     class locality
     {
@@ -41,6 +49,7 @@ namespace hpx::parcelset {
 
             virtual bool equal(impl_base const& rhs) const = 0;
             virtual bool less_than(impl_base const& rhs) const = 0;
+            virtual std::size_t hash() const = 0;
             virtual bool valid() const = 0;
             virtual char const* type() const = 0;
             virtual std::ostream& print(std::ostream& os) const = 0;
@@ -93,6 +102,14 @@ namespace hpx::parcelset {
             return impl_ ? impl_->type() : "";
         }
 
+        // Return a hash value for this locality. All localities whose
+        // implementation does not provide a hash() function share the same
+        // hash value.
+        std::size_t hash() const
+        {
+            return impl_ ? impl_->hash() : 0;
+        }
+
         template <typename Impl>
         Impl& get()
         {
@@ -158,6 +175,19 @@ namespace hpx::parcelset {
                     (type() == rhs.type() && impl_ < rhs.get<Impl>());
             }
 
+            std::size_t hash() const override
+            {
+                if constexpr (hpx::util::is_detected_v<
+                                  detail::locality_hash_t, Impl>)
+                {
+                    return impl_.hash();
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+
             bool valid() const override
             {
                 return !!impl_;
@@ -14,10 +14,12 @@
 
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/io_service/io_service_pool_fwd.hpp>
+#include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/datastructures.hpp>
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/modules/synchronization.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
 
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/gatherer.hpp>
@@ -31,6 +33,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <system_error>
@@ -258,6 +261,30 @@ namespace hpx::parcelset {
 
         //// the maximum size of zero-copy chunks per message received
         std::int64_t get_zchunks_recv_size_max(bool reset);
+
+        //// the number of operations reading data from the network (the
+        //// number of parcels received divided by this value is the average
+        //// number of parcels received per operation)
+        std::int64_t get_receive_operation_count(bool reset);
+
+        //// the number of messages de-serialized on the decode pool
+        std::int64_t get_decode_count(bool reset);
+
+        //// the total time messages were waiting for being de-serialized on
+        //// the decode pool (nanoseconds)
+        std::int64_t get_decode_queue_time(bool reset);
+
+        //// the total time it took to de-serialize messages on the decode
+        //// pool (nanoseconds)
+        std::int64_t get_decode_time(bool reset);
+
+        //// the number of times pending parcels of the given lane (high
+        //// priority or normal) were dequeued for being sent
+        std::int64_t get_send_queue_count(bool high_priority, bool reset);
+
+        //// the total time the oldest of the dequeued parcels of the given
+        //// lane was waiting for being sent (nanoseconds)
+        std::int64_t get_send_queue_time(bool high_priority, bool reset);
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -288,12 +315,24 @@ namespace hpx::parcelset {
 #endif
         std::int64_t get_pending_parcels_count(bool /*reset*/);
 
+        // the number of times enqueuing a parcel had to wait for another
+        // thread accessing the pending parcels of the same shard
+        std::int64_t get_pending_parcels_contention_count(bool reset);
+
         ///////////////////////////////////////////////////////////////////////
         /// Update performance counter data
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
         void add_received_data(parcelset::data_point const& data);
 
         void add_sent_data(parcelset::data_point const& data);
+
+        void add_receive_operation() noexcept;
+
+        void add_decode_operation(
+            std::int64_t queue_time, std::int64_t decode_time) noexcept;
+
+        void add_send_queue_time(
+            bool high_priority, std::int64_t queue_time) noexcept;
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -324,23 +363,86 @@ namespace hpx::parcelset {
 
         bool async_serialization() const noexcept;
 
+        /// Return whether the headers of the sent parcels are encoded using
+        /// the compact (variable length) format
+        bool compact_parcel_header() const noexcept;
+
+        /// Return the thread pool the received messages are de-serialized
+        /// on, nullptr if they are de-serialized on the thread which has
+        /// received them (see hpx.parcel.decode_pool)
+        threads::thread_pool_base* get_decode_pool() const noexcept;
+
+        /// Return whether pending parcels of high priority actions are sent
+        /// before all other pending parcels (see hpx.parcel.priority_lanes)
+        bool priority_lanes() const noexcept;
+
+        /// Return whether the given parcel is sent using the lane for high
+        /// priority parcels
+        bool is_high_priority_parcel(parcel const& p) const;
+
         // callback while bootstrap the parcel layer
         static void early_pending_parcel_handler(
             std::error_code const& ec, parcel const& p);
 
     protected:
+        // Look up the thread pool configured for de-serializing the received
+        // messages, throws if no pool of that name exists. This has to be
+        // called before any message is received.
+        void init_decode_pool();
+
         // mutex for all the member data
         mutable hpx::spinlock mtx_;
 
         using pending_parcels_destinations = std::set<locality>;
         std::atomic<std::uint32_t> num_parcel_destinations_;
-        pending_parcels_destinations parcel_destinations_;
 
-        // The cache for pending parcels
-        using map_second_type =
-            hpx::tuple<std::vector<parcel>, std::vector<write_handler_type>>;
+        // The cache for pending parcels, the last element holds the time
+        // the oldest of the pending parcels was enqueued (if parcelport
+        // counters are enabled)
+        using map_second_type = hpx::tuple<std::vector<parcel>,
+            std::vector<write_handler_type>, std::uint64_t>;
         using pending_parcels_map = std::map<locality, map_second_type>;
-        pending_parcels_map pending_parcels_;
+
+        // The pending parcels are sharded by destination, threads sending
+        // parcels to different destinations rarely contend for the same lock.
+        // Parcels of high priority actions are queued separately, they are
+        // sent before the other pending parcels to the same destination.
+        struct pending_parcels_shard
+        {
+            pending_parcels_map& get_pending_parcels(
+                bool high_priority) noexcept
+            {
+                return high_priority ? high_priority_parcels_ :
+                                       pending_parcels_;
+            }
+
+            // Return whether parcels to the given destination are pending in
+            // any of the lanes
+            bool has_pending_parcels(locality const& loc) const;
+
+            hpx::spinlock mtx_;
+            pending_parcels_map pending_parcels_;
+            pending_parcels_map high_priority_parcels_;
+            pending_parcels_destinations parcel_destinations_;
+        };
+
+        pending_parcels_shard& get_pending_parcels_shard(
+            locality const& loc) const noexcept
+        {
+            return pending_parcels_shards_[loc.hash() %
+                num_pending_parcels_shards_];
+        }
+
+        // Acquire the lock of the given shard, counts how often the lock was
+        // held by another thread.
+        std::unique_lock<hpx::spinlock> lock_pending_parcels_shard(
+            pending_parcels_shard& shard);
+
+        std::size_t const num_pending_parcels_shards_;
+        std::unique_ptr<
+            util::cache_aligned_data_derived<pending_parcels_shard>[]>
+            pending_parcels_shards_;
+        std::atomic<std::int64_t> pending_parcels_contention_{0};
 
         // The local locality
         locality here_;
@@ -353,6 +455,15 @@ namespace hpx::parcelset {
         // Overall parcel statistics
         parcelset::gatherer parcels_sent_;
         parcelset::gatherer parcels_received_;
+
+        std::atomic<std::int64_t> num_receive_operations_{0};
+
+        std::atomic<std::int64_t> num_decode_operations_{0};
+        std::atomic<std::int64_t> decode_queue_time_{0};
+        std::atomic<std::int64_t> decode_time_{0};
+
+        std::atomic<std::int64_t> send_queue_count_[2] = {0, 0};
+        std::atomic<std::int64_t> send_queue_time_[2] = {0, 0};
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -369,6 +480,18 @@ namespace hpx::parcelset {
         /// async serialization of parcels
         bool async_serialization_;
 
+        /// compact encoding of the parcel headers
+        bool compact_parcel_header_;
+
+        /// name of the thread pool used for de-serializing received messages,
+        /// the pool is looked up when the parcelport is started as the thread
+        /// pools are not accessible while the parcelports are being created
+        std::string decode_pool_name_;
+        threads::thread_pool_base* decode_pool_ = nullptr;
+
+        /// send parcels of high priority actions before other parcels
+        bool priority_lanes_;
+
         /// priority of the parcelport
         int priority_;
         std::string type_;
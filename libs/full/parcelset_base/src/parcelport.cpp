@@ -22,9 +22,12 @@
 
 #include <hpx/parcelset_base/parcelport.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <initializer_list>
+#include <mutex>
 #include <string>
 #include <system_error>
 #include <utility>
@@ -36,6 +39,13 @@ namespace hpx::parcelset {
         locality here, std::string const& type,
         std::size_t zero_copy_serialization_threshold)
       : num_parcel_destinations_(0)
+      , num_pending_parcels_shards_((std::max)(
+            hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel." + type + ".pending_parcels_shards", 16),
+            static_cast<std::size_t>(1)))
+      , pending_parcels_shards_(
+            new util::cache_aligned_data_derived<pending_parcels_shard>[
+                num_pending_parcels_shards_])
       , here_(HPX_MOVE(here))
       , max_inbound_message_size_(
             static_cast<std::int64_t>(ini.get_max_inbound_message_size()))
@@ -45,6 +55,11 @@ namespace hpx::parcelset {
       , allow_zero_copy_optimizations_(true)
       , allow_zero_copy_receive_optimizations_(true)
       , async_serialization_(false)
+      , compact_parcel_header_(false)
+      , decode_pool_name_(hpx::util::get_entry_as<std::string>(
+            ini, "hpx.parcel." + type + ".decode_pool", ""))
+      , priority_lanes_(hpx::util::get_entry_as<int>(ini,
+                            "hpx.parcel." + type + ".priority_lanes", 1) != 0)
       , priority_(hpx::util::get_entry_as<int>(
             ini, "hpx.parcel." + type + ".priority", 0))
       , type_(type)
@@ -77,6 +92,11 @@ namespace hpx::parcelset {
         {
             async_serialization_ = true;
         }
+
+        if (hpx::util::get_entry_as<int>(ini, key + ".compact_header", 0) != 0)
+        {
+            compact_parcel_header_ = true;
+        }
     }
 
     int parcelport::priority() const noexcept
@@ -120,6 +140,26 @@ namespace hpx::parcelset {
     {
         parcels_sent_.add_data(data);
     }
+
+    void parcelport::add_receive_operation() noexcept
+    {
+        ++num_receive_operations_;
+    }
+
+    void parcelport::add_decode_operation(
+        std::int64_t queue_time, std::int64_t decode_time) noexcept
+    {
+        ++num_decode_operations_;
+        decode_queue_time_ += queue_time;
+        decode_time_ += decode_time;
+    }
+
+    void parcelport::add_send_queue_time(
+        bool high_priority, std::int64_t queue_time) noexcept
+    {
+        ++send_queue_count_[high_priority];
+        send_queue_time_[high_priority] += queue_time;
+    }
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -271,6 +311,46 @@ namespace hpx::parcelset {
     {
         return parcels_received_.size_zchunks_max(reset);
     }
+
+    //// the number of operations reading data from the network
+    std::int64_t parcelport::get_receive_operation_count(bool reset)
+    {
+        return util::get_and_reset_value(num_receive_operations_, reset);
+    }
+
+    //// the number of messages de-serialized on the decode pool
+    std::int64_t parcelport::get_decode_count(bool reset)
+    {
+        return util::get_and_reset_value(num_decode_operations_, reset);
+    }
+
+    //// the total time messages were waiting for being de-serialized
+    std::int64_t parcelport::get_decode_queue_time(bool reset)
+    {
+        return util::get_and_reset_value(decode_queue_time_, reset);
+    }
+
+    //// the total time it took to de-serialize messages on the decode pool
+    std::int64_t parcelport::get_decode_time(bool reset)
+    {
+        return util::get_and_reset_value(decode_time_, reset);
+    }
+
+    //// the number of times pending parcels of the given lane were dequeued
+    std::int64_t parcelport::get_send_queue_count(
+        bool high_priority, bool reset)
+    {
+        return util::get_and_reset_value(
+            send_queue_count_[high_priority], reset);
+    }
+
+    //// the total time the dequeued parcels of the given lane were waiting
+    std::int64_t parcelport::get_send_queue_time(
+        bool high_priority, bool reset)
+    {
+        return util::get_and_reset_value(
+            send_queue_time_[high_priority], reset);
+    }
 #endif
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
@@ -334,17 +414,43 @@ namespace hpx::parcelset {
 #endif
     std::int64_t parcelport::get_pending_parcels_count(bool /*reset*/)
     {
-        std::lock_guard<hpx::spinlock> l(mtx_);
         std::int64_t count = 0;
-        for (auto&& p : pending_parcels_)
+        for (std::size_t i = 0; i != num_pending_parcels_shards_; ++i)
         {
-            count += hpx::get<0>(p.second).size();
-            HPX_ASSERT(
-                hpx::get<0>(p.second).size() == hpx::get<1>(p.second).size());
+            pending_parcels_shard& shard = pending_parcels_shards_[i];
+
+            std::lock_guard<hpx::spinlock> l(shard.mtx_);
+            for (auto const* lane :
+                {&shard.pending_parcels_, &shard.high_priority_parcels_})
+            {
+                for (auto&& p : *lane)
+                {
+                    count += hpx::get<0>(p.second).size();
+                    HPX_ASSERT(hpx::get<0>(p.second).size() ==
+                        hpx::get<1>(p.second).size());
+                }
+            }
         }
         return count;
     }
 
+    std::int64_t parcelport::get_pending_parcels_contention_count(bool reset)
+    {
+        return util::get_and_reset_value(pending_parcels_contention_, reset);
+    }
+
+    std::unique_lock<hpx::spinlock> parcelport::lock_pending_parcels_shard(
+        pending_parcels_shard& shard)
+    {
+        std::unique_lock<hpx::spinlock> l(shard.mtx_, std::try_to_lock);
+        if (!l.owns_lock())
+        {
+            ++pending_parcels_contention_;
+            l.lock();
+        }
+        return l;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     std::int64_t get_max_inbound_size(parcelport const& pp)
     {
@@ -381,6 +487,65 @@ namespace hpx::parcelset {
         return async_serialization_;
     }
 
+    bool parcelport::compact_parcel_header() const noexcept
+    {
+        return compact_parcel_header_;
+    }
+
+    bool parcelport::priority_lanes() const noexcept
+    {
+        return priority_lanes_;
+    }
+
+    bool parcelport::is_high_priority_parcel(parcel const& p) const
+    {
+        if (!priority_lanes_)
+        {
+            return false;
+        }
+
+        threads::thread_priority const priority = p.get_thread_priority();
+        return priority == threads::thread_priority::high ||
+            priority == threads::thread_priority::high_recursive;
+    }
+
+    bool parcelport::pending_parcels_shard::has_pending_parcels(
+        locality const& loc) const
+    {
+        for (auto const* lane : {&pending_parcels_, &high_priority_parcels_})
+        {
+            if (auto const it = lane->find(loc);
+                it != lane->end() && !hpx::get<0>(it->second).empty())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void parcelport::init_decode_pool()
+    {
+        if (decode_pool_name_.empty() || decode_pool_ != nullptr)
+        {
+            return;
+        }
+
+        if (!hpx::resource::pool_exists(decode_pool_name_))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "parcelport::init_decode_pool",
+                "the thread pool '{}' configured for de-serializing received "
+                "messages (hpx.parcel.{}.decode_pool) does not exist",
+                decode_pool_name_, type_);
+        }
+        decode_pool_ = &hpx::resource::get_thread_pool(decode_pool_name_);
+    }
+
+    threads::thread_pool_base* parcelport::get_decode_pool() const noexcept
+    {
+        return decode_pool_;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // the code below is needed to bootstrap the parcel layer
     void parcelport::early_pending_parcel_handler(
@@ -44,6 +44,7 @@ namespace hpx::agas {
         primary_ns_begin_migration = 0b1001001,
         primary_ns_end_migration = 0b1001010,
         primary_ns_statistics_counter = 0b1001011,
+        primary_ns_lock_wait = 0b1001100,
 
         component_ns_service = 0b0100000,
         component_ns_bulk_service = 0b0100001,
@@ -187,6 +188,11 @@ namespace hpx::agas::detail {
         {"count/route", "", counter_target_count, primary_ns_route,
             primary_ns_statistics_counter},
 #endif
+        // counters exposing contention on the primary namespace tables
+        {"count/lock_wait", "", counter_target_count, primary_ns_lock_wait,
+            primary_ns_statistics_counter},
+        {"time/lock_wait", "ns", counter_target_time, primary_ns_lock_wait,
+            primary_ns_statistics_counter},
         // counters exposing API timings
         {"time/bind_gid", "ns", counter_target_time, primary_ns_bind_gid,
             primary_ns_statistics_counter},
@@ -146,6 +146,16 @@ namespace hpx { namespace performance_counters {
         counter_info const&, discover_counter_func const&,
         discover_counters_mode, error_code&);
 
+    // Creation function for counters of remote action invocations that were
+    // executed directly on the thread that has received the parcel.
+    HPX_EXPORT naming::gid_type direct_action_invocation_counter_creator(
+        counter_info const&, error_code&);
+
+    // Discoverer function for direct action invocation counters.
+    HPX_EXPORT bool direct_action_invocation_counter_discoverer(
+        counter_info const&, discover_counter_func const&,
+        discover_counters_mode, error_code&);
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     ///////////////////////////////////////////////////////////////////////////
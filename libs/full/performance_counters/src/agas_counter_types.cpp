@@ -65,6 +65,14 @@ namespace hpx { namespace performance_counters {
                 &agas::addressing_service::get_cache_erase_entry_time,
                 &client));
 
+        // credit updates
+        hpx::function<std::int64_t(bool)> refcnt_messages_sent(
+            hpx::bind_front(
+                &agas::addressing_service::get_refcnt_messages_sent, &client));
+        hpx::function<std::int64_t(bool)> refcnt_messages_saved(
+            hpx::bind_front(
+                &agas::addressing_service::get_refcnt_messages_saved, &client));
+
         using placeholders::_1;
         using placeholders::_2;
         performance_counters::generic_counter_type_data const counter_types[] =
@@ -196,6 +204,26 @@ namespace hpx { namespace performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         cache_erase_entry_time, _2),
                     &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/refcnt/messages_sent",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of messages sent to AGAS for "
+                    "updating global reference counts (credits)",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        refcnt_messages_sent, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/refcnt/messages_saved",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of credit update messages avoided by "
+                    "merging and batching the requests",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        refcnt_messages_saved, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
             };
 
         performance_counters::install_counter_types(
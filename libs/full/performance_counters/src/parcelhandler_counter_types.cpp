@@ -129,6 +129,30 @@ namespace hpx::performance_counters {
             hpx::bind_front(
                 &parcelhandler::get_zchunks_recv_size_max, &ph, pp_type));
 
+        hpx::function<std::int64_t(bool)> num_receive_operations(
+            hpx::bind_front(
+                &parcelhandler::get_receive_operation_count, &ph, pp_type));
+
+        hpx::function<std::int64_t(bool)> num_decode_operations(
+            hpx::bind_front(&parcelhandler::get_decode_count, &ph, pp_type));
+        hpx::function<std::int64_t(bool)> decode_queue_time(hpx::bind_front(
+            &parcelhandler::get_decode_queue_time, &ph, pp_type));
+        hpx::function<std::int64_t(bool)> decode_time(
+            hpx::bind_front(&parcelhandler::get_decode_time, &ph, pp_type));
+
+        hpx::function<std::int64_t(bool)> send_queue_count_normal(
+            hpx::bind_front(
+                &parcelhandler::get_send_queue_count, &ph, pp_type, false));
+        hpx::function<std::int64_t(bool)> send_queue_count_high(
+            hpx::bind_front(
+                &parcelhandler::get_send_queue_count, &ph, pp_type, true));
+        hpx::function<std::int64_t(bool)> send_queue_time_normal(
+            hpx::bind_front(
+                &parcelhandler::get_send_queue_time, &ph, pp_type, false));
+        hpx::function<std::int64_t(bool)> send_queue_time_high(
+            hpx::bind_front(
+                &parcelhandler::get_send_queue_time, &ph, pp_type, true));
+
         performance_counters::generic_counter_type_data const counter_types[] =
             {
                 {hpx::util::format("/parcels/count/{}/sent", pp_type),
@@ -476,6 +500,117 @@ namespace hpx::performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         HPX_MOVE(size_zchunks_recv_per_msg_max), _2),
                     &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/receive_operations", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of operations reading data from "
+                        "the network using the {} connection type for the "
+                        "referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(num_receive_operations), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format("/parcelport/count/{}/decode", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of messages received using the "
+                        "{} connection type which were de-serialized on the "
+                        "decode pool for the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(num_decode_operations), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/time/{}/decode-queue", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the total time messages received using the "
+                        "{} connection type were waiting for being "
+                        "de-serialized on the decode pool for the referenced "
+                        "locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(decode_queue_time), _2),
+                    &performance_counters::locality_counter_discoverer, "ns"},
+                {hpx::util::format("/parcelport/time/{}/decode", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the total time it took to de-serialize the "
+                        "messages received using the {} connection type on "
+                        "the decode pool for the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(decode_time), _2),
+                    &performance_counters::locality_counter_discoverer, "ns"},
+                {hpx::util::format(
+                     "/parcelport/count/{}/send-queue/normal", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of times pending parcels of "
+                        "normal priority were dequeued for being sent using "
+                        "the {} connection type for the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(send_queue_count_normal), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/send-queue/high", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of times pending parcels of high "
+                        "priority actions were dequeued for being sent using "
+                        "the {} connection type for the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(send_queue_count_high), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/time/{}/send-queue/normal", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the total time pending parcels of normal "
+                        "priority were waiting for being sent using the {} "
+                        "connection type for the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(send_queue_time_normal), _2),
+                    &performance_counters::locality_counter_discoverer, "ns"},
+                {hpx::util::format(
+                     "/parcelport/time/{}/send-queue/high", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the total time pending parcels of high "
+                        "priority actions were waiting for being sent using "
+                        "the {} connection type for the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(send_queue_time_high), _2),
+                    &performance_counters::locality_counter_discoverer, "ns"},
             };
 
         performance_counters::install_counter_types(
@@ -610,6 +745,9 @@ namespace hpx::performance_counters {
             hpx::bind_front(&parcelhandler::get_incoming_queue_length, &ph));
         hpx::function<std::int64_t(bool)> outgoing_queue_length(
             hpx::bind_front(&parcelhandler::get_outgoing_queue_length, &ph));
+        hpx::function<std::int64_t(bool)> outgoing_queue_contention(
+            hpx::bind_front(
+                &parcelhandler::get_outgoing_queue_contention, &ph));
         hpx::function<std::int64_t(bool)> outgoing_routed_count(
             hpx::bind_front(&parcelhandler::get_parcel_routed_count, &ph));
 
@@ -631,6 +769,17 @@ namespace hpx::performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         outgoing_queue_length, _2),
                     &performance_counters::locality_counter_discoverer, ""},
+                {"/parcelqueue/count/send-contention",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of times enqueuing an outgoing parcel "
+                    "had to wait for another thread accessing the queue of "
+                    "outgoing parcels of the same destination",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        outgoing_queue_contention, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
                 {"/parcels/count/routed",
                     performance_counters::counter_type::
                         monotonically_increasing,
@@ -52,7 +52,26 @@ namespace hpx { namespace agas { namespace server {
             std::string::size_type p = name.find_last_of('/');
             HPX_ASSERT(p != std::string::npos);
 
-            if (agas::detail::primary_namespace_services[i].target_ ==
+            if (agas::detail::primary_namespace_services[i].code_ ==
+                primary_ns_lock_wait)
+            {
+                if (agas::detail::primary_namespace_services[i].target_ ==
+                    agas::detail::counter_target_count)
+                {
+                    help = "returns the number of times a lock protecting the "
+                           "tables of the primary AGAS service was contended";
+                    type = performance_counters::counter_type::
+                        monotonically_increasing;
+                }
+                else
+                {
+                    help = "returns the overall time spent waiting for "
+                           "contended locks protecting the tables of the "
+                           "primary AGAS service";
+                    type = performance_counters::counter_type::elapsed_time;
+                }
+            }
+            else if (agas::detail::primary_namespace_services[i].target_ ==
                 agas::detail::counter_target_count)
             {
                 help = hpx::util::format("returns the number of invocations "
@@ -226,6 +245,11 @@ namespace hpx { namespace agas { namespace server {
                     &cd::get_end_migration_count, &service.counter_data_);
                 service.counter_data_.end_migration_.enabled_ = true;
                 break;
+            case primary_ns_lock_wait:
+                get_data_func = hpx::bind_front(
+                    &cd::get_lock_wait_count, &service.counter_data_);
+                service.counter_data_.lock_wait_.enabled_ = true;
+                break;
             case primary_ns_statistics_counter:
                 get_data_func = hpx::bind_front(
                     &cd::get_overall_count, &service.counter_data_);
@@ -289,6 +313,11 @@ namespace hpx { namespace agas { namespace server {
                     &cd::get_end_migration_time, &service.counter_data_);
                 service.counter_data_.end_migration_.enabled_ = true;
                 break;
+            case primary_ns_lock_wait:
+                get_data_func = hpx::bind_front(
+                    &cd::get_lock_wait_time, &service.counter_data_);
+                service.counter_data_.lock_wait_.enabled_ = true;
+                break;
             case primary_ns_statistics_counter:
                 get_data_func = hpx::bind_front(
                     &cd::get_overall_time, &service.counter_data_);
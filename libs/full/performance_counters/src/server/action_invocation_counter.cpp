@@ -60,6 +60,15 @@ namespace hpx::performance_counters {
         return action_invocation_counter_discoverer(
             info, f, mode, invocation_count_registry::remote_instance(), ec);
     }
+
+    bool direct_action_invocation_counter_discoverer(counter_info const& info,
+        discover_counter_func const& f, discover_counters_mode mode,
+        error_code& ec)
+    {
+        using hpx::actions::detail::invocation_count_registry;
+        return action_invocation_counter_discoverer(
+            info, f, mode, invocation_count_registry::direct_instance(), ec);
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -122,5 +131,13 @@ namespace hpx::performance_counters {
         return action_invocation_counter_creator(
             info, invocation_count_registry::remote_instance(), ec);
     }
+
+    naming::gid_type direct_action_invocation_counter_creator(
+        counter_info const& info, error_code& ec)
+    {
+        using hpx::actions::detail::invocation_count_registry;
+        return action_invocation_counter_creator(
+            info, invocation_count_registry::direct_instance(), ec);
+    }
 #endif
 }    // namespace hpx::performance_counters
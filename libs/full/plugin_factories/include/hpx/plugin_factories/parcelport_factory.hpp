@@ -116,10 +116,20 @@ namespace hpx::plugins {
                 name_uc +
                 "_MAX_BACKGROUND_THREADS:"
                 "$[hpx.parcel.max_background_threads]}");
+            fillini.emplace_back("pending_parcels_shards = ${HPX_PARCEL_" +
+                name_uc +
+                "_PENDING_PARCELS_SHARDS:"
+                "$[hpx.parcel.pending_parcels_shards]}");
             fillini.emplace_back("async_serialization = ${HPX_PARCEL_" +
                 name_uc +
                 "_ASYNC_SERIALIZATION:"
                 "$[hpx.parcel.async_serialization]}");
+            fillini.emplace_back("compact_header = ${HPX_PARCEL_" + name_uc +
+                "_COMPACT_HEADER:$[hpx.parcel.compact_header]}");
+            fillini.emplace_back("decode_pool = ${HPX_PARCEL_" + name_uc +
+                "_DECODE_POOL:$[hpx.parcel.decode_pool]}");
+            fillini.emplace_back("priority_lanes = ${HPX_PARCEL_" + name_uc +
+                "_PRIORITY_LANES:$[hpx.parcel.priority_lanes]}");
             fillini.emplace_back("priority = ${HPX_PARCEL_" + name_uc +
                 "_PRIORITY:" +
                 traits::plugin_config_data<Parcelport>::priority() + "}");
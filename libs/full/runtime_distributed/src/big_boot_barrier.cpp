@@ -30,6 +30,7 @@
 #include <hpx/runtime_distributed/big_boot_barrier.hpp>
 #include <hpx/runtime_distributed/runtime_fwd.hpp>
 #include <hpx/serialization/detail/polymorphic_id_factory.hpp>
+#include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
 #include <hpx/serialization/vector.hpp>
 #include <hpx/static_reinit/reinitializable_static.hpp>
 #include <hpx/timing/high_resolution_clock.hpp>
@@ -70,6 +71,11 @@ namespace hpx::agas::detail {
 
         serialization_registry.fill_missing_typenames();
 
+        hpx::serialization::detail::polymorphic_nonintrusive_factory&
+            polymorphic_factory = hpx::serialization::detail::
+                polymorphic_nonintrusive_factory::instance();
+        polymorphic_factory.fill_missing_typenames();
+
         hpx::actions::detail::action_registry& action_registry =
             hpx::actions::detail::action_registry::instance();
         action_registry.fill_missing_typenames();
@@ -86,6 +92,9 @@ namespace hpx::agas::detail {
                     .get_unassigned_typenames())
           , action_typenames(hpx::actions::detail::action_registry::instance()
                                  .get_unassigned_typenames())
+          , polymorphic_typenames(hpx::serialization::detail::
+                    polymorphic_nonintrusive_factory::instance()
+                        .get_unassigned_typenames())
         {
         }
 
@@ -95,6 +104,7 @@ namespace hpx::agas::detail {
             HPX_ASSERT(!action_typenames.empty());
             ar << serialization_typenames;
             ar << action_typenames;
+            ar << polymorphic_typenames;
         }
 
         void load(hpx::serialization::input_archive& ar, unsigned)
@@ -102,11 +112,13 @@ namespace hpx::agas::detail {
             // part running on locality 0
             ar >> serialization_typenames;
             ar >> action_typenames;
+            ar >> polymorphic_typenames;
         }
         HPX_SERIALIZATION_SPLIT_MEMBER();
 
         std::vector<std::string> serialization_typenames;
         std::vector<std::string> action_typenames;
+        std::vector<std::string> polymorphic_typenames;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -125,12 +137,14 @@ namespace hpx::agas::detail {
             HPX_ASSERT(!action_ids.empty());
             ar << serialization_ids;    // part running on locality 0
             ar << action_ids;
+            ar << polymorphic_ids;
         }
 
         void load(hpx::serialization::input_archive& ar, unsigned)
         {
             ar >> serialization_ids;    // part running on worker node
             ar >> action_ids;
+            ar >> polymorphic_ids;
         }
         HPX_SERIALIZATION_SPLIT_MEMBER();
 
@@ -174,6 +188,27 @@ namespace hpx::agas::detail {
                     action_ids.push_back(id);
                 }
             }
+            {
+                hpx::serialization::detail::polymorphic_nonintrusive_factory&
+                    factory = hpx::serialization::detail::
+                        polymorphic_nonintrusive_factory::instance();
+                std::uint32_t max_id = factory.get_max_registered_id();
+
+                for (std::string const& s :
+                    unassigned_ids.polymorphic_typenames)
+                {
+                    std::uint32_t id = factory.try_get_id(s);
+                    if (id ==
+                        hpx::serialization::detail::
+                            polymorphic_nonintrusive_factory::invalid_id)
+                    {
+                        // this id is not registered yet
+                        id = ++max_id;
+                        factory.register_typename(s, id);
+                    }
+                    polymorphic_ids.push_back(id);
+                }
+            }
         }
 
     public:
@@ -224,10 +259,32 @@ namespace hpx::agas::detail {
                 // order problems
                 registry.fill_missing_typenames();
             }
+            {
+                hpx::serialization::detail::polymorphic_nonintrusive_factory&
+                    factory = hpx::serialization::detail::
+                        polymorphic_nonintrusive_factory::instance();
+
+                std::vector<std::string> const typenames =
+                    factory.get_unassigned_typenames();
+
+                // we should have received an id for each unassigned name
+                HPX_ASSERT(typenames.size() == polymorphic_ids.size());
+
+                for (std::size_t k = 0; k < polymorphic_ids.size(); ++k)
+                {
+                    factory.register_typename(
+                        typenames[k], polymorphic_ids[k]);
+                }
+
+                // Classes registered later on don't get an id assigned locally
+                // as it could conflict with the ids used by other localities,
+                // those are transmitted by name instead.
+            }
         }
 
         std::vector<std::uint32_t> serialization_ids;
         std::vector<std::uint32_t> action_ids;
+        std::vector<std::uint32_t> polymorphic_ids;
     };
 }    // namespace hpx::agas::detail
 
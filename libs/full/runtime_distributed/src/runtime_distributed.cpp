@@ -1114,6 +1114,17 @@ namespace hpx {
                 &performance_counters::remote_action_invocation_counter_creator,
                 &performance_counters::
                     remote_action_invocation_counter_discoverer,
+                ""},
+            {"/runtime/count/direct-action-invocation",
+                performance_counters::counter_type::monotonically_increasing,
+                "returns the number of (remote) invocations of a specific "
+                "action on this locality which were executed directly on the "
+                "thread that has received the parcel (the action type has to "
+                "be specified as the counter parameter)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::direct_action_invocation_counter_creator,
+                &performance_counters::
+                    direct_action_invocation_counter_discoverer,
                 ""}
 #endif
         };
@@ -14,14 +14,17 @@
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 
+#include <hpx/cache/concurrent_cache.hpp>
 #include <hpx/cache/entries/lfu_entry.hpp>
 #include <hpx/cache/local_cache.hpp>
+#include <hpx/cache/lru_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/preprocessor/stringize.hpp>
 #include <hpx/statistics/histogram.hpp>
 
 #include <hpx/modules/program_options.hpp>
+#include <hpx/modules/synchronization.hpp>
 #include <boost/accumulators/accumulators.hpp>
 
 #include <algorithm>
@@ -30,6 +33,7 @@
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -126,6 +130,61 @@ typedef hpx::util::cache::local_cache<gva_cache_key, gva_entry_type,
     hpx::util::cache::statistics::local_full_statistics>
     gva_cache_type;
 
+///////////////////////////////////////////////////////////////////////////////
+// The AGAS cache as used before: an LRU cache protected by a single lock
+struct locked_lru_cache
+{
+    typedef hpx::util::cache::lru_cache<gva_cache_key, hpx::agas::gva,
+        hpx::util::cache::statistics::local_full_statistics>
+        cache_type;
+
+    explicit locked_lru_cache(std::size_t cache_size)
+      : cache_(cache_size)
+    {
+    }
+
+    bool get_entry(
+        gva_cache_key const& key, gva_cache_key& idbase, hpx::agas::gva& g)
+    {
+        std::unique_lock<hpx::shared_mutex> l(mtx_);
+        return cache_.get_entry(key, idbase, g);
+    }
+
+    void update(gva_cache_key const& key, hpx::agas::gva const& g)
+    {
+        std::unique_lock<hpx::shared_mutex> l(mtx_);
+        cache_.update(key, g);
+    }
+
+    hpx::shared_mutex mtx_;
+    cache_type cache_;
+};
+
+// The AGAS cache as used now: a sharded cache with CLOCK eviction, blocks of
+// 256 consecutive ids are assigned to the same shard
+struct gva_cache_shards
+{
+    std::uint64_t operator()(
+        gva_cache_key const& key, std::size_t num_shards) const
+    {
+        std::uint64_t const first = key.get_gid().get_lsb() >> 8;
+        std::uint64_t const last =
+            (key.get_gid().get_lsb() + key.get_count()) >> 8;
+
+        std::uint64_t result = 0;
+        for (std::uint64_t b = first; b <= last && b - first < num_shards; ++b)
+        {
+            result |= std::uint64_t(1) << (b % num_shards);
+        }
+        return result;
+    }
+};
+
+typedef hpx::util::cache::concurrent_cache<gva_cache_key, hpx::agas::gva,
+    hpx::spinlock, hpx::util::cache::statistics::local_full_statistics,
+    gva_cache_shards>
+    concurrent_gva_cache_type;
+
 ///////////////////////////////////////////////////////////////////////////////
 void calculate_histogram(
     std::string const& prefix, std::vector<std::uint64_t> const& timings)
@@ -230,6 +289,55 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Look up the cached entries from all worker threads concurrently, one in ten
+// lookups is followed by an update of the entry.
+template <typename Cache>
+void test_concurrent_get(std::string const& name, Cache& cache,
+    std::size_t num_entries, std::size_t num_lookups)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::int32_t ct = to_int(hpx::components::component_enum_type::invalid);
+
+    hpx::naming::gid_type const first_key = hpx::detail::get_next_id();
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        hpx::agas::gva value(locality, ct, 1, std::uint64_t(0), 0);
+        cache.update(gva_cache_key(first_key + i, 1), value);
+    }
+
+    std::size_t const num_tasks = hpx::get_os_thread_count();
+
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t task = 0; task != num_tasks; ++task)
+    {
+        tasks.push_back(hpx::async([&, task]() {
+            for (std::size_t i = 0; i != num_lookups; ++i)
+            {
+                gva_cache_key key(
+                    first_key + ((task * num_lookups + i) % num_entries), 1);
+                gva_cache_key idbase;
+                hpx::agas::gva e;
+
+                if (!cache.get_entry(key, idbase, e) || i % 10 == 0)
+                {
+                    cache.update(key, e);
+                }
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    double const elapsed = t.elapsed();
+    std::cout << "concurrent get (" << name << ", " << num_tasks
+              << " threads): " << elapsed << " [s], "
+              << static_cast<double>(num_tasks * num_lookups) / elapsed
+              << " [lookups/s]" << std::endl;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -255,6 +363,21 @@ int hpx_main(hpx::program_options::variables_map& vm)
     double elapsed = t1.elapsed();
     hpx::util::print_cdash_timing("AGASCache", elapsed);
 
+    std::size_t num_lookups = 100000;
+    if (vm.count("num_lookups"))
+        num_lookups = vm["num_lookups"].as<std::size_t>();
+
+    {
+        locked_lru_cache lru(cache_size);
+        test_concurrent_get("locked lru_cache", lru, num_entries, num_lookups);
+    }
+
+    {
+        concurrent_gva_cache_type concurrent(cache_size);
+        test_concurrent_get(
+            "concurrent_cache", concurrent, num_entries, num_lookups);
+    }
+
     return hpx::finalize();
 }
 
@@ -268,7 +391,9 @@ int main(int argc, char* argv[])
         "initial cache size (default: " HPX_PP_STRINGIZE(
             HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")("num_entries,n",
         value<std::size_t>(),
-        "number of items to insert into cache (default: 1000)");
+        "number of items to insert into cache (default: 1000)")(
+        "num_lookups", value<std::size_t>(),
+        "number of concurrent lookups per worker thread (default: 100000)");
 
     // Initialize and run HPX
     hpx::init_params init_args;
@@ -0,0 +1,131 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of the AGAS symbol namespace. A
+// number of concurrent tasks register, resolve, look up by pattern, and
+// unregister names using hpx::register_with_basename and friends. The
+// benchmark reports the achieved operation rate for each of the phases.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::string basename_for(std::size_t task)
+{
+    return "/symbol_namespace_throughput/" + std::to_string(task);
+}
+
+// Run the given function concurrently for all tasks, return the elapsed time.
+template <typename F>
+double run_phase(std::size_t tasks, F&& f)
+{
+    hpx::chrono::high_resolution_timer const timer;
+
+    std::vector<hpx::future<void>> results;
+    results.reserve(tasks);
+    for (std::size_t t = 0; t != tasks; ++t)
+    {
+        results.push_back(hpx::async(f, t));
+    }
+    hpx::wait_all(results);
+
+    return timer.elapsed();
+}
+
+void print_result(char const* phase, std::size_t operations, double elapsed)
+{
+    std::cout << phase << "," << operations << "," << elapsed << ","
+              << static_cast<double>(operations) / elapsed << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const tasks = vm["tasks"].as<std::size_t>();
+    std::size_t const names = vm["names"].as<std::size_t>();
+
+    hpx::id_type const here = hpx::find_here();
+
+    double const register_time = run_phase(tasks, [&](std::size_t t) {
+        std::string const basename = basename_for(t);
+        for (std::size_t i = 0; i != names; ++i)
+        {
+            hpx::register_with_basename(hpx::launch::sync, basename, here, i);
+        }
+    });
+
+    double const resolve_time = run_phase(tasks, [&](std::size_t t) {
+        std::string const basename = basename_for(t);
+        for (std::size_t i = 0; i != names; ++i)
+        {
+            if (hpx::find_from_basename(basename, i).get() != here)
+            {
+                std::cerr << "agas_symbol_namespace_throughput: unexpected id "
+                             "resolved for: "
+                          << basename << "/" << i << std::endl;
+            }
+        }
+    });
+
+    double const iterate_time = run_phase(tasks, [&](std::size_t t) {
+        auto const symbols = hpx::agas::find_symbols(
+            hpx::launch::sync, basename_for(t) + "/*");
+        if (symbols.size() != names)
+        {
+            std::cerr << "agas_symbol_namespace_throughput: unexpected number "
+                         "of symbols found: "
+                      << symbols.size() << std::endl;
+        }
+    });
+
+    double const unregister_time = run_phase(tasks, [&](std::size_t t) {
+        std::string const basename = basename_for(t);
+        for (std::size_t i = 0; i != names; ++i)
+        {
+            hpx::unregister_with_basename(basename, i).get();
+        }
+    });
+
+    std::size_t const operations = tasks * names;
+
+    std::cout << "phase,operations,time [s],rate [ops/s]" << std::endl;
+    print_result("register", operations, register_time);
+    print_result("resolve", operations, resolve_time);
+    print_result("iterate", tasks, iterate_time);
+    print_result("unregister", operations, unregister_time);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("tasks",
+         hpx::program_options::value<std::size_t>()->default_value(64),
+         "number of concurrent tasks (default: 64)")
+        ("names",
+         hpx::program_options::value<std::size_t>()->default_value(1000),
+         "number of names each of the tasks registers (default: 1000)");
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
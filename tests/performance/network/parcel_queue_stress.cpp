@@ -0,0 +1,197 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark stresses the queues of pending parcels of the parcelports.
+// Every locality runs a number of concurrent senders, each of which sends
+// small messages to all other localities in a round robin fashion. The
+// benchmark reports the achieved message rate and how often enqueuing a
+// parcel had to wait for another thread (see
+// /parcelqueue/count/send-contention).
+//
+// All localities can be run on a single host, e.g.:
+//
+//      hpxrun.py -l 4 -t 8 parcel_queue_stress -- --senders=64
+//
+// The number of shards of the queues can be changed using
+// --hpx:ini=hpx.parcel.pending_parcels_shards=<N>.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> received_messages(0);
+
+void receive_message(std::vector<char> const&)
+{
+    ++received_messages;
+}
+HPX_PLAIN_ACTION(receive_message, receive_message_action)
+
+// Send the given number of messages from each of the senders to all other
+// localities.
+void send_messages(
+    std::size_t senders, std::size_t num_messages, std::size_t size)
+{
+    std::vector<hpx::id_type> const localities = hpx::find_remote_localities();
+    if (localities.empty())
+    {
+        return;
+    }
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(senders);
+    for (std::size_t s = 0; s != senders; ++s)
+    {
+        tasks.push_back(hpx::async([&localities, s, num_messages, size]() {
+            std::vector<char> const data(size, 'a');
+            for (std::size_t i = 0; i != num_messages; ++i)
+            {
+                for (std::size_t l = 0; l != localities.size(); ++l)
+                {
+                    hpx::post<receive_message_action>(
+                        localities[(s + l) % localities.size()], data);
+                }
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+}
+HPX_PLAIN_ACTION(send_messages, send_messages_action)
+
+// Wait until the given number of messages has been received.
+void wait_for_messages(std::size_t expected)
+{
+    hpx::util::yield_while([expected]() {
+        return received_messages.load(std::memory_order_relaxed) < expected;
+    });
+    received_messages -= expected;
+}
+HPX_PLAIN_ACTION(wait_for_messages, wait_for_messages_action)
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t query_contention(std::uint32_t locality_id, bool reset)
+{
+    hpx::performance_counters::performance_counter counter(
+        "/parcelqueue{locality#" + std::to_string(locality_id) +
+        "/total}/count/send-contention");
+    return counter.get_value<std::int64_t>(hpx::launch::sync, reset);
+}
+
+double run_benchmark(std::vector<hpx::id_type> const& localities,
+    std::size_t senders, std::size_t num_messages, std::size_t size)
+{
+    // every locality receives messages from all senders of all other
+    // localities
+    std::size_t const expected =
+        (localities.size() - 1) * senders * num_messages;
+
+    hpx::chrono::high_resolution_timer const timer;
+
+    std::vector<hpx::future<void>> sent;
+    sent.reserve(localities.size());
+    for (hpx::id_type const& id : localities)
+    {
+        sent.push_back(
+            hpx::async<send_messages_action>(id, senders, num_messages, size));
+    }
+
+    std::vector<hpx::future<void>> received;
+    received.reserve(localities.size());
+    for (hpx::id_type const& id : localities)
+    {
+        received.push_back(hpx::async<wait_for_messages_action>(id, expected));
+    }
+
+    hpx::wait_all(sent);
+    hpx::wait_all(received);
+
+    return timer.elapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const senders = vm["senders"].as<std::size_t>();
+    std::size_t const num_messages = vm["messages"].as<std::size_t>();
+    std::size_t const size = vm["size"].as<std::size_t>();
+
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+    if (localities.size() < 2)
+    {
+        std::cerr << "parcel_queue_stress: this benchmark requires at least "
+                     "two localities"
+                  << std::endl;
+        return hpx::finalize();
+    }
+
+    // warm up, establishes the connections between all localities
+    run_benchmark(localities, senders, 1, size);
+    for (std::uint32_t i = 0; i != localities.size(); ++i)
+    {
+        query_contention(i, true);
+    }
+
+    double const elapsed =
+        run_benchmark(localities, senders, num_messages, size);
+
+    std::int64_t contention = 0;
+    for (std::uint32_t i = 0; i != localities.size(); ++i)
+    {
+        contention += query_contention(i, false);
+    }
+
+    std::size_t const total_messages = localities.size() *
+        (localities.size() - 1) * senders * num_messages;
+
+    std::cout << "localities,senders,messages,size [bytes],time [s],"
+                 "rate [msgs/s],contention"
+              << std::endl;
+    std::cout << localities.size() << "," << senders << "," << total_messages
+              << "," << size << "," << elapsed << ","
+              << static_cast<double>(total_messages) / elapsed << ","
+              << contention << std::endl;
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("senders",
+         hpx::program_options::value<std::size_t>()->default_value(64),
+         "number of concurrent senders per locality (default: 64)")
+        ("messages",
+         hpx::program_options::value<std::size_t>()->default_value(1000),
+         "number of messages each sender sends to every other locality "
+         "(default: 1000)")
+        ("size",
+         hpx::program_options::value<std::size_t>()->default_value(8),
+         "size of the messages to send (in bytes, default: 8)");
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,240 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the bandwidth achieved when sending large arrays
+// back and forth between two localities. The arrays are sent either as a
+// serialize_buffer or as a std::vector. Optionally, the received
+// serialize_buffers are placed into memory taken from a pool that is
+// registered with the serialization layer (see
+// hpx::serialization::set_zero_copy_receive_allocator), which allows
+// parcelports supporting zero-copy receive operations to place the data
+// directly into the pool memory.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using buffer_type = hpx::serialization::serialize_buffer<char>;
+
+buffer_type echo_buffer(buffer_type const& buffer)
+{
+    return buffer;
+}
+HPX_PLAIN_ACTION(echo_buffer, echo_buffer_action)
+
+std::vector<char> echo_vector(std::vector<char> const& vector)
+{
+    return vector;
+}
+HPX_PLAIN_ACTION(echo_vector, echo_vector_action)
+
+///////////////////////////////////////////////////////////////////////////////
+// Pool of (simulated) network registered memory, freed blocks are kept for
+// reuse by subsequent receive operations of the same size.
+class receive_pool
+{
+public:
+    receive_pool() = default;
+
+    receive_pool(receive_pool const&) = delete;
+    receive_pool(receive_pool&&) = delete;
+    receive_pool& operator=(receive_pool const&) = delete;
+    receive_pool& operator=(receive_pool&&) = delete;
+
+    ~receive_pool()
+    {
+        for (auto const& block : free_blocks_)
+        {
+            ::operator delete(block.second.first,
+                std::align_val_t(block.second.second));
+        }
+    }
+
+    static void* allocate(std::size_t size, std::size_t alignment, void* data)
+    {
+        auto* pool = static_cast<receive_pool*>(data);
+        {
+            std::lock_guard l(pool->mtx_);
+            auto const it = pool->free_blocks_.find(size);
+            if (it != pool->free_blocks_.end() &&
+                it->second.second == alignment)
+            {
+                void* p = it->second.first;
+                pool->free_blocks_.erase(it);
+                return p;
+            }
+        }
+        return ::operator new(size, std::align_val_t(alignment));
+    }
+
+    static void deallocate(void* p, std::size_t size, std::size_t alignment,
+        void* data) noexcept
+    {
+        auto* pool = static_cast<receive_pool*>(data);
+        std::lock_guard l(pool->mtx_);
+        pool->free_blocks_.emplace(size, std::make_pair(p, alignment));
+    }
+
+private:
+    std::mutex mtx_;
+    std::multimap<std::size_t, std::pair<void*, std::size_t>> free_blocks_;
+};
+
+receive_pool pool;
+
+void register_receive_pool(std::size_t min_size)
+{
+    hpx::serialization::zero_copy_receive_allocator alloc;
+    alloc.allocate = &receive_pool::allocate;
+    alloc.deallocate = &receive_pool::deallocate;
+    alloc.data = &pool;
+    alloc.min_size = min_size;
+    hpx::serialization::set_zero_copy_receive_allocator(alloc);
+}
+HPX_PLAIN_ACTION(register_receive_pool, register_receive_pool_action)
+
+void unregister_receive_pool()
+{
+    hpx::serialization::set_zero_copy_receive_allocator({});
+}
+HPX_PLAIN_ACTION(unregister_receive_pool, unregister_receive_pool_action)
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Action, typename Data>
+double run_pingpong(
+    hpx::id_type const& there, Data const& data, std::size_t iterations)
+{
+    // warm up
+    Action()(there, data);
+
+    hpx::chrono::high_resolution_timer const timer;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        Data received = Action()(there, data);
+        if (received.size() != data.size())
+        {
+            std::cerr << "pingpong_bandwidth: received unexpected data size"
+                      << std::endl;
+        }
+    }
+    return timer.elapsed();
+}
+
+void print_result(char const* name, std::size_t size, std::size_t iterations,
+    double elapsed)
+{
+    // every iteration transfers the data twice
+    double const bytes = 2.0 * static_cast<double>(size) *
+        static_cast<double>(iterations);
+
+    std::cout << name << "," << size << "," << iterations << "," << elapsed
+              << "," << bytes / elapsed / (1024.0 * 1024.0) << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const min_size = vm["min-size"].as<std::size_t>();
+    std::size_t const max_size = vm["max-size"].as<std::size_t>();
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+    bool const use_pool = vm.count("receive-pool") != 0;
+
+    if (min_size == 0)
+    {
+        std::cerr << "pingpong_bandwidth: min-size must be larger than zero"
+                  << std::endl;
+        return hpx::finalize();
+    }
+
+    std::vector<hpx::id_type> const localities =
+        hpx::find_remote_localities();
+    hpx::id_type const there =
+        localities.empty() ? hpx::find_here() : localities[0];
+
+    if (use_pool)
+    {
+        // only arrays large enough to be sent as zero-copy chunks are placed
+        // into the pool
+        register_receive_pool(HPX_ZERO_COPY_SERIALIZATION_THRESHOLD);
+        if (there != hpx::find_here())
+        {
+            register_receive_pool_action()(
+                there, HPX_ZERO_COPY_SERIALIZATION_THRESHOLD);
+        }
+    }
+
+    std::cout << "type,size [bytes],iterations,time [s],bandwidth [MB/s]"
+              << std::endl;
+
+    for (std::size_t size = min_size; size <= max_size; size *= 2)
+    {
+        buffer_type buffer(size);
+        std::fill(buffer.data(), buffer.data() + size, 'a');
+
+        print_result(use_pool ? "serialize_buffer (pool)" : "serialize_buffer",
+            size, iterations,
+            run_pingpong<echo_buffer_action>(there, buffer, iterations));
+
+        std::vector<char> const vector(size, 'a');
+        print_result("vector", size, iterations,
+            run_pingpong<echo_vector_action>(there, vector, iterations));
+    }
+
+    if (use_pool)
+    {
+        unregister_receive_pool();
+        if (there != hpx::find_here())
+        {
+            unregister_receive_pool_action()(there);
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("min-size",
+         hpx::program_options::value<std::size_t>()->default_value(1024),
+         "smallest array size to send (in bytes, default: 1024)")
+        ("max-size",
+         hpx::program_options::value<std::size_t>()->default_value(
+             16 * 1024 * 1024),
+         "largest array size to send (in bytes, default: 16MB)")
+        ("iterations",
+         hpx::program_options::value<std::size_t>()->default_value(100),
+         "number of round trips per array size (default: 100)")
+        ("receive-pool",
+         "receive serialize_buffers into memory taken from a pool registered "
+         "as the zero-copy receive allocator");
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
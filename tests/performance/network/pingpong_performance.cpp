@@ -4,16 +4,28 @@
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
+// This benchmark sends a given number of parcels to another locality and
+// reports the achieved message rate. The number of messages a TCP connection
+// may send before waiting for the acknowledgements of the receiving end can be
+// varied using --hpx:ini=hpx.parcel.tcp.send_window=N to measure the message
+// rate depending on the send window size. If parcelport counters are enabled,
+// the benchmark also reports the number of bytes sent per parcel, compare the
+// results for --hpx:ini=hpx.parcel.compact_header=0 and =1 to measure the
+// effect of the compact parcel header encoding.
+
 #include <hpx/config.hpp>
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 #include <hpx/include/async.hpp>
+#include <hpx/include/performance_counters.hpp>
 #include <hpx/include/serialization.hpp>
 #include <hpx/iostream.hpp>
+#include <hpx/modules/timing.hpp>
 
 #include <complex>
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -27,6 +39,36 @@ namespace pingpong { namespace server {
 HPX_PLAIN_ACTION(pingpong::server::get_element, pingpong_get_element_action)
 //HPX_ACTION_USES_MESSAGE_COALESCING(pingpong_get_element_action)
 
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+void print_bytes_per_parcel()
+{
+    using hpx::performance_counters::performance_counter;
+
+    std::string const pp =
+        hpx::get_config_entry("hpx.parcel.bootstrap", "tcp");
+    std::string const instance = "{locality#" +
+        std::to_string(hpx::get_locality_id()) + "/total}";
+
+    performance_counter parcels(
+        "/parcels" + instance + "/count/" + pp + "/sent");
+    performance_counter bytes(
+        "/serialize" + instance + "/count/" + pp + "/sent");
+
+    auto const num_parcels =
+        parcels.get_value<std::int64_t>(hpx::launch::sync);
+    auto const num_bytes = bytes.get_value<std::int64_t>(hpx::launch::sync);
+
+    hpx::cout << "Parcels sent: " << num_parcels << ", bytes sent: "
+              << num_bytes << ", bytes per parcel: "
+              << (num_parcels != 0 ?
+                         static_cast<double>(num_bytes) /
+                             static_cast<double>(num_parcels) :
+                         0.0)
+              << "\n"
+              << std::flush;
+}
+#endif
+
 int hpx_main(hpx::program_options::variables_map& vm)
 {
     //Commandline specific code
@@ -34,7 +76,12 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     if (0 == hpx::get_locality_id())
     {
-        hpx::cout << "Running With nparcel = " << n << "\n" << std::flush;
+        hpx::cout << "Running With nparcel = " << n << ", send_window = "
+                  << hpx::get_config_entry("hpx.parcel.tcp.send_window", "1")
+                  << ", compact_header = "
+                  << hpx::get_config_entry("hpx.parcel.compact_header", "0")
+                  << "\n"
+                  << std::flush;
     }
 
     //Create instance of the actions
@@ -47,13 +94,14 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::vector<hpx::id_type> dummy = hpx::find_remote_localities();
     hpx::id_type other_locality = dummy[0];
 
+    hpx::chrono::high_resolution_timer t;
     for (std::size_t i = 0; i < n; ++i)
     {
         vec.push_back(hpx::async(act, other_locality));
     }
 
     hpx::when_all(vec)
-        .then([&received, n](
+        .then([&received, n, &t](
                   hpx::future<std::vector<hpx::future<std::complex<double>>>>
                       dummy) {
             std::vector<hpx::future<std::complex<double>>> number = dummy.get();
@@ -61,12 +109,21 @@ int hpx_main(hpx::program_options::variables_map& vm)
             {
                 received.push_back(number[i].get());
             }
+            double const elapsed = t.elapsed();
             hpx::evaluate_active_counters(false, " All Futures Done");
+            hpx::cout << "Elapsed time: " << elapsed << " [s], message rate: "
+                      << static_cast<double>(n) / elapsed << " [msgs/s]\n"
+                      << std::flush;
             hpx::cout << "Now Done With Lambda and the last received value is "
                       << received[n - 1] << "\n"
                       << std::flush;
         })
         .get();
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+    print_bytes_per_parcel();
+#endif
+
     return hpx::finalize();
 }
 